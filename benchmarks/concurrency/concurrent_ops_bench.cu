@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark_defaults.hpp>
+#include <benchmark_utils.hpp>
+#include <trace_replay.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/key_generator.cuh>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/transform.h>
+
+#include <string>
+#include <vector>
+
+using namespace cuco::benchmark;  // defaults, dist_from_state
+using namespace cuco::utility;    // key_generator, distribution
+
+/**
+ * @brief A benchmark driving one shared `cuco::static_map` from multiple concurrent streams
+ *
+ * A configurable fraction of the streams issues bulk inserts while the remaining streams issue
+ * bulk finds, all overlapping against the same table. Aggregate throughput is reported by nvbench;
+ * per-stream batch latencies are timed with CUDA events and reported as reader/writer p99
+ * summaries so insert+find contention becomes visible. The map's `cuda::thread_scope` is a type
+ * axis to quantify the cost of the memory-scope guarantees under load.
+ *
+ * @note Scopes narrower than `thread_scope_device` are only semantically valid for the read-only
+ * mix (`WriteFraction` 0); for mixed runs they measure the upper bound of what scope relaxation
+ * could buy, not a correct configuration.
+ */
+template <typename Key, typename Value, typename ScopeT>
+std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_concurrent_mix(
+  nvbench::state& state, nvbench::type_list<Key, Value, ScopeT>)
+{
+  constexpr auto scope = ScopeT::value;
+  using pair_type      = cuco::pair<Key, Value>;
+  using map_type       = cuco::static_map<Key,
+                                          Value,
+                                          cuco::extent<std::size_t>,
+                                          scope,
+                                          thrust::equal_to<Key>,
+                                          cuco::linear_probing<4, cuco::default_hash_function<Key>>,
+                                          cuco::cuda_allocator<cuco::pair<Key, Value>>,
+                                          cuco::storage<1>>;
+
+  auto const num_streams    = state.get_int64("NumStreams");
+  auto const batch_size     = state.get_int64("BatchSize");
+  auto const write_fraction = state.get_float64("WriteFraction");
+  auto const num_writers    = static_cast<int64_t>(num_streams * write_fraction + 0.5);
+
+  std::size_t const num_keys = num_streams * batch_size;
+  std::size_t const capacity = num_keys / defaults::OCCUPANCY;
+
+  map_type map{capacity, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  // pre-fill the table so reader streams mostly hit
+  thrust::device_vector<Key> keys(num_keys);
+  key_generator gen;
+  gen.generate(dist_from_state<distribution::unique>(state), keys.begin(), keys.end());
+  thrust::device_vector<pair_type> pairs(num_keys);
+  thrust::transform(keys.begin(), keys.end(), pairs.begin(), [] __device__(Key const& key) {
+    return pair_type(key, {});
+  });
+  map.insert(pairs.begin(), pairs.end());
+
+  // writer streams re-insert their slice of the key population, reader streams query theirs, so
+  // all streams contend on the same slots without growing the table
+  std::vector<cudaStream_t> streams(num_streams);
+  for (auto& stream : streams) {
+    CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+  }
+
+  std::vector<std::vector<float>> stream_latencies(num_streams);
+  thrust::device_vector<Value> results(num_keys);
+
+  state.add_element_count(num_keys);
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    std::vector<cudaEvent_t> starts(num_streams);
+    std::vector<cudaEvent_t> stops(num_streams);
+    for (int64_t i = 0; i < num_streams; ++i) {
+      CUCO_CUDA_TRY(cudaEventCreate(&starts[i]));
+      CUCO_CUDA_TRY(cudaEventCreate(&stops[i]));
+
+      auto const offset = i * batch_size;
+      CUCO_CUDA_TRY(cudaEventRecord(starts[i], streams[i]));
+      if (i < num_writers) {
+        map.insert_async(pairs.begin() + offset, pairs.begin() + offset + batch_size, streams[i]);
+      } else {
+        map.find_async(keys.begin() + offset,
+                       keys.begin() + offset + batch_size,
+                       results.begin() + offset,
+                       streams[i]);
+      }
+      CUCO_CUDA_TRY(cudaEventRecord(stops[i], streams[i]));
+    }
+    CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+    for (int64_t i = 0; i < num_streams; ++i) {
+      float elapsed_ms{};
+      CUCO_CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, starts[i], stops[i]));
+      stream_latencies[i].push_back(elapsed_ms);
+      CUCO_CUDA_TRY(cudaEventDestroy(starts[i]));
+      CUCO_CUDA_TRY(cudaEventDestroy(stops[i]));
+    }
+  });
+
+  for (auto const stream : streams) {
+    CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+  }
+
+  // report the p99 batch latency of the slowest writer and the slowest reader stream
+  auto add_p99_summary = [&](std::string const& role, int64_t begin, int64_t end) {
+    float worst = 0.0f;
+    for (auto i = begin; i < end; ++i) {
+      worst = std::max(worst, trace::latency_percentile(stream_latencies[i], 99.0));
+    }
+    auto& summary = state.add_summary("cuco/concurrency/" + role + "/p99");
+    summary.set_string("name", role + " p99");
+    summary.set_string("hint", "duration");
+    summary.set_float64("value", worst * 1e-3);
+  };
+  if (num_writers > 0) { add_p99_summary("writer", 0, num_writers); }
+  if (num_writers < num_streams) { add_p99_summary("reader", num_writers, num_streams); }
+}
+
+template <typename Key, typename Value, typename ScopeT>
+std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> static_map_concurrent_mix(
+  nvbench::state& state, nvbench::type_list<Key, Value, ScopeT>)
+{
+  state.skip("Key should be the same type as Value.");
+}
+
+NVBENCH_DECLARE_ENUM_TYPE_STRINGS(
+  cuda::thread_scope,
+  [](cuda::thread_scope scope) {
+    switch (scope) {
+      case cuda::thread_scope_system: return "SYSTEM";
+      case cuda::thread_scope_device: return "DEVICE";
+      case cuda::thread_scope_block: return "BLOCK";
+      default: return "UNKNOWN";
+    }
+  },
+  [](cuda::thread_scope) { return std::string{}; })
+
+using scope_range = nvbench::enum_type_list<cuda::thread_scope_system,
+                                            cuda::thread_scope_device,
+                                            cuda::thread_scope_block>;
+
+NVBENCH_BENCH_TYPES(
+  static_map_concurrent_mix,
+  NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE, defaults::VALUE_TYPE_RANGE, scope_range))
+  .set_name("static_map_concurrent_mix")
+  .set_type_axes_names({"Key", "Value", "Scope"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumStreams", {1, 2, 4, 8})
+  .add_int64_axis("BatchSize", {defaults::BATCH_SIZE})
+  .add_float64_axis("WriteFraction", {0.0, 0.25, 0.5});
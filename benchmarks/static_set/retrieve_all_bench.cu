@@ -24,6 +24,8 @@
 
 #include <thrust/device_vector.h>
 
+#include <array>
+
 using namespace cuco::benchmark;  // defaults, dist_from_state
 using namespace cuco::utility;    // key_generator, distribution
 
@@ -54,6 +56,66 @@ void static_set_retrieve_all(nvbench::state& state, nvbench::type_list<Key, Dist
   });
 }
 
+/**
+ * @brief A benchmark evaluating `cuco::static_set::retrieve_chunk` export performance
+ *
+ * Streams the whole set through two fixed device buffers, overlapping the D2H copy of one chunk
+ * with the extraction of the next, as an export pipeline under a bounded memory budget would.
+ */
+template <typename Key, typename Dist>
+void static_set_retrieve_chunk(nvbench::state& state, nvbench::type_list<Key, Dist>)
+{
+  using set_type  = cuco::static_set<Key>;
+  using size_type = typename set_type::size_type;
+
+  auto const num_keys   = state.get_int64("NumInputs");
+  auto const occupancy  = state.get_float64("Occupancy");
+  auto const chunk_size = static_cast<size_type>(state.get_int64("ChunkSize"));
+
+  std::size_t const size = num_keys / occupancy;
+
+  thrust::device_vector<Key> keys(num_keys);
+
+  key_generator gen;
+  gen.generate(dist_from_state<Dist>(state), keys.begin(), keys.end());
+
+  set_type set{size, cuco::empty_key<Key>{-1}};
+  set.insert(keys.begin(), keys.end());
+
+  auto const total_windows = static_cast<size_type>(set.capacity()) / set_type::window_size;
+
+  std::array<thrust::device_vector<Key>, 2> buffers{thrust::device_vector<Key>(chunk_size),
+                                                    thrust::device_vector<Key>(chunk_size)};
+  Key* h_result{};
+  CUCO_CUDA_TRY(cudaMallocHost(&h_result, sizeof(Key) * num_keys));
+  cudaStream_t copy_stream{};
+  CUCO_CUDA_TRY(cudaStreamCreate(&copy_stream));
+
+  state.add_element_count(num_keys);
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    size_type window_offset = 0;
+    std::size_t num_out     = 0;
+    int buffer              = 0;
+    while (window_offset < total_windows) {
+      // `retrieve_chunk` synchronizes the launch stream, so the copy of the previous chunk on
+      // `copy_stream` overlaps with the extraction of this one
+      auto const num_retrieved = set.retrieve_chunk(
+        buffers[buffer].begin(), chunk_size, window_offset, {launch.get_stream()});
+      CUCO_CUDA_TRY(cudaMemcpyAsync(h_result + num_out,
+                                    buffers[buffer].data().get(),
+                                    sizeof(Key) * num_retrieved,
+                                    cudaMemcpyDeviceToHost,
+                                    copy_stream));
+      num_out += num_retrieved;
+      buffer ^= 1;
+    }
+    CUCO_CUDA_TRY(cudaStreamSynchronize(copy_stream));
+  });
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(copy_stream));
+  CUCO_CUDA_TRY(cudaFreeHost(h_result));
+}
+
 NVBENCH_BENCH_TYPES(static_set_retrieve_all,
                     NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
                                       nvbench::type_list<distribution::unique>))
@@ -62,3 +124,13 @@ NVBENCH_BENCH_TYPES(static_set_retrieve_all,
   .set_max_noise(defaults::MAX_NOISE)
   .add_int64_axis("NumInputs", {defaults::N})
   .add_float64_axis("Occupancy", defaults::OCCUPANCY_RANGE);
+
+NVBENCH_BENCH_TYPES(static_set_retrieve_chunk,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE,
+                                      nvbench::type_list<distribution::unique>))
+  .set_name("static_set_retrieve_chunk_unique_occupancy")
+  .set_type_axes_names({"Key", "Distribution"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumInputs", {defaults::N})
+  .add_float64_axis("Occupancy", {defaults::OCCUPANCY})
+  .add_int64_axis("ChunkSize", {1 << 20, 1 << 24});
@@ -0,0 +1,345 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/utility/key_generator.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace cuco::benchmark::trace {
+
+/**
+ * @brief Kind of a single recorded bulk operation
+ */
+enum class op_kind : std::uint8_t { insert = 0, find = 1, erase = 2 };
+
+/**
+ * @brief A recorded workload: a sequence of (operation, key batch) entries
+ *
+ * The on-disk format is a compact binary layout: an 8-byte magic string, a format version, the
+ * key width, and the number of batches, followed by one `(uint8 op, uint64 num_keys, raw keys)`
+ * record per batch.
+ *
+ * @tparam Key Key type of the recorded batches
+ */
+template <typename Key>
+struct workload_trace {
+  static_assert(std::is_trivially_copyable_v<Key>, "Trace keys must be trivially copyable");
+
+  std::vector<op_kind> ops;               ///< Operation of each batch
+  std::vector<std::vector<Key>> batches;  ///< Keys of each batch
+
+  static constexpr char magic[8]         = {'c', 'u', 'c', 'o', 't', 'r', 'c', '\0'};
+  static constexpr std::uint32_t version = 1;  ///< Binary format version
+
+  /**
+   * @brief Writes the trace to a binary file
+   *
+   * @param path Path of the output file
+   */
+  void write(std::string const& path) const
+  {
+    std::ofstream out{path, std::ios::binary};
+    CUCO_EXPECTS(out.good(), "Failed to open trace file for writing");
+
+    out.write(magic, sizeof(magic));
+    auto const key_bytes  = static_cast<std::uint32_t>(sizeof(Key));
+    auto const num_batches = static_cast<std::uint64_t>(batches.size());
+    out.write(reinterpret_cast<char const*>(&version), sizeof(version));
+    out.write(reinterpret_cast<char const*>(&key_bytes), sizeof(key_bytes));
+    out.write(reinterpret_cast<char const*>(&num_batches), sizeof(num_batches));
+
+    for (std::size_t i = 0; i < batches.size(); ++i) {
+      auto const op       = static_cast<std::uint8_t>(ops[i]);
+      auto const num_keys = static_cast<std::uint64_t>(batches[i].size());
+      out.write(reinterpret_cast<char const*>(&op), sizeof(op));
+      out.write(reinterpret_cast<char const*>(&num_keys), sizeof(num_keys));
+      out.write(reinterpret_cast<char const*>(batches[i].data()), num_keys * sizeof(Key));
+    }
+    CUCO_EXPECTS(out.good(), "Failed to write trace file");
+  }
+
+  /**
+   * @brief Reads a trace from a binary file
+   *
+   * @param path Path of the input file
+   *
+   * @return The recorded workload trace
+   */
+  static workload_trace read(std::string const& path)
+  {
+    std::ifstream in{path, std::ios::binary};
+    CUCO_EXPECTS(in.good(), "Failed to open trace file for reading");
+
+    char file_magic[8];
+    std::uint32_t file_version{};
+    std::uint32_t key_bytes{};
+    std::uint64_t num_batches{};
+    in.read(file_magic, sizeof(file_magic));
+    in.read(reinterpret_cast<char*>(&file_version), sizeof(file_version));
+    in.read(reinterpret_cast<char*>(&key_bytes), sizeof(key_bytes));
+    in.read(reinterpret_cast<char*>(&num_batches), sizeof(num_batches));
+    CUCO_EXPECTS(std::memcmp(file_magic, magic, sizeof(magic)) == 0, "Not a cuco trace file");
+    CUCO_EXPECTS(file_version == version, "Unsupported trace format version");
+    CUCO_EXPECTS(key_bytes == sizeof(Key), "Trace key width does not match the requested type");
+
+    workload_trace trace;
+    trace.ops.reserve(num_batches);
+    trace.batches.reserve(num_batches);
+    for (std::uint64_t i = 0; i < num_batches; ++i) {
+      std::uint8_t op{};
+      std::uint64_t num_keys{};
+      in.read(reinterpret_cast<char*>(&op), sizeof(op));
+      in.read(reinterpret_cast<char*>(&num_keys), sizeof(num_keys));
+      std::vector<Key> keys(num_keys);
+      in.read(reinterpret_cast<char*>(keys.data()), num_keys * sizeof(Key));
+      trace.ops.push_back(static_cast<op_kind>(op));
+      trace.batches.push_back(std::move(keys));
+    }
+    CUCO_EXPECTS(in.good(), "Failed to read trace file");
+    return trace;
+  }
+};
+
+/**
+ * @brief Operation mix of a synthetic workload
+ */
+struct op_mix {
+  double find_fraction;    ///< Fraction of find batches
+  double insert_fraction;  ///< Fraction of insert batches
+  double erase_fraction;   ///< Fraction of erase batches
+};
+
+/**
+ * @brief Generates a synthetic workload trace with the given operation mix and drifting key skew
+ *
+ * Keys of all batches are drawn from a single `distribution::drifting_gaussian` sequence, so the
+ * key skew changes gradually from the first to the last batch of the trace.
+ *
+ * @tparam Key Key type of the generated batches
+ *
+ * @param num_batches Number of batches to generate
+ * @param batch_size Number of keys per batch
+ * @param mix Fractions of find/insert/erase batches; must sum to 1
+ * @param skew Drifting skew of the key distribution
+ * @param seed Random seed
+ *
+ * @return The generated workload trace
+ */
+template <typename Key>
+workload_trace<Key> generate_workload_trace(std::size_t num_batches,
+                                            std::size_t batch_size,
+                                            op_mix mix,
+                                            cuco::utility::distribution::drifting_gaussian skew,
+                                            std::uint32_t seed = 42)
+{
+  CUCO_EXPECTS(std::abs(mix.find_fraction + mix.insert_fraction + mix.erase_fraction - 1.0) < 1e-9,
+               "Operation mix fractions must sum to 1");
+
+  auto const num_keys = num_batches * batch_size;
+  thrust::device_vector<Key> d_keys(num_keys);
+
+  cuco::utility::key_generator gen{seed};
+  gen.generate(skew, d_keys.begin(), d_keys.end());
+  thrust::host_vector<Key> h_keys = d_keys;
+
+  std::mt19937 rng{seed};
+  std::discrete_distribution<int> op_dist{
+    mix.insert_fraction, mix.find_fraction, mix.erase_fraction};
+
+  workload_trace<Key> trace;
+  trace.ops.reserve(num_batches);
+  trace.batches.reserve(num_batches);
+  for (std::size_t i = 0; i < num_batches; ++i) {
+    // indices of discrete_distribution map to the op_kind enumerators
+    trace.ops.push_back(static_cast<op_kind>(op_dist(rng)));
+    trace.batches.emplace_back(h_keys.begin() + i * batch_size,
+                               h_keys.begin() + (i + 1) * batch_size);
+  }
+  return trace;
+}
+
+/**
+ * @brief Per-operation batch latencies of a replay run, in milliseconds
+ */
+struct replay_result {
+  std::vector<float> insert_ms;  ///< Latencies of insert batches
+  std::vector<float> find_ms;    ///< Latencies of find batches
+  std::vector<float> erase_ms;   ///< Latencies of erase batches
+};
+
+namespace detail {
+
+template <typename Container, typename = void>
+struct has_mapped_type : std::false_type {};
+
+template <typename Container>
+struct has_mapped_type<Container, std::void_t<typename Container::mapped_type>> : std::true_type {
+};
+
+}  // namespace detail
+
+/**
+ * @brief Replays a workload trace against a container, timing every batch with CUDA events
+ *
+ * Batches are issued in trace order, round-robin across the given streams; batches on different
+ * streams may overlap. The trace's key batches must already be resident in device memory (see
+ * `upload_trace`).
+ *
+ * @tparam Container cuco container type (`static_map` or `static_set`)
+ * @tparam Key Key type of the trace
+ *
+ * @param container Container to replay against
+ * @param ops Operation of each batch
+ * @param d_batches Device-resident keys of each batch
+ * @param streams Streams to issue the batches on
+ *
+ * @return Per-operation batch latencies
+ */
+template <typename Container, typename Key>
+replay_result replay(Container& container,
+                     std::vector<op_kind> const& ops,
+                     std::vector<thrust::device_vector<Key>> const& d_batches,
+                     std::vector<cudaStream_t> const& streams)
+{
+  constexpr bool is_map = detail::has_mapped_type<Container>::value;
+
+  auto const num_batches = ops.size();
+  auto const max_batch_size =
+    std::max_element(d_batches.begin(),
+                     d_batches.end(),
+                     [](auto const& lhs, auto const& rhs) { return lhs.size() < rhs.size(); })
+      ->size();
+
+  // scratch buffers, one per stream so overlapping batches do not race
+  using result_type =
+    std::conditional_t<is_map, typename Container::mapped_type, typename Container::key_type>;
+  std::vector<thrust::device_vector<result_type>> results;
+  std::vector<thrust::device_vector<typename Container::value_type>> pairs;
+  for (std::size_t i = 0; i < streams.size(); ++i) {
+    results.emplace_back(max_batch_size);
+    if constexpr (is_map) { pairs.emplace_back(max_batch_size); }
+  }
+
+  std::vector<cudaEvent_t> starts(num_batches);
+  std::vector<cudaEvent_t> stops(num_batches);
+  for (std::size_t i = 0; i < num_batches; ++i) {
+    CUCO_CUDA_TRY(cudaEventCreate(&starts[i]));
+    CUCO_CUDA_TRY(cudaEventCreate(&stops[i]));
+  }
+
+  for (std::size_t i = 0; i < num_batches; ++i) {
+    auto const stream_id = i % streams.size();
+    auto const stream    = streams[stream_id];
+    auto const& keys     = d_batches[i];
+
+    CUCO_CUDA_TRY(cudaEventRecord(starts[i], stream));
+    switch (ops[i]) {
+      case op_kind::insert:
+        if constexpr (is_map) {
+          auto& batch_pairs = pairs[stream_id];
+          thrust::transform(thrust::cuda::par_nosync.on(stream),
+                            keys.begin(),
+                            keys.end(),
+                            batch_pairs.begin(),
+                            cuda::proclaim_return_type<typename Container::value_type>(
+                              [] __device__(Key const& key) {
+                                return typename Container::value_type{key, {}};
+                              }));
+          container.insert_async(batch_pairs.begin(), batch_pairs.begin() + keys.size(), stream);
+        } else {
+          container.insert_async(keys.begin(), keys.end(), stream);
+        }
+        break;
+      case op_kind::find:
+        container.find_async(keys.begin(), keys.end(), results[stream_id].begin(), stream);
+        break;
+      case op_kind::erase:
+        container.erase_async(keys.begin(), keys.end(), stream);
+        break;
+    }
+    CUCO_CUDA_TRY(cudaEventRecord(stops[i], stream));
+  }
+  CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+  replay_result result;
+  for (std::size_t i = 0; i < num_batches; ++i) {
+    float elapsed_ms{};
+    CUCO_CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, starts[i], stops[i]));
+    switch (ops[i]) {
+      case op_kind::insert: result.insert_ms.push_back(elapsed_ms); break;
+      case op_kind::find: result.find_ms.push_back(elapsed_ms); break;
+      case op_kind::erase: result.erase_ms.push_back(elapsed_ms); break;
+    }
+    CUCO_CUDA_TRY(cudaEventDestroy(starts[i]));
+    CUCO_CUDA_TRY(cudaEventDestroy(stops[i]));
+  }
+  return result;
+}
+
+/**
+ * @brief Copies the key batches of a trace to device memory
+ *
+ * @tparam Key Key type of the trace
+ *
+ * @param trace Trace whose batches are uploaded
+ *
+ * @return Device-resident copies of the trace's key batches
+ */
+template <typename Key>
+std::vector<thrust::device_vector<Key>> upload_trace(workload_trace<Key> const& trace)
+{
+  std::vector<thrust::device_vector<Key>> d_batches;
+  d_batches.reserve(trace.batches.size());
+  for (auto const& batch : trace.batches) {
+    d_batches.emplace_back(batch);
+  }
+  return d_batches;
+}
+
+/**
+ * @brief Computes the given percentile of a latency sample
+ *
+ * @param values Latency sample; modified by partial sorting
+ * @param percentile Requested percentile in [0, 100]
+ *
+ * @return The percentile value, or 0 if the sample is empty
+ */
+inline float latency_percentile(std::vector<float>& values, double percentile)
+{
+  if (values.empty()) { return 0.0f; }
+  auto const rank = std::min(
+    values.size() - 1, static_cast<std::size_t>(percentile / 100.0 * (values.size() - 1) + 0.5));
+  std::nth_element(values.begin(), values.begin() + rank, values.end());
+  return values[rank];
+}
+
+}  // namespace cuco::benchmark::trace
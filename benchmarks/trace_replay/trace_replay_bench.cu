@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark_defaults.hpp>
+#include <benchmark_utils.hpp>
+#include <trace_replay.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/static_set.cuh>
+
+#include <nvbench/nvbench.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/transform.h>
+
+#include <string>
+#include <vector>
+
+using namespace cuco::benchmark;  // defaults, dist_from_state
+using namespace cuco::utility;    // key_generator, distribution
+
+namespace {
+
+// production-like default mix: 70% find / 20% insert / 10% erase
+constexpr trace::op_mix default_mix{0.7, 0.2, 0.1};
+
+/**
+ * @brief Reports per-op latency percentiles of a replay run as custom nvbench summaries
+ */
+void add_latency_summaries(nvbench::state& state,
+                           std::string const& op,
+                           std::vector<float>& latencies_ms)
+{
+  for (auto const percentile : {50.0, 90.0, 99.0}) {
+    auto& summary = state.add_summary("cuco/trace/" + op + "/p" +
+                                      std::to_string(static_cast<int>(percentile)));
+    summary.set_string("name", op + " p" + std::to_string(static_cast<int>(percentile)));
+    summary.set_string("hint", "duration");
+    summary.set_float64("value", trace::latency_percentile(latencies_ms, percentile) * 1e-3);
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief A benchmark replaying a mixed find/insert/erase trace against `cuco::static_map`
+ */
+template <typename Key, typename Value>
+std::enable_if_t<(sizeof(Key) == sizeof(Value)), void> static_map_trace_replay(
+  nvbench::state& state, nvbench::type_list<Key, Value>)
+{
+  using pair_type = cuco::pair<Key, Value>;
+
+  auto const num_batches = state.get_int64("NumBatches");
+  auto const batch_size  = state.get_int64("BatchSize");
+  auto const num_streams = state.get_int64("NumStreams");
+  auto const num_keys    = num_batches * batch_size;
+
+  auto const trace_data = trace::generate_workload_trace<Key>(
+    num_batches, batch_size, default_mix, distribution::drifting_gaussian{0.1, 0.5});
+  auto const d_batches = trace::upload_trace(trace_data);
+
+  std::size_t const capacity = num_keys / defaults::OCCUPANCY;
+  // the mix contains erase batches, so an erased key sentinel is required; generated keys are
+  // non-negative, making -2 a safe choice
+  auto map                   = cuco::static_map{capacity,
+                               cuco::empty_key<Key>{-1},
+                               cuco::empty_value<Value>{-1},
+                               cuco::erased_key<Key>{-2}};
+
+  // pre-fill with the trace's key population so finds mostly hit and erases mostly succeed
+  thrust::device_vector<Key> all_keys(num_keys);
+  {
+    key_generator gen;
+    gen.generate(distribution::drifting_gaussian{0.1, 0.5}, all_keys.begin(), all_keys.end());
+    thrust::device_vector<pair_type> pairs(num_keys);
+    thrust::transform(all_keys.begin(), all_keys.end(), pairs.begin(), [] __device__(Key const& key) {
+      return pair_type(key, {});
+    });
+    map.insert(pairs.begin(), pairs.end());
+  }
+
+  std::vector<cudaStream_t> streams(num_streams);
+  for (auto& stream : streams) {
+    CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+  }
+
+  trace::replay_result latencies;
+  state.add_element_count(num_keys);
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result = trace::replay(map, trace_data.ops, d_batches, streams);
+    latencies.insert_ms.insert(
+      latencies.insert_ms.end(), result.insert_ms.begin(), result.insert_ms.end());
+    latencies.find_ms.insert(
+      latencies.find_ms.end(), result.find_ms.begin(), result.find_ms.end());
+    latencies.erase_ms.insert(
+      latencies.erase_ms.end(), result.erase_ms.begin(), result.erase_ms.end());
+  });
+
+  for (auto const stream : streams) {
+    CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+  }
+
+  add_latency_summaries(state, "insert", latencies.insert_ms);
+  add_latency_summaries(state, "find", latencies.find_ms);
+  add_latency_summaries(state, "erase", latencies.erase_ms);
+}
+
+template <typename Key, typename Value>
+std::enable_if_t<(sizeof(Key) != sizeof(Value)), void> static_map_trace_replay(
+  nvbench::state& state, nvbench::type_list<Key, Value>)
+{
+  state.skip("Key should be the same type as Value.");
+}
+
+/**
+ * @brief A benchmark replaying a mixed find/insert/erase trace against `cuco::static_set`
+ */
+template <typename Key>
+void static_set_trace_replay(nvbench::state& state, nvbench::type_list<Key>)
+{
+  auto const num_batches = state.get_int64("NumBatches");
+  auto const batch_size  = state.get_int64("BatchSize");
+  auto const num_streams = state.get_int64("NumStreams");
+  auto const num_keys    = num_batches * batch_size;
+
+  auto const trace_data = trace::generate_workload_trace<Key>(
+    num_batches, batch_size, default_mix, distribution::drifting_gaussian{0.1, 0.5});
+  auto const d_batches = trace::upload_trace(trace_data);
+
+  std::size_t const capacity = num_keys / defaults::OCCUPANCY;
+  // the mix contains erase batches, so an erased key sentinel is required; generated keys are
+  // non-negative, making -2 a safe choice
+  auto set = cuco::static_set{capacity, cuco::empty_key<Key>{-1}, cuco::erased_key<Key>{-2}};
+
+  thrust::device_vector<Key> all_keys(num_keys);
+  key_generator gen;
+  gen.generate(distribution::drifting_gaussian{0.1, 0.5}, all_keys.begin(), all_keys.end());
+  set.insert(all_keys.begin(), all_keys.end());
+
+  std::vector<cudaStream_t> streams(num_streams);
+  for (auto& stream : streams) {
+    CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+  }
+
+  trace::replay_result latencies;
+  state.add_element_count(num_keys);
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch&) {
+    auto result = trace::replay(set, trace_data.ops, d_batches, streams);
+    latencies.insert_ms.insert(
+      latencies.insert_ms.end(), result.insert_ms.begin(), result.insert_ms.end());
+    latencies.find_ms.insert(
+      latencies.find_ms.end(), result.find_ms.begin(), result.find_ms.end());
+    latencies.erase_ms.insert(
+      latencies.erase_ms.end(), result.erase_ms.begin(), result.erase_ms.end());
+  });
+
+  for (auto const stream : streams) {
+    CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+  }
+
+  add_latency_summaries(state, "insert", latencies.insert_ms);
+  add_latency_summaries(state, "find", latencies.find_ms);
+  add_latency_summaries(state, "erase", latencies.erase_ms);
+}
+
+NVBENCH_BENCH_TYPES(static_map_trace_replay,
+                    NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE, defaults::VALUE_TYPE_RANGE))
+  .set_name("static_map_trace_replay")
+  .set_type_axes_names({"Key", "Value"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumBatches", {64})
+  .add_int64_axis("BatchSize", {defaults::BATCH_SIZE})
+  .add_int64_axis("NumStreams", {1, 2, 4});
+
+NVBENCH_BENCH_TYPES(static_set_trace_replay, NVBENCH_TYPE_AXES(defaults::KEY_TYPE_RANGE))
+  .set_name("static_set_trace_replay")
+  .set_type_axes_names({"Key"})
+  .set_max_noise(defaults::MAX_NOISE)
+  .add_int64_axis("NumBatches", {64})
+  .add_int64_axis("BatchSize", {defaults::BATCH_SIZE})
+  .add_int64_axis("NumStreams", {1, 2, 4});
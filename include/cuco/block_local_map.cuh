@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/aow_storage.cuh>
+#include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/pair.cuh>
+#include <cuco/probing_scheme.cuh>
+#include <cuco/static_map_ref.cuh>
+#include <cuco/types.cuh>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <thrust/functional.h>
+
+#include <cooperative_groups.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco {
+
+/**
+ * @brief A block-local, shared memory hash map with compile-time capacity.
+ *
+ * This container is the building block for two-level aggregation: each block aggregates into its
+ * shared memory map and spills the combined partial results into a global table once, instead of
+ * contending on the global table per input element. It bundles the pieces that otherwise have to
+ * be hand-rolled in every kernel: the capacity is a compile-time constant so the window storage
+ * can live in static shared memory and the probing arithmetic folds to constants, the constructor
+ * cooperatively initializes the storage with all threads of the block, and `flush` spills the
+ * block-local content into a global container ref.
+ *
+ * Example usage:
+ * @code{.cpp}
+ * using local_map = cuco::block_local_map<int, int, 1024>;
+ *
+ * __global__ void kernel(GlobalRef global_ref, ...)
+ * {
+ *   __shared__ typename local_map::window_type windows[local_map::num_windows];
+ *
+ *   auto const block = cooperative_groups::this_thread_block();
+ *   auto map = local_map{block, windows, cuco::empty_key<int>{-1}, cuco::empty_value<int>{0}};
+ *
+ *   // ... each thread aggregates into `map` via `insert_and_find` + atomic payload update ...
+ *
+ *   map.flush(block, global_ref);
+ * }
+ * @endcode
+ *
+ * @note Concurrent modification is limited to `cuda::thread_scope_block`; the map must not be
+ * accessed by threads outside the owning block.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam T Type of the mapped values
+ * @tparam Capacity Requested lower-bound number of slots
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam WindowSize Number of slots in each window
+ */
+template <class Key,
+          class T,
+          std::size_t Capacity,
+          class KeyEqual      = thrust::equal_to<Key>,
+          class ProbingScheme = cuco::linear_probing<1, cuco::default_hash_function<Key>>,
+          int32_t WindowSize  = 1>
+class block_local_map {
+ public:
+  static constexpr auto cg_size      = ProbingScheme::cg_size;    ///< CG size used for probing
+  static constexpr auto window_size  = WindowSize;                ///< Window size used for probing
+  static constexpr auto thread_scope = cuda::thread_scope_block;  ///< CUDA thread scope
+
+  using key_type    = Key;                                  ///< Key type
+  using mapped_type = T;                                    ///< Payload type
+  using value_type  = cuco::pair<Key, T>;                   ///< Slot type
+  using extent_type = cuco::extent<std::size_t, Capacity>;  ///< Compile-time extent type
+
+  /// Valid window extent computed from the requested capacity
+  static constexpr auto window_extent = make_window_extent<cg_size, window_size>(extent_type{});
+  /// Number of shared memory windows the caller must provide
+  static constexpr std::size_t num_windows = window_extent.value();
+
+  /// Non-owning window storage ref type
+  using storage_ref_type = aow_storage_ref<value_type, window_size, decltype(window_extent)>;
+  using window_type      = typename storage_ref_type::window_type;  ///< Window type
+  /// Non-owning container ref type
+  using ref_type = static_map_ref<key_type,
+                                  mapped_type,
+                                  thread_scope,
+                                  KeyEqual,
+                                  ProbingScheme,
+                                  storage_ref_type,
+                                  op::insert_tag,
+                                  op::insert_and_find_tag,
+                                  op::contains_tag,
+                                  op::find_tag>;
+
+  using iterator       = typename ref_type::iterator;        ///< Slot iterator type
+  using const_iterator = typename ref_type::const_iterator;  ///< Const slot iterator type
+
+  /**
+   * @brief Constructs the map over the given shared memory windows and cooperatively initializes
+   * them.
+   *
+   * @note This function synchronizes the given block.
+   *
+   * @param block The thread block that owns the map
+   * @param windows Pointer to `num_windows` windows of shared memory
+   * @param empty_key_sentinel Sentinel value used to represent an empty key slot
+   * @param empty_value_sentinel Sentinel value used to represent an empty payload slot
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   */
+  __device__ block_local_map(cooperative_groups::thread_block const& block,
+                             window_type* windows,
+                             cuco::empty_key<Key> empty_key_sentinel,
+                             cuco::empty_value<T> empty_value_sentinel,
+                             KeyEqual const& pred                = {},
+                             ProbingScheme const& probing_scheme = {}) noexcept
+    : ref_{empty_key_sentinel,
+           empty_value_sentinel,
+           pred,
+           probing_scheme,
+           cuco::thread_scope_block,
+           storage_ref_type{window_extent, windows}},
+      windows_{windows}
+  {
+    ref_.initialize(block);
+  }
+
+  /**
+   * @brief Gets the maximum number of elements the map can hold.
+   *
+   * @return The maximum number of elements the map can hold
+   */
+  [[nodiscard]] __device__ constexpr auto capacity() const noexcept { return ref_.capacity(); }
+
+  /**
+   * @brief Gets the non-incrementable past-the-end slot iterator.
+   *
+   * @return An iterator to one past the last slot
+   */
+  [[nodiscard]] __device__ constexpr const_iterator end() const noexcept { return ref_.end(); }
+
+  /**
+   * @brief Inserts a key/value pair.
+   *
+   * @param value The pair to insert
+   *
+   * @return `true` if the given pair is successfully inserted
+   */
+  __device__ bool insert(value_type const& value) noexcept { return ref_.insert(value); }
+
+  /**
+   * @brief Inserts a key/value pair using a cooperative group.
+   *
+   * @param group The Cooperative Group used to perform group insert
+   * @param value The pair to insert
+   *
+   * @return `true` if the given pair is successfully inserted
+   */
+  __device__ bool insert(cooperative_groups::thread_block_tile<cg_size> const& group,
+                         value_type const& value) noexcept
+  {
+    return ref_.insert(group, value);
+  }
+
+  /**
+   * @brief Inserts a key/value pair and returns an iterator to the inserted or existing element.
+   *
+   * The returned iterator enables in-place payload aggregation: if the key already exists, the
+   * payload can be combined with an atomic operation at block scope.
+   *
+   * @param value The pair to insert
+   *
+   * @return A pair of an iterator to the element and a boolean indicating whether the insertion
+   * took place
+   */
+  __device__ auto insert_and_find(value_type const& value) noexcept
+  {
+    return ref_.insert_and_find(value);
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` is present in the map.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  {
+    return ref_.contains(key);
+  }
+
+  /**
+   * @brief Finds an element with key equivalent to the probe key.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return An iterator to the matching element, or `end()` if no such element exists
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ const_iterator find(ProbeKey const& key) const noexcept
+  {
+    return ref_.find(key);
+  }
+
+  /**
+   * @brief Cooperatively inserts all pairs of the block-local map into a global container.
+   *
+   * All threads of the block participate; the filled slots are distributed over the block's
+   * threads (or tiles, if the target ref probes cooperatively) and inserted through the given ref.
+   *
+   * @note This function synchronizes the given block before reading the local storage, so callers
+   * do not need a separate barrier between their last modification and the flush.
+   * @note When flushing partial aggregates, pass a ref whose insert operation combines payloads,
+   * e.g., a `static_map` ref with `insert_or_apply` semantics wrapped accordingly.
+   *
+   * @tparam GlobalRef Type of the target container ref; must support `insert`
+   *
+   * @param block The thread block that owns the map
+   * @param global_ref Non-owning ref of the global container to insert into
+   */
+  template <typename GlobalRef>
+  __device__ void flush(cooperative_groups::thread_block const& block,
+                        GlobalRef global_ref) const noexcept
+  {
+    block.sync();
+
+    auto const empty_sentinel = ref_.empty_key_sentinel();
+    auto const num_slots      = num_windows * window_size;
+
+    if constexpr (GlobalRef::cg_size == 1) {
+      for (auto idx = block.thread_rank(); idx < num_slots; idx += block.size()) {
+        auto const slot = windows_[idx / window_size][idx % window_size];
+        if (not cuco::detail::bitwise_compare(slot.first, empty_sentinel)) {
+          global_ref.insert(slot);
+        }
+      }
+    } else {
+      auto const tile = cooperative_groups::tiled_partition<GlobalRef::cg_size>(block);
+      for (auto idx = tile.meta_group_rank(); idx < num_slots; idx += tile.meta_group_size()) {
+        auto const slot = windows_[idx / window_size][idx % window_size];
+        if (not cuco::detail::bitwise_compare(slot.first, empty_sentinel)) {
+          global_ref.insert(tile, slot);
+        }
+      }
+    }
+  }
+
+ private:
+  ref_type ref_;          ///< Container ref over the shared memory storage
+  window_type* windows_;  ///< Pointer to the shared memory windows
+};
+
+}  // namespace cuco
@@ -0,0 +1,249 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/aow_storage.cuh>
+#include <cuco/detail/bitwise_compare.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/operator.hpp>
+#include <cuco/probing_scheme.cuh>
+#include <cuco/static_set_ref.cuh>
+#include <cuco/types.cuh>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <thrust/functional.h>
+
+#include <cooperative_groups.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco {
+
+/**
+ * @brief A block-local, shared memory hash set with compile-time capacity.
+ *
+ * This container is the building block for two-level algorithms that pre-deduplicate or
+ * pre-aggregate within a thread block before touching a global table. It bundles the pieces that
+ * otherwise have to be hand-rolled in every kernel: the capacity is a compile-time constant so the
+ * window storage can live in static shared memory and the probing arithmetic folds to constants,
+ * the constructor cooperatively initializes the storage with all threads of the block, and
+ * `flush` spills the block-local content into a global container ref.
+ *
+ * Example usage:
+ * @code{.cpp}
+ * using local_set = cuco::block_local_set<int, 1024>;
+ *
+ * __global__ void kernel(GlobalRef global_ref, ...)
+ * {
+ *   __shared__ typename local_set::window_type windows[local_set::num_windows];
+ *
+ *   auto const block = cooperative_groups::this_thread_block();
+ *   auto set         = local_set{block, windows, cuco::empty_key<int>{-1}};
+ *
+ *   // ... each thread inserts into `set` ...
+ *
+ *   set.flush(block, global_ref);
+ * }
+ * @endcode
+ *
+ * @note Concurrent modification is limited to `cuda::thread_scope_block`; the set must not be
+ * accessed by threads outside the owning block.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam Capacity Requested lower-bound number of slots
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam WindowSize Number of slots in each window
+ */
+template <class Key,
+          std::size_t Capacity,
+          class KeyEqual      = thrust::equal_to<Key>,
+          class ProbingScheme = cuco::linear_probing<1, cuco::default_hash_function<Key>>,
+          int32_t WindowSize  = 1>
+class block_local_set {
+ public:
+  static constexpr auto cg_size      = ProbingScheme::cg_size;      ///< CG size used for probing
+  static constexpr auto window_size  = WindowSize;                  ///< Window size used for probing
+  static constexpr auto thread_scope = cuda::thread_scope_block;    ///< CUDA thread scope
+
+  using key_type    = Key;                                  ///< Key type
+  using value_type  = Key;                                  ///< Slot type
+  using extent_type = cuco::extent<std::size_t, Capacity>;  ///< Compile-time extent type
+
+  /// Valid window extent computed from the requested capacity
+  static constexpr auto window_extent = make_window_extent<cg_size, window_size>(extent_type{});
+  /// Number of shared memory windows the caller must provide
+  static constexpr std::size_t num_windows = window_extent.value();
+
+  /// Non-owning window storage ref type
+  using storage_ref_type = aow_storage_ref<value_type, window_size, decltype(window_extent)>;
+  using window_type      = typename storage_ref_type::window_type;  ///< Window type
+  /// Non-owning container ref type
+  using ref_type = static_set_ref<key_type,
+                                  thread_scope,
+                                  KeyEqual,
+                                  ProbingScheme,
+                                  storage_ref_type,
+                                  op::insert_tag,
+                                  op::contains_tag>;
+
+  /**
+   * @brief Constructs the set over the given shared memory windows and cooperatively initializes
+   * them.
+   *
+   * @note This function synchronizes the given block.
+   *
+   * @param block The thread block that owns the set
+   * @param windows Pointer to `num_windows` windows of shared memory
+   * @param empty_key_sentinel Sentinel value used to represent an empty slot
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   */
+  __device__ block_local_set(cooperative_groups::thread_block const& block,
+                             window_type* windows,
+                             cuco::empty_key<Key> empty_key_sentinel,
+                             KeyEqual const& pred                = {},
+                             ProbingScheme const& probing_scheme = {}) noexcept
+    : ref_{empty_key_sentinel,
+           pred,
+           probing_scheme,
+           cuco::thread_scope_block,
+           storage_ref_type{window_extent, windows}},
+      windows_{windows}
+  {
+    ref_.initialize(block);
+  }
+
+  /**
+   * @brief Gets the maximum number of elements the set can hold.
+   *
+   * @return The maximum number of elements the set can hold
+   */
+  [[nodiscard]] __device__ constexpr auto capacity() const noexcept { return ref_.capacity(); }
+
+  /**
+   * @brief Inserts a key.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to insert
+   *
+   * @return `true` if the given key is successfully inserted
+   */
+  template <typename ProbeKey>
+  __device__ bool insert(ProbeKey const& key) noexcept
+  {
+    return ref_.insert(key);
+  }
+
+  /**
+   * @brief Inserts a key using a cooperative group.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group insert
+   * @param key The key to insert
+   *
+   * @return `true` if the given key is successfully inserted
+   */
+  template <typename ProbeKey>
+  __device__ bool insert(cooperative_groups::thread_block_tile<cg_size> const& group,
+                         ProbeKey const& key) noexcept
+  {
+    return ref_.insert(group, key);
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` is present in the set.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(ProbeKey const& key) const noexcept
+  {
+    return ref_.contains(key);
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` is present in the set using a cooperative group.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group contains
+   * @param key The key to search for
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains(
+    cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
+  {
+    return ref_.contains(group, key);
+  }
+
+  /**
+   * @brief Cooperatively inserts all keys of the block-local set into a global container.
+   *
+   * All threads of the block participate; the filled slots are distributed over the block's
+   * threads (or tiles, if the target ref probes cooperatively) and inserted through the given ref.
+   *
+   * @note This function synchronizes the given block before reading the local storage, so callers
+   * do not need a separate barrier between their last `insert` and the flush.
+   *
+   * @tparam GlobalRef Type of the target container ref; must support `insert`
+   *
+   * @param block The thread block that owns the set
+   * @param global_ref Non-owning ref of the global container to insert into
+   */
+  template <typename GlobalRef>
+  __device__ void flush(cooperative_groups::thread_block const& block,
+                        GlobalRef global_ref) const noexcept
+  {
+    block.sync();
+
+    auto const empty_sentinel = ref_.empty_key_sentinel();
+    auto const num_slots      = num_windows * window_size;
+
+    if constexpr (GlobalRef::cg_size == 1) {
+      for (auto idx = block.thread_rank(); idx < num_slots; idx += block.size()) {
+        auto const slot = windows_[idx / window_size][idx % window_size];
+        if (not cuco::detail::bitwise_compare(slot, empty_sentinel)) { global_ref.insert(slot); }
+      }
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<GlobalRef::cg_size>(block);
+      for (auto idx = tile.meta_group_rank(); idx < num_slots; idx += tile.meta_group_size()) {
+        auto const slot = windows_[idx / window_size][idx % window_size];
+        if (not cuco::detail::bitwise_compare(slot, empty_sentinel)) {
+          global_ref.insert(tile, slot);
+        }
+      }
+    }
+  }
+
+ private:
+  ref_type ref_;          ///< Container ref over the shared memory storage
+  window_type* windows_;  ///< Pointer to the shared memory windows
+};
+
+}  // namespace cuco
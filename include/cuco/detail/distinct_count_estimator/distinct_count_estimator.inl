@@ -100,6 +100,20 @@ constexpr void distinct_count_estimator<T, Scope, Hash, Allocator>::merge(
   this->impl_->merge(other_ref.impl_, stream);
 }
 
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void distinct_count_estimator<T, Scope, Hash, Allocator>::merge_many_async(
+  cuda::std::span<std::byte const> sketches, cuda::stream_ref stream)
+{
+  this->impl_->merge_many_async(sketches, stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void distinct_count_estimator<T, Scope, Hash, Allocator>::merge_many(
+  cuda::std::span<std::byte const> sketches, cuda::stream_ref stream)
+{
+  this->impl_->merge_many(sketches, stream);
+}
+
 template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
 constexpr std::size_t distinct_count_estimator<T, Scope, Hash, Allocator>::estimate(
   cuda::stream_ref stream) const
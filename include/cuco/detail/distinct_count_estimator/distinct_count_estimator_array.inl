@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace cuco {
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr distinct_count_estimator_array<T, Scope, Hash, Allocator>::
+  distinct_count_estimator_array(std::size_t num_sketches,
+                                 cuco::sketch_size_kb sketch_size_kb,
+                                 Hash const& hash,
+                                 Allocator const& alloc,
+                                 cuda::stream_ref stream)
+  : impl_{std::make_unique<impl_type>(num_sketches, sketch_size_kb, hash, alloc, stream)}
+{
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void distinct_count_estimator_array<T, Scope, Hash, Allocator>::clear_async(
+  cuda::stream_ref stream) noexcept
+{
+  this->impl_->clear_async(stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void distinct_count_estimator_array<T, Scope, Hash, Allocator>::clear(
+  cuda::stream_ref stream)
+{
+  this->impl_->clear(stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+template <class InputIt, class GroupIt>
+constexpr void distinct_count_estimator_array<T, Scope, Hash, Allocator>::add_async(
+  InputIt first, InputIt last, GroupIt group_first, cuda::stream_ref stream)
+{
+  this->impl_->add_async(first, last, group_first, stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+template <class InputIt, class GroupIt>
+constexpr void distinct_count_estimator_array<T, Scope, Hash, Allocator>::add(
+  InputIt first, InputIt last, GroupIt group_first, cuda::stream_ref stream)
+{
+  this->impl_->add(first, last, group_first, stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void distinct_count_estimator_array<T, Scope, Hash, Allocator>::estimate_async(
+  std::size_t* cardinalities, cuda::stream_ref stream) const noexcept
+{
+  this->impl_->estimate_async(cardinalities, stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr void distinct_count_estimator_array<T, Scope, Hash, Allocator>::estimate(
+  std::size_t* cardinalities, cuda::stream_ref stream) const
+{
+  this->impl_->estimate(cardinalities, stream);
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr typename distinct_count_estimator_array<T, Scope, Hash, Allocator>::ref_type<>
+distinct_count_estimator_array<T, Scope, Hash, Allocator>::ref(std::size_t i) const noexcept
+{
+  return {this->impl_->ref(i).sketch(), this->impl_->hash_function()};
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr auto distinct_count_estimator_array<T, Scope, Hash, Allocator>::hash_function()
+  const noexcept
+{
+  return this->impl_->hash_function();
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr std::size_t distinct_count_estimator_array<T, Scope, Hash, Allocator>::num_sketches()
+  const noexcept
+{
+  return this->impl_->num_sketches();
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr std::size_t distinct_count_estimator_array<T, Scope, Hash, Allocator>::sketch_bytes()
+  const noexcept
+{
+  return this->impl_->sketch_bytes();
+}
+
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+constexpr cuda::std::span<std::byte>
+distinct_count_estimator_array<T, Scope, Hash, Allocator>::sketches() const noexcept
+{
+  return this->impl_->sketches();
+}
+
+}  // namespace cuco
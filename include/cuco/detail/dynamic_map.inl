@@ -16,12 +16,17 @@
 
 namespace cuco {
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
-dynamic_map<Key, Value, Scope, Allocator>::dynamic_map(std::size_t initial_capacity,
-                                                       empty_key<Key> empty_key_sentinel,
-                                                       empty_value<Value> empty_value_sentinel,
-                                                       Allocator const& alloc,
-                                                       cudaStream_t stream)
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::dynamic_map(
+  std::size_t initial_capacity,
+  empty_key<Key> empty_key_sentinel,
+  empty_value<Value> empty_value_sentinel,
+  Allocator const& alloc,
+  cudaStream_t stream)
   : empty_key_sentinel_(empty_key_sentinel.value),
     empty_value_sentinel_(empty_value_sentinel.value),
     erased_key_sentinel_(empty_key_sentinel.value),
@@ -42,13 +47,18 @@ dynamic_map<Key, Value, Scope, Allocator>::dynamic_map(std::size_t initial_capac
   submap_num_successes_.push_back(submaps_[0]->num_successes_);
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
-dynamic_map<Key, Value, Scope, Allocator>::dynamic_map(std::size_t initial_capacity,
-                                                       empty_key<Key> empty_key_sentinel,
-                                                       empty_value<Value> empty_value_sentinel,
-                                                       erased_key<Key> erased_key_sentinel,
-                                                       Allocator const& alloc,
-                                                       cudaStream_t stream)
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::dynamic_map(
+  std::size_t initial_capacity,
+  empty_key<Key> empty_key_sentinel,
+  empty_value<Value> empty_value_sentinel,
+  erased_key<Key> erased_key_sentinel,
+  Allocator const& alloc,
+  cudaStream_t stream)
   : empty_key_sentinel_(empty_key_sentinel.value),
     empty_value_sentinel_(empty_value_sentinel.value),
     erased_key_sentinel_(erased_key_sentinel.value),
@@ -74,8 +84,88 @@ dynamic_map<Key, Value, Scope, Allocator>::dynamic_map(std::size_t initial_capac
   submap_num_successes_.push_back(submaps_[0]->num_successes_);
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
-void dynamic_map<Key, Value, Scope, Allocator>::reserve(std::size_t n, cudaStream_t stream)
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+bool dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::try_add_device_submap(
+  std::size_t submap_capacity, cudaStream_t stream)
+{
+  if (device_exhausted_ or get_device_capacity() + submap_capacity > device_capacity_limit_) {
+    return false;
+  }
+
+  try {
+    if (erased_key_sentinel_ != empty_key_sentinel_) {
+      submaps_.push_back(std::make_unique<cuco::legacy::static_map<Key, Value, Scope, Allocator>>(
+        submap_capacity,
+        empty_key<Key>{empty_key_sentinel_},
+        empty_value<Value>{empty_value_sentinel_},
+        erased_key<Key>{erased_key_sentinel_},
+        alloc_,
+        stream));
+    } else {
+      submaps_.push_back(std::make_unique<cuco::legacy::static_map<Key, Value, Scope, Allocator>>(
+        submap_capacity,
+        empty_key<Key>{empty_key_sentinel_},
+        empty_value<Value>{empty_value_sentinel_},
+        alloc_,
+        stream));
+    }
+  } catch (cuco::cuda_error const&) {
+    // device memory is exhausted; route all future growth to the overflow tier
+    device_exhausted_ = true;
+    return false;
+  } catch (std::bad_alloc const&) {
+    device_exhausted_ = true;
+    return false;
+  }
+
+  submap_num_successes_.push_back(submaps_.back()->num_successes_);
+  submap_views_.push_back(submaps_.back()->get_device_view());
+  submap_mutable_views_.push_back(submaps_.back()->get_device_mutable_view());
+  return true;
+}
+
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::add_overflow_submap(
+  std::size_t submap_capacity, cudaStream_t stream)
+{
+  using overflow_map_type = cuco::legacy::static_map<Key, Value, Scope, OverflowAllocator>;
+
+  if (erased_key_sentinel_ != empty_key_sentinel_) {
+    overflow_submaps_.push_back(
+      std::make_unique<overflow_map_type>(submap_capacity,
+                                          empty_key<Key>{empty_key_sentinel_},
+                                          empty_value<Value>{empty_value_sentinel_},
+                                          erased_key<Key>{erased_key_sentinel_},
+                                          overflow_alloc_,
+                                          stream));
+  } else {
+    overflow_submaps_.push_back(
+      std::make_unique<overflow_map_type>(submap_capacity,
+                                          empty_key<Key>{empty_key_sentinel_},
+                                          empty_value<Value>{empty_value_sentinel_},
+                                          overflow_alloc_,
+                                          stream));
+  }
+  overflow_submap_num_successes_.push_back(overflow_submaps_.back()->num_successes_);
+  overflow_submap_views_.push_back(overflow_submaps_.back()->get_device_view());
+  overflow_submap_mutable_views_.push_back(overflow_submaps_.back()->get_device_mutable_view());
+}
+
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::reserve(std::size_t n,
+                                                                           cudaStream_t stream)
 {
   int64_t num_elements_remaining = n;
   uint32_t submap_idx            = 0;
@@ -83,31 +173,18 @@ void dynamic_map<Key, Value, Scope, Allocator>::reserve(std::size_t n, cudaStrea
     std::size_t submap_capacity;
 
     // if the submap already exists
-    if (submap_idx < submaps_.size()) {
-      submap_capacity = submaps_[submap_idx]->get_capacity();
+    if (submap_idx < submaps_.size() + overflow_submaps_.size()) {
+      submap_capacity = submap_idx < submaps_.size()
+                          ? submaps_[submap_idx]->get_capacity()
+                          : overflow_submaps_[submap_idx - submaps_.size()]->get_capacity();
     }
-    // if the submap does not exist yet, create it
+    // if the submap does not exist yet, create it, preferring device storage and spilling to the
+    // overflow tier once the device tier cannot grow any further
     else {
       submap_capacity = capacity_;
-      if (erased_key_sentinel_ != empty_key_sentinel_) {
-        submaps_.push_back(std::make_unique<cuco::legacy::static_map<Key, Value, Scope, Allocator>>(
-          submap_capacity,
-          empty_key<Key>{empty_key_sentinel_},
-          empty_value<Value>{empty_value_sentinel_},
-          erased_key<Key>{erased_key_sentinel_},
-          alloc_,
-          stream));
-      } else {
-        submaps_.push_back(std::make_unique<cuco::legacy::static_map<Key, Value, Scope, Allocator>>(
-          submap_capacity,
-          empty_key<Key>{empty_key_sentinel_},
-          empty_value<Value>{empty_value_sentinel_},
-          alloc_,
-          stream));
+      if (not try_add_device_submap(submap_capacity, stream)) {
+        add_overflow_submap(submap_capacity, stream);
       }
-      submap_num_successes_.push_back(submaps_[submap_idx]->num_successes_);
-      submap_views_.push_back(submaps_[submap_idx]->get_device_view());
-      submap_mutable_views_.push_back(submaps_[submap_idx]->get_device_mutable_view());
       capacity_ *= 2;
     }
 
@@ -116,9 +193,13 @@ void dynamic_map<Key, Value, Scope, Allocator>::reserve(std::size_t n, cudaStrea
   }
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
 template <typename InputIt, typename Hash, typename KeyEqual>
-void dynamic_map<Key, Value, Scope, Allocator>::insert(
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::insert(
   InputIt first, InputIt last, Hash hash, KeyEqual key_equal, cudaStream_t stream)
 {
   // TODO: memset an atomic variable is unsafe
@@ -133,48 +214,253 @@ void dynamic_map<Key, Value, Scope, Allocator>::insert(
 
   reserve(size_ + num_to_insert, stream);
 
+  // the logical submap sequence is the device-resident submaps followed by the overflow-tier
+  // submaps; a key is inserted into a submap only if it is absent from both tiers
   uint32_t submap_idx = 0;
   while (num_to_insert > 0) {
-    std::size_t capacity_remaining =
-      max_load_factor_ * submaps_[submap_idx]->get_capacity() - submaps_[submap_idx]->get_size();
+    bool const is_device_submap = submap_idx < submaps_.size();
+    std::size_t capacity_remaining;
+    atomic_ctr_type* num_successes;
+    if (is_device_submap) {
+      capacity_remaining =
+        max_load_factor_ * submaps_[submap_idx]->get_capacity() - submaps_[submap_idx]->get_size();
+      num_successes = submap_num_successes_[submap_idx];
+    } else {
+      auto const overflow_idx = submap_idx - submaps_.size();
+      capacity_remaining      = max_load_factor_ * overflow_submaps_[overflow_idx]->get_capacity() -
+                           overflow_submaps_[overflow_idx]->get_size();
+      num_successes = overflow_submap_num_successes_[overflow_idx];
+    }
     // If we are tying to insert some of the remaining keys into this submap, we can insert
     // only if we meet the minimum insert size.
     if (capacity_remaining >= min_insert_size_) {
-      CUCO_CUDA_TRY(
-        cudaMemsetAsync(submap_num_successes_[submap_idx], 0, sizeof(atomic_ctr_type), stream));
+      CUCO_CUDA_TRY(cudaMemsetAsync(num_successes, 0, sizeof(atomic_ctr_type), stream));
 
       auto const n         = std::min(capacity_remaining, num_to_insert);
       auto const grid_size = (tile_size * n + stride * block_size - 1) / (stride * block_size);
 
-      detail::insert<block_size, tile_size, cuco::pair<key_type, mapped_type>>
-        <<<grid_size, block_size, 0, stream>>>(first,
-                                               first + n,
-                                               submap_views_.data().get(),
-                                               submap_mutable_views_.data().get(),
-                                               submap_num_successes_.data().get(),
-                                               submap_idx,
-                                               submaps_.size(),
-                                               hash,
-                                               key_equal);
+      if (is_device_submap) {
+        detail::insert_with_secondary<block_size, tile_size, cuco::pair<key_type, mapped_type>>
+          <<<grid_size, block_size, 0, stream>>>(first,
+                                                 first + n,
+                                                 submap_views_.data().get(),
+                                                 submap_mutable_views_.data().get(),
+                                                 submap_num_successes_.data().get(),
+                                                 submap_idx,
+                                                 submaps_.size(),
+                                                 overflow_submap_views_.data().get(),
+                                                 overflow_submaps_.size(),
+                                                 hash,
+                                                 key_equal);
+      } else {
+        detail::insert_with_secondary<block_size, tile_size, cuco::pair<key_type, mapped_type>>
+          <<<grid_size, block_size, 0, stream>>>(first,
+                                                 first + n,
+                                                 overflow_submap_views_.data().get(),
+                                                 overflow_submap_mutable_views_.data().get(),
+                                                 overflow_submap_num_successes_.data().get(),
+                                                 submap_idx - submaps_.size(),
+                                                 overflow_submaps_.size(),
+                                                 submap_views_.data().get(),
+                                                 submaps_.size(),
+                                                 hash,
+                                                 key_equal);
+      }
 
       std::size_t h_num_successes;
-      CUCO_CUDA_TRY(cudaMemcpyAsync(&h_num_successes,
-                                    submap_num_successes_[submap_idx],
-                                    sizeof(atomic_ctr_type),
-                                    cudaMemcpyDeviceToHost,
-                                    stream));
-      submaps_[submap_idx]->size_ += h_num_successes;
+      CUCO_CUDA_TRY(cudaMemcpyAsync(
+        &h_num_successes, num_successes, sizeof(atomic_ctr_type), cudaMemcpyDeviceToHost, stream));
+      if (is_device_submap) {
+        submaps_[submap_idx]->size_ += h_num_successes;
+      } else {
+        overflow_submaps_[submap_idx - submaps_.size()]->size_ += h_num_successes;
+      }
       size_ += h_num_successes;
       first += n;
       num_to_insert -= n;
     }
     submap_idx++;
   }
+
+  if (consolidation_threshold_ > 0 and submaps_.size() >= consolidation_threshold_) {
+    this->consolidate(hash, key_equal, stream);
+  }
+}
+
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+template <typename Hash, typename KeyEqual>
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::consolidate(
+  Hash hash, KeyEqual key_equal, cudaStream_t stream)
+{
+  if (submaps_.size() + overflow_submaps_.size() <= 1) { return; }
+
+  // gather the contents of all submaps; `retrieve_all` returns erased slots as well, so size the
+  // buffers for the worst case and filter the erased key sentinel afterwards
+  thrust::device_vector<key_type> keys(capacity_);
+  thrust::device_vector<mapped_type> values(capacity_);
+  auto keys_it   = keys.begin();
+  auto values_it = values.begin();
+  for (auto const& submap : submaps_) {
+    auto const ends = submap->retrieve_all(keys_it, values_it, stream);
+    keys_it         = ends.first;
+    values_it       = ends.second;
+  }
+  for (auto const& submap : overflow_submaps_) {
+    auto const ends = submap->retrieve_all(keys_it, values_it, stream);
+    keys_it         = ends.first;
+    values_it       = ends.second;
+  }
+  auto num_retrieved = thrust::distance(keys.begin(), keys_it);
+
+  auto pairs_begin = thrust::make_zip_iterator(thrust::make_tuple(keys.begin(), values.begin()));
+  if (erased_key_sentinel_ != empty_key_sentinel_) {
+    using namespace thrust::placeholders;
+    auto const pairs_end = thrust::remove_if(thrust::cuda::par.on(stream),
+                                             pairs_begin,
+                                             pairs_begin + num_retrieved,
+                                             keys.begin(),
+                                             _1 == erased_key_sentinel_);
+    num_retrieved        = thrust::distance(pairs_begin, pairs_end);
+  }
+
+  // right-size the consolidated submap so all elements fit below the maximum load factor while
+  // leaving room for the minimum insert size
+  std::size_t new_capacity = submaps_.front()->get_capacity();
+  while (max_load_factor_ * new_capacity - min_insert_size_ < static_cast<float>(size_)) {
+    new_capacity *= 2;
+  }
+
+  submaps_.clear();
+  submap_views_.clear();
+  submap_mutable_views_.clear();
+  submap_num_successes_.clear();
+  overflow_submaps_.clear();
+  overflow_submap_views_.clear();
+  overflow_submap_mutable_views_.clear();
+  overflow_submap_num_successes_.clear();
+
+  // the previous submap storage has been released, so retry device allocation even if it has
+  // failed before
+  device_exhausted_ = false;
+  if (not try_add_device_submap(new_capacity, stream)) {
+    add_overflow_submap(new_capacity, stream);
+  }
+  capacity_ = new_capacity;
+
+  // re-insert all elements through the regular bulk-insert path
+  size_ = 0;
+  this->insert(pairs_begin, pairs_begin + num_retrieved, hash, key_equal, stream);
+  CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
 template <typename InputIt, typename Hash, typename KeyEqual>
-void dynamic_map<Key, Value, Scope, Allocator>::erase(
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::promote(
+  InputIt first, InputIt last, Hash hash, KeyEqual key_equal, cudaStream_t stream)
+{
+  CUCO_EXPECTS(erased_key_sentinel_ != empty_key_sentinel_,
+               "You must provide a unique erased key sentinel value at map construction.",
+               std::runtime_error);
+
+  std::size_t const num_keys = std::distance(first, last);
+  if (num_keys == 0 or overflow_submaps_.empty()) { return; }
+
+  // nothing to promote into if the device tier can neither accept inserts nor grow
+  bool device_has_room = false;
+  for (auto const& submap : submaps_) {
+    if (max_load_factor_ * submap->get_capacity() - submap->get_size() >= min_insert_size_) {
+      device_has_room = true;
+      break;
+    }
+  }
+  if (not device_has_room and
+      (device_exhausted_ or get_device_capacity() >= device_capacity_limit_)) {
+    return;
+  }
+
+  auto constexpr block_size = 128;
+  auto constexpr stride     = 1;
+  auto constexpr tile_size  = 4;
+
+  // look the keys up in the overflow tier only
+  thrust::device_vector<mapped_type> d_values(num_keys);
+  auto const grid_size = (tile_size * num_keys + stride * block_size - 1) / (stride * block_size);
+  detail::find<block_size, tile_size, Value>
+    <<<grid_size, block_size, 0, stream>>>(first,
+                                           last,
+                                           d_values.begin(),
+                                           overflow_submap_views_.data().get(),
+                                           overflow_submaps_.size(),
+                                           hash,
+                                           key_equal);
+
+  // gather the key/value pairs that reside in the overflow tier
+  thrust::device_vector<key_type> d_hit_keys(num_keys);
+  thrust::device_vector<mapped_type> d_hit_values(num_keys);
+  auto hits_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(d_hit_keys.begin(), d_hit_values.begin()));
+  using namespace thrust::placeholders;
+  auto const hits_end =
+    thrust::copy_if(thrust::cuda::par.on(stream),
+                    thrust::make_zip_iterator(thrust::make_tuple(first, d_values.begin())),
+                    thrust::make_zip_iterator(thrust::make_tuple(last, d_values.end())),
+                    d_values.begin(),
+                    hits_begin,
+                    _1 != empty_value_sentinel_);
+  auto const num_hits = thrust::distance(hits_begin, hits_end);
+  if (num_hits == 0) { return; }
+
+  // remove the promoted entries from the overflow tier
+  for (uint32_t i = 0; i < overflow_submaps_.size(); ++i) {
+    CUCO_CUDA_TRY(
+      cudaMemsetAsync(overflow_submap_num_successes_[i], 0, sizeof(atomic_ctr_type), stream));
+  }
+
+  auto const temp_storage_size = overflow_submaps_.size() * sizeof(unsigned long long);
+  auto const erase_grid_size =
+    (tile_size * num_hits + stride * block_size - 1) / (stride * block_size);
+
+  detail::erase<block_size, tile_size>
+    <<<erase_grid_size, block_size, temp_storage_size, stream>>>(
+      d_hit_keys.begin(),
+      d_hit_keys.begin() + num_hits,
+      overflow_submap_mutable_views_.data().get(),
+      overflow_submap_num_successes_.data().get(),
+      overflow_submaps_.size(),
+      hash,
+      key_equal);
+
+  for (uint32_t i = 0; i < overflow_submaps_.size(); ++i) {
+    std::size_t h_num_successes;
+    CUCO_CUDA_TRY(cudaMemcpyAsync(&h_num_successes,
+                                  overflow_submap_num_successes_[i],
+                                  sizeof(atomic_ctr_type),
+                                  cudaMemcpyDeviceToHost,
+                                  stream));
+    overflow_submaps_[i]->size_ -= h_num_successes;
+    size_ -= h_num_successes;
+  }
+
+  // reinsert through the regular bulk-insert path, which fills device submaps first
+  this->insert(hits_begin, hits_begin + num_hits, hash, key_equal, stream);
+  CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+}
+
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
+template <typename InputIt, typename Hash, typename KeyEqual>
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::erase(
   InputIt first, InputIt last, Hash hash, KeyEqual key_equal, cudaStream_t stream)
 {
   // TODO: memset an atomic variable is unsafe
@@ -214,16 +500,51 @@ void dynamic_map<Key, Value, Scope, Allocator>::erase(
     submaps_[i]->size_ -= h_submap_num_successes;
     size_ -= h_submap_num_successes;
   }
+
+  // keys erased from the device tier above are simply not found here
+  if (not overflow_submaps_.empty()) {
+    for (uint32_t i = 0; i < overflow_submaps_.size(); ++i) {
+      CUCO_CUDA_TRY(
+        cudaMemsetAsync(overflow_submap_num_successes_[i], 0, sizeof(atomic_ctr_type), stream));
+    }
+
+    auto const overflow_temp_storage_size = overflow_submaps_.size() * sizeof(unsigned long long);
+
+    detail::erase<block_size, tile_size>
+      <<<grid_size, block_size, overflow_temp_storage_size, stream>>>(
+        first,
+        first + num_keys,
+        overflow_submap_mutable_views_.data().get(),
+        overflow_submap_num_successes_.data().get(),
+        overflow_submaps_.size(),
+        hash,
+        key_equal);
+
+    for (uint32_t i = 0; i < overflow_submaps_.size(); ++i) {
+      std::size_t h_submap_num_successes;
+      CUCO_CUDA_TRY(cudaMemcpyAsync(&h_submap_num_successes,
+                                    overflow_submap_num_successes_[i],
+                                    sizeof(atomic_ctr_type),
+                                    cudaMemcpyDeviceToHost,
+                                    stream));
+      overflow_submaps_[i]->size_ -= h_submap_num_successes;
+      size_ -= h_submap_num_successes;
+    }
+  }
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
 template <typename InputIt, typename OutputIt, typename Hash, typename KeyEqual>
-void dynamic_map<Key, Value, Scope, Allocator>::find(InputIt first,
-                                                     InputIt last,
-                                                     OutputIt output_begin,
-                                                     Hash hash,
-                                                     KeyEqual key_equal,
-                                                     cudaStream_t stream)
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::find(InputIt first,
+                                                                        InputIt last,
+                                                                        OutputIt output_begin,
+                                                                        Hash hash,
+                                                                        KeyEqual key_equal,
+                                                                        cudaStream_t stream)
 {
   auto constexpr block_size = 128;
   auto constexpr stride     = 1;
@@ -234,17 +555,51 @@ void dynamic_map<Key, Value, Scope, Allocator>::find(InputIt first,
 
   detail::find<block_size, tile_size, Value><<<grid_size, block_size, 0, stream>>>(
     first, last, output_begin, submap_views_.data().get(), submaps_.size(), hash, key_equal);
+
+  // batch the keys missing from the device tier against the overflow-tier submaps
+  if (not overflow_submaps_.empty()) {
+    using namespace thrust::placeholders;
+    thrust::device_vector<std::size_t> d_miss_indices(num_keys);
+    auto const miss_indices_end = thrust::copy_if(thrust::cuda::par.on(stream),
+                                                  thrust::counting_iterator<std::size_t>(0),
+                                                  thrust::counting_iterator<std::size_t>(num_keys),
+                                                  output_begin,
+                                                  d_miss_indices.begin(),
+                                                  _1 == empty_value_sentinel_);
+    auto const num_misses = thrust::distance(d_miss_indices.begin(), miss_indices_end);
+
+    if (num_misses > 0) {
+      auto const miss_keys = thrust::make_permutation_iterator(first, d_miss_indices.begin());
+      auto const miss_outputs =
+        thrust::make_permutation_iterator(output_begin, d_miss_indices.begin());
+      auto const overflow_grid_size =
+        (tile_size * num_misses + stride * block_size - 1) / (stride * block_size);
+
+      detail::find<block_size, tile_size, Value>
+        <<<overflow_grid_size, block_size, 0, stream>>>(miss_keys,
+                                                        miss_keys + num_misses,
+                                                        miss_outputs,
+                                                        overflow_submap_views_.data().get(),
+                                                        overflow_submaps_.size(),
+                                                        hash,
+                                                        key_equal);
+    }
+  }
   CUCO_CUDA_TRY(cudaDeviceSynchronize());
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
 template <typename InputIt, typename OutputIt, typename Hash, typename KeyEqual>
-void dynamic_map<Key, Value, Scope, Allocator>::contains(InputIt first,
-                                                         InputIt last,
-                                                         OutputIt output_begin,
-                                                         Hash hash,
-                                                         KeyEqual key_equal,
-                                                         cudaStream_t stream)
+void dynamic_map<Key, Value, Scope, Allocator, OverflowAllocator>::contains(InputIt first,
+                                                                            InputIt last,
+                                                                            OutputIt output_begin,
+                                                                            Hash hash,
+                                                                            KeyEqual key_equal,
+                                                                            cudaStream_t stream)
 {
   auto constexpr block_size = 128;
   auto constexpr stride     = 1;
@@ -255,6 +610,36 @@ void dynamic_map<Key, Value, Scope, Allocator>::contains(InputIt first,
 
   detail::contains<block_size, tile_size><<<grid_size, block_size, 0, stream>>>(
     first, last, output_begin, submap_views_.data().get(), submaps_.size(), hash, key_equal);
+
+  // batch the keys missing from the device tier against the overflow-tier submaps
+  if (not overflow_submaps_.empty()) {
+    using namespace thrust::placeholders;
+    thrust::device_vector<std::size_t> d_miss_indices(num_keys);
+    auto const miss_indices_end = thrust::copy_if(thrust::cuda::par.on(stream),
+                                                  thrust::counting_iterator<std::size_t>(0),
+                                                  thrust::counting_iterator<std::size_t>(num_keys),
+                                                  output_begin,
+                                                  d_miss_indices.begin(),
+                                                  _1 == false);
+    auto const num_misses = thrust::distance(d_miss_indices.begin(), miss_indices_end);
+
+    if (num_misses > 0) {
+      auto const miss_keys = thrust::make_permutation_iterator(first, d_miss_indices.begin());
+      auto const miss_outputs =
+        thrust::make_permutation_iterator(output_begin, d_miss_indices.begin());
+      auto const overflow_grid_size =
+        (tile_size * num_misses + stride * block_size - 1) / (stride * block_size);
+
+      detail::contains<block_size, tile_size>
+        <<<overflow_grid_size, block_size, 0, stream>>>(miss_keys,
+                                                        miss_keys + num_misses,
+                                                        miss_outputs,
+                                                        overflow_submap_views_.data().get(),
+                                                        overflow_submaps_.size(),
+                                                        hash,
+                                                        key_equal);
+    }
+  }
   CUCO_CUDA_TRY(cudaDeviceSynchronize());
 }
 
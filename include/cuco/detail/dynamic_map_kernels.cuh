@@ -195,6 +195,108 @@ CUCO_KERNEL void insert(InputIt first,
   }
 }
 
+/**
+ * @brief Inserts all key/value pairs in the range `[first, last)` while also checking a secondary
+ * array of submaps for duplicates.
+ *
+ * Behaves like the Cooperative Groups `insert` kernel, but additionally probes the submaps in
+ * `secondary_submap_views` before inserting a key. This is used by the hybrid `dynamic_map` whose
+ * device-resident and host-resident submaps are of different view types and therefore live in two
+ * separate arrays: a key is inserted into `submap_mutable_views[insert_idx]` only if it is absent
+ * from both tiers.
+ *
+ * @tparam block_size
+ * @tparam tile_size The number of threads in the Cooperative Groups used to perform
+ * inserts
+ * @tparam pair_type Type of the pairs contained in the map
+ * @tparam InputIt Device accessible input iterator whose `value_type` is
+ * convertible to the map's `value_type`
+ * @tparam viewT Type of the `static_map` device views of the tier inserted into
+ * @tparam mutableViewT Type of the `static_map` device mutable views of the tier inserted into
+ * @tparam secondaryViewT Type of the `static_map` device views of the other tier
+ * @tparam atomicT Type of atomic storage
+ * @tparam Hash Unary callable type
+ * @tparam KeyEqual Binary callable type
+ *
+ * @param first Beginning of the sequence of key/value pairs
+ * @param last End of the sequence of key/value pairs
+ * @param submap_views Array of `static_map::device_view` objects used to
+ * perform `contains` operations on each underlying `static_map` of the tier inserted into
+ * @param submap_mutable_views Array of `static_map::device_mutable_view` objects
+ * used to perform an `insert` into the target `static_map` submap
+ * @param submap_num_successes The number of successfully inserted key/value pairs for each submap
+ * @param insert_idx The index of the submap we are inserting into
+ * @param num_submaps The total number of submaps in the tier inserted into
+ * @param secondary_submap_views Array of `static_map::device_view` objects of the other tier,
+ * all of which are checked for duplicates
+ * @param num_secondary_submaps The total number of submaps in the other tier
+ * @param hash The unary function to apply to hash each key
+ * @param key_equal The binary function used to compare two keys for equality
+ */
+template <uint32_t block_size,
+          uint32_t tile_size,
+          typename pair_type,
+          typename InputIt,
+          typename viewT,
+          typename mutableViewT,
+          typename secondaryViewT,
+          typename atomicT,
+          typename Hash,
+          typename KeyEqual>
+CUCO_KERNEL void insert_with_secondary(InputIt first,
+                                       InputIt last,
+                                       viewT* submap_views,
+                                       mutableViewT* submap_mutable_views,
+                                       atomicT** submap_num_successes,
+                                       uint32_t insert_idx,
+                                       uint32_t num_submaps,
+                                       secondaryViewT* secondary_submap_views,
+                                       uint32_t num_secondary_submaps,
+                                       Hash hash,
+                                       KeyEqual key_equal)
+{
+  using BlockReduce = cub::BlockReduce<std::size_t, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  std::size_t thread_num_successes = 0;
+
+  auto tile = cg::tiled_partition<tile_size>(cg::this_thread_block());
+  auto tid  = blockDim.x * blockIdx.x + threadIdx.x;
+  auto it   = first + tid / tile_size;
+
+  while (it < last) {
+    pair_type insert_pair = *it;
+    auto exists           = false;
+
+    // manually check for duplicates in those submaps we are not inserting into
+    for (auto i = 0; i < num_submaps; ++i) {
+      if (i != insert_idx) {
+        exists = submap_views[i].contains(tile, insert_pair.first, hash, key_equal);
+        if (exists) { break; }
+      }
+    }
+    if (!exists) {
+      for (auto i = 0; i < num_secondary_submaps; ++i) {
+        exists = secondary_submap_views[i].contains(tile, insert_pair.first, hash, key_equal);
+        if (exists) { break; }
+      }
+    }
+    if (!exists) {
+      if (submap_mutable_views[insert_idx].insert(tile, insert_pair, hash, key_equal) &&
+          tile.thread_rank() == 0) {
+        thread_num_successes++;
+      }
+    }
+
+    it += (gridDim.x * blockDim.x) / tile_size;
+  }
+
+  std::size_t const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+  if (threadIdx.x == 0) {
+    submap_num_successes[insert_idx]->fetch_add(block_num_successes,
+                                                cuda::std::memory_order_relaxed);
+  }
+}
+
 /**
  * @brief Erases the key/value pairs corresponding to all keys in the range `[first, last)`.
  *
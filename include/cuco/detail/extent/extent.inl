@@ -75,12 +75,94 @@ struct window_extent<SizeType, dynamic_extent> : cuco::utility::fast_int<SizeTyp
   friend auto constexpr make_window_extent(extent<SizeType_, N_> ext);
 };
 
+template <typename SizeType, std::size_t N>
+struct power_of_two_window_extent {
+  using value_type = SizeType;  ///< Extent value type
+
+  __host__ __device__ constexpr value_type value() const noexcept { return N; }
+  __host__ __device__ explicit constexpr operator value_type() const noexcept { return value(); }
+
+ private:
+  __host__ __device__ explicit constexpr power_of_two_window_extent() noexcept {}
+  __host__ __device__ explicit constexpr power_of_two_window_extent(SizeType) noexcept {}
+
+  template <int32_t CGSize_, int32_t WindowSize_, typename SizeType_, std::size_t N_>
+  friend auto constexpr make_window_extent(power_of_two_extent<SizeType_, N_> ext);
+
+  template <typename Rhs>
+  friend __host__ __device__ constexpr value_type operator-(power_of_two_window_extent const& lhs,
+                                                            Rhs rhs) noexcept
+  {
+    return lhs.value() - rhs;
+  }
+
+  template <typename Rhs>
+  friend __host__ __device__ constexpr value_type operator/(power_of_two_window_extent const& lhs,
+                                                            Rhs rhs) noexcept
+  {
+    return lhs.value() / rhs;
+  }
+
+  template <typename Lhs>
+  friend __host__ __device__ constexpr value_type operator%(
+    Lhs lhs, power_of_two_window_extent const& rhs) noexcept
+  {
+    return lhs & (rhs.value() - 1);
+  }
+};
+
+template <typename SizeType>
+struct power_of_two_window_extent<SizeType, dynamic_extent> {
+  using value_type = SizeType;  ///< Extent value type
+
+  __host__ __device__ constexpr value_type value() const noexcept { return value_; }
+  __host__ __device__ explicit constexpr operator value_type() const noexcept { return value(); }
+
+ private:
+  __host__ __device__ explicit constexpr power_of_two_window_extent(SizeType size) noexcept
+    : value_{size}
+  {
+  }
+
+  template <int32_t CGSize_, int32_t WindowSize_, typename SizeType_, std::size_t N_>
+  friend auto constexpr make_window_extent(power_of_two_extent<SizeType_, N_> ext);
+
+  template <typename Rhs>
+  friend __host__ __device__ constexpr value_type operator-(power_of_two_window_extent const& lhs,
+                                                            Rhs rhs) noexcept
+  {
+    return lhs.value() - rhs;
+  }
+
+  template <typename Rhs>
+  friend __host__ __device__ constexpr value_type operator/(power_of_two_window_extent const& lhs,
+                                                            Rhs rhs) noexcept
+  {
+    return lhs.value() / rhs;
+  }
+
+  template <typename Lhs>
+  friend __host__ __device__ constexpr value_type operator%(
+    Lhs lhs, power_of_two_window_extent const& rhs) noexcept
+  {
+    return lhs & (rhs.value() - 1);
+  }
+
+  value_type value_;  ///< Extent value
+};
+
 template <typename Container, typename SizeType, std::size_t N>
 [[nodiscard]] auto constexpr make_window_extent(extent<SizeType, N> ext)
 {
   return make_window_extent<Container::cg_size, Container::window_size>(ext);
 }
 
+template <typename Container, typename SizeType, std::size_t N>
+[[nodiscard]] auto constexpr make_window_extent(power_of_two_extent<SizeType, N> ext)
+{
+  return make_window_extent<Container::cg_size, Container::window_size>(ext);
+}
+
 template <typename Container, typename SizeType>
 [[nodiscard]] auto constexpr make_window_extent(SizeType size)
 {
@@ -115,6 +197,29 @@ template <int32_t CGSize, int32_t WindowSize, typename SizeType, std::size_t N>
   }
 }
 
+template <int32_t CGSize, int32_t WindowSize, typename SizeType, std::size_t N>
+[[nodiscard]] auto constexpr make_window_extent(power_of_two_extent<SizeType, N> ext)
+{
+  auto constexpr max_value = std::numeric_limits<SizeType>::max() / 2 + 1;  // largest power of two
+  auto const size          = cuco::detail::int_div_ceil(
+    std::max(static_cast<SizeType>(ext), static_cast<SizeType>(1)), CGSize * WindowSize);
+  if (size > max_value / CGSize) { CUCO_FAIL("Invalid input extent"); }
+
+  if constexpr (N == dynamic_extent) {
+    return power_of_two_window_extent<SizeType>{
+      static_cast<SizeType>(cuco::detail::next_power_of_two(size) * CGSize)};
+  }
+  if constexpr (N != dynamic_extent) {
+    return power_of_two_window_extent<SizeType,
+                                      static_cast<std::size_t>(
+                                        cuco::detail::next_power_of_two(
+                                          cuco::detail::int_div_ceil(
+                                            std::max(N, std::size_t{1}),
+                                            static_cast<std::size_t>(CGSize * WindowSize))) *
+                                        CGSize)>{};
+  }
+}
+
 template <int32_t CGSize, int32_t WindowSize, typename SizeType>
 [[nodiscard]] auto constexpr make_window_extent(SizeType size)
 {
@@ -129,8 +234,20 @@ struct is_window_extent : std::false_type {};
 template <typename SizeType, std::size_t N>
 struct is_window_extent<window_extent<SizeType, N>> : std::true_type {};
 
+template <typename SizeType, std::size_t N>
+struct is_window_extent<power_of_two_window_extent<SizeType, N>> : std::true_type {};
+
 template <typename T>
 inline constexpr bool is_window_extent_v = is_window_extent<T>::value;
 
+template <typename...>
+struct is_power_of_two_window_extent : std::false_type {};
+
+template <typename SizeType, std::size_t N>
+struct is_power_of_two_window_extent<power_of_two_window_extent<SizeType, N>> : std::true_type {};
+
+template <typename T>
+inline constexpr bool is_power_of_two_window_extent_v = is_power_of_two_window_extent<T>::value;
+
 }  // namespace detail
 }  // namespace cuco
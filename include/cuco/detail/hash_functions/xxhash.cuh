@@ -16,9 +16,13 @@
 
 #pragma once
 
+#include <cuco/detail/__config>
 #include <cuco/detail/hash_functions/utils.cuh>
 #include <cuco/extent.cuh>
 
+#include <cooperative_groups.h>
+#include <cooperative_groups/reduce.h>
+
 #include <cstddef>
 #include <cstdint>
 
@@ -380,4 +384,454 @@ struct XXHash_64 {
   std::uint64_t seed_;
 };
 
+/**
+ * @brief A 64-bit `XXH3` hash function to hash the given argument on host and device.
+ *
+ * Compared to `XXHash_64`, `XXH3` is significantly faster on medium-sized and large keys since its
+ * mixing rounds consume 16 input bytes at a time and are mutually independent.
+ *
+ * XXH3_64 implementation from
+ * https://github.com/Cyan4973/xxHash
+ * -----------------------------------------------------------------------------
+ * xxHash - Extremely Fast Hash algorithm
+ * Header File
+ * Copyright (C) 2012-2021 Yann Collet
+ *
+ * BSD 2-Clause License (https://www.opensource.org/licenses/bsd-license.php)
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are
+ * met:
+ *
+ *    * Redistributions of source code must retain the above copyright
+ *      notice, this list of conditions and the following disclaimer.
+ *    * Redistributions in binary form must reproduce the above
+ *      copyright notice, this list of conditions and the following disclaimer
+ *      in the documentation and/or other materials provided with the
+ *      distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+ * "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+ * LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+ * A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+ * OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+ * SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+ * LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+ * DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+ * THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+ * OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ *
+ * You can contact the author at:
+ *   - xxHash homepage: https://www.xxhash.com
+ *   - xxHash source repository: https://github.com/Cyan4973/xxHash
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+struct XXH3_64 {
+ private:
+  static constexpr std::uint32_t prime32_1 = 0x9e3779b1u;
+  static constexpr std::uint32_t prime32_2 = 0x85ebca77u;
+  static constexpr std::uint32_t prime32_3 = 0xc2b2ae3du;
+  static constexpr std::uint64_t prime64_1 = 0x9e3779b185ebca87ull;
+  static constexpr std::uint64_t prime64_2 = 0xc2b2ae3d27d4eb4full;
+  static constexpr std::uint64_t prime64_3 = 0x165667b19e3779f9ull;
+  static constexpr std::uint64_t prime64_4 = 0x85ebca77c2b2ae63ull;
+  static constexpr std::uint64_t prime64_5 = 0x27d4eb2f165667c5ull;
+  static constexpr std::uint64_t prime_mx1 = 0x165667919e3779f9ull;
+  static constexpr std::uint64_t prime_mx2 = 0x9fb21c651e98df25ull;
+
+  static constexpr std::size_t secret_size           = 192;
+  static constexpr std::size_t stripe_length         = 64;
+  static constexpr std::size_t num_stripes_per_block = (secret_size - stripe_length) / 8;
+  static constexpr std::size_t block_length          = stripe_length * num_stripes_per_block;
+  static constexpr std::size_t midsize_start_offset  = 3;
+  static constexpr std::size_t midsize_last_offset   = 17;
+  static constexpr std::size_t secret_size_min       = 136;
+
+  // default pseudorandom secret taken verbatim from the reference implementation
+  static constexpr std::uint8_t secret[secret_size] = {
+    0xb8, 0xfe, 0x6c, 0x39, 0x23, 0xa4, 0x4b, 0xbe, 0x7c, 0x01, 0x81, 0x2c, 0xf7, 0x21, 0xad, 0x1c,
+    0xde, 0xd4, 0x6d, 0xe9, 0x83, 0x90, 0x97, 0xdb, 0x72, 0x40, 0xa4, 0xa4, 0xb7, 0xb3, 0x67, 0x1f,
+    0xcb, 0x79, 0xe6, 0x4e, 0xcc, 0xc0, 0xe5, 0x78, 0x82, 0x5a, 0xd0, 0x7d, 0xcc, 0xff, 0x72, 0x21,
+    0xb8, 0x08, 0x46, 0x74, 0xf7, 0x43, 0x24, 0x8e, 0xe0, 0x35, 0x90, 0xe6, 0x81, 0x3a, 0x26, 0x4c,
+    0x3c, 0x28, 0x52, 0xbb, 0x91, 0xc3, 0x00, 0xcb, 0x88, 0xd0, 0x65, 0x8b, 0x1b, 0x53, 0x2e, 0xa3,
+    0x71, 0x64, 0x48, 0x97, 0xa2, 0x0d, 0xf9, 0x4e, 0x38, 0x19, 0xef, 0x46, 0xa9, 0xde, 0xac, 0xd8,
+    0xa8, 0xfa, 0x76, 0x3f, 0xe3, 0x9c, 0x34, 0x3f, 0xf9, 0xdc, 0xbb, 0xc7, 0xc7, 0x0b, 0x4f, 0x1d,
+    0x8a, 0x51, 0xe0, 0x4b, 0xcd, 0xb4, 0x59, 0x31, 0xc8, 0x9f, 0x7e, 0xc9, 0xd9, 0x78, 0x73, 0x64,
+    0xea, 0xc5, 0xac, 0x83, 0x34, 0xd3, 0xeb, 0xc3, 0xc5, 0x81, 0xa0, 0xff, 0xfa, 0x13, 0x63, 0xeb,
+    0x17, 0x0d, 0xdd, 0x51, 0xb7, 0xf0, 0xda, 0x49, 0xd3, 0x16, 0x55, 0x26, 0x29, 0xd4, 0x68, 0x9e,
+    0x2b, 0x16, 0xbe, 0x58, 0x7d, 0x47, 0xa1, 0xfc, 0x8f, 0xf8, 0xb8, 0xd1, 0x7a, 0xd0, 0x31, 0xce,
+    0x45, 0xcb, 0x3a, 0x8f, 0x95, 0x16, 0x04, 0x28, 0xaf, 0xd7, 0xfb, 0xca, 0xbb, 0x4b, 0x40, 0x7e};
+
+  // 16-byte input chunk; loading it in one piece enables 128-bit vectorized loads
+  struct alignas(16) chunk128 {
+    std::uint64_t low;   ///< Low 8 bytes of the chunk
+    std::uint64_t high;  ///< High 8 bytes of the chunk
+  };
+
+ public:
+  using argument_type = Key;            ///< The type of the values taken as argument
+  using result_type   = std::uint64_t;  ///< The type of the hash values produced
+
+  /**
+   * @brief Constructs a XXH3 hash function with the given `seed`.
+   *
+   * @param seed A custom number to randomize the resulting hash value
+   */
+  __host__ __device__ constexpr XXH3_64(std::uint64_t seed = 0) : seed_{seed} {}
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  constexpr result_type __host__ __device__ operator()(Key const& key) const noexcept
+  {
+    if constexpr (sizeof(Key) <= 16) {
+      Key const key_copy = key;
+      return compute_hash(reinterpret_cast<std::byte const*>(&key_copy),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    } else {
+      return compute_hash(reinterpret_cast<std::byte const*>(&key),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    }
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, computed cooperatively by all threads of the
+   * given group.
+   *
+   * The mixing rounds of the key are distributed over the group's threads, matching how probing
+   * groups with `cg_size > 1` already cooperate on probing. Every thread returns the same hash
+   * value as the single-threaded overload.
+   *
+   * @tparam CG Cooperative group type
+   *
+   * @param group The group used to cooperatively compute the hash value
+   * @param key The input argument to hash
+   * @return The resulting hash value for `key`
+   */
+  template <class CG>
+  __device__ result_type operator()(CG const& group, Key const& key) const noexcept
+  {
+    if constexpr (sizeof(Key) <= 16) {
+      Key const key_copy = key;
+      return compute_hash(reinterpret_cast<std::byte const*>(&key_copy),
+                          cuco::extent<std::size_t, sizeof(Key)>{});
+    } else {
+      return compute_hash_cooperative(group,
+                                      reinterpret_cast<std::byte const*>(&key),
+                                      cuco::extent<std::size_t, sizeof(Key)>{});
+    }
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, as a value of type `result_type`.
+   *
+   * @tparam Extent The extent type
+   *
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <typename Extent>
+  constexpr result_type __host__ __device__ compute_hash(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    if (size <= 16) { return hash_0to16(bytes, size); }
+    if (size <= 128) { return hash_17to128(bytes, size); }
+    if (size <= 240) { return hash_129to240(bytes, size); }
+    return hash_long(bytes, size);
+  }
+
+  /**
+   * @brief Returns a hash value for its argument, computed cooperatively by all threads of the
+   * given group.
+   *
+   * @tparam CG Cooperative group type
+   * @tparam Extent The extent type
+   *
+   * @param group The group used to cooperatively compute the hash value
+   * @param bytes The input argument to hash
+   * @param size The extent of the data in bytes
+   * @return The resulting hash value
+   */
+  template <class CG, typename Extent>
+  __device__ result_type compute_hash_cooperative(CG const& group,
+                                                  std::byte const* bytes,
+                                                  Extent size) const noexcept
+  {
+    if (size <= 16) { return hash_0to16(bytes, size); }
+    if (size <= 128) {
+      // the mixing rounds are mutually independent modular additions, so distributing them over
+      // the group's threads yields the exact same value as the sequential loop
+      std::uint64_t partial  = 0;
+      auto const num_pairs   = (size + 31) / 32;
+      for (std::size_t i = group.thread_rank(); i < num_pairs; i += group.size()) {
+        partial += mix16(bytes + 16 * i, secret + 32 * i);
+        partial += mix16(bytes + size - 16 * (i + 1), secret + 32 * i + 16);
+      }
+      auto const acc =
+        size * prime64_1 +
+        cooperative_groups::reduce(group, partial, cooperative_groups::plus<std::uint64_t>());
+      return avalanche(acc);
+    }
+    if (size <= 240) {
+      std::uint64_t partial = 0;
+      for (std::size_t i = group.thread_rank(); i < 8; i += group.size()) {
+        partial += mix16(bytes + 16 * i, secret + 16 * i);
+      }
+      auto acc = avalanche(
+        size * prime64_1 +
+        cooperative_groups::reduce(group, partial, cooperative_groups::plus<std::uint64_t>()));
+
+      auto const num_rounds = size / 16;
+      std::uint64_t tail    = (group.thread_rank() == 0)
+                                ? mix16(bytes + size - 16, secret + secret_size_min - midsize_last_offset)
+                                : 0;
+      for (std::size_t i = 8 + group.thread_rank(); i < num_rounds; i += group.size()) {
+        tail += mix16(bytes + 16 * i, secret + 16 * (i - 8) + midsize_start_offset);
+      }
+      acc += cooperative_groups::reduce(group, tail, cooperative_groups::plus<std::uint64_t>());
+      return avalanche(acc);
+    }
+    // long inputs are dominated by the strictly sequential stripe accumulation, so every thread
+    // computes the full hash on its own
+    return compute_hash(bytes, size);
+  }
+
+ private:
+  /**
+   * @brief Hashes inputs of at most 16 bytes.
+   */
+  template <typename Extent>
+  constexpr __host__ __device__ result_type hash_0to16(std::byte const* bytes,
+                                                       Extent size) const noexcept
+  {
+    if (size >= 9) {
+      auto const bitflip1 = (load_chunk<std::uint64_t>(secret + 24, 0) ^
+                             load_chunk<std::uint64_t>(secret + 32, 0)) +
+                            seed_;
+      auto const bitflip2 = (load_chunk<std::uint64_t>(secret + 40, 0) ^
+                             load_chunk<std::uint64_t>(secret + 48, 0)) -
+                            seed_;
+      auto const input_lo = load_chunk<std::uint64_t>(bytes, 0) ^ bitflip1;
+      auto const input_hi = load_chunk<std::uint64_t>(bytes + size - 8, 0) ^ bitflip2;
+      auto const acc =
+        size + byteswap64(input_lo) + input_hi + mul128_fold64(input_lo, input_hi);
+      return avalanche(acc);
+    }
+    if (size >= 4) {
+      auto seed = seed_;
+      seed ^= static_cast<std::uint64_t>(byteswap32(static_cast<std::uint32_t>(seed))) << 32;
+      auto const input1  = load_chunk<std::uint32_t>(bytes, 0);
+      auto const input2  = load_chunk<std::uint32_t>(bytes + size - 4, 0);
+      auto const bitflip = (load_chunk<std::uint64_t>(secret + 8, 0) ^
+                            load_chunk<std::uint64_t>(secret + 16, 0)) -
+                           seed;
+      auto const keyed = (input2 + (static_cast<std::uint64_t>(input1) << 32)) ^ bitflip;
+      return rrmxmx(keyed, size);
+    }
+    if (size > 0) {
+      auto const c1       = std::to_integer<std::uint32_t>(bytes[0]);
+      auto const c2       = std::to_integer<std::uint32_t>(bytes[size >> 1]);
+      auto const c3       = std::to_integer<std::uint32_t>(bytes[size - 1]);
+      auto const combined = (c1 << 16) | (c2 << 24) | c3 | (static_cast<std::uint32_t>(size) << 8);
+      auto const bitflip  = (load_chunk<std::uint32_t>(secret, 0) ^
+                            load_chunk<std::uint32_t>(secret + 4, 0)) +
+                           seed_;
+      return avalanche64(static_cast<std::uint64_t>(combined) ^ bitflip);
+    }
+    return avalanche64(seed_ ^ load_chunk<std::uint64_t>(secret + 56, 0) ^
+                       load_chunk<std::uint64_t>(secret + 64, 0));
+  }
+
+  /**
+   * @brief Hashes inputs of 17 to 128 bytes.
+   */
+  template <typename Extent>
+  constexpr __host__ __device__ result_type hash_17to128(std::byte const* bytes,
+                                                         Extent size) const noexcept
+  {
+    std::uint64_t acc    = size * prime64_1;
+    auto const num_pairs = (size + 31) / 32;
+    for (std::size_t i = 0; i < num_pairs; ++i) {
+      acc += mix16(bytes + 16 * i, secret + 32 * i);
+      acc += mix16(bytes + size - 16 * (i + 1), secret + 32 * i + 16);
+    }
+    return avalanche(acc);
+  }
+
+  /**
+   * @brief Hashes inputs of 129 to 240 bytes.
+   */
+  template <typename Extent>
+  constexpr __host__ __device__ result_type hash_129to240(std::byte const* bytes,
+                                                          Extent size) const noexcept
+  {
+    std::uint64_t acc = size * prime64_1;
+    for (std::size_t i = 0; i < 8; ++i) {
+      acc += mix16(bytes + 16 * i, secret + 16 * i);
+    }
+    acc = avalanche(acc);
+
+    auto const num_rounds = size / 16;
+    for (std::size_t i = 8; i < num_rounds; ++i) {
+      acc += mix16(bytes + 16 * i, secret + 16 * (i - 8) + midsize_start_offset);
+    }
+    acc += mix16(bytes + size - 16, secret + secret_size_min - midsize_last_offset);
+    return avalanche(acc);
+  }
+
+  /**
+   * @brief Hashes inputs of more than 240 bytes.
+   */
+  template <typename Extent>
+  constexpr __host__ __device__ result_type hash_long(std::byte const* bytes,
+                                                      Extent size) const noexcept
+  {
+    if (seed_ == 0) { return hash_long_with_secret(bytes, size, secret); }
+
+    // non-zero seeds require mixing the seed into a custom secret
+    std::uint8_t custom[secret_size] = {};
+    for (std::size_t i = 0; i < secret_size / 16; ++i) {
+      auto const low  = load_chunk<std::uint64_t>(secret + 16 * i, 0) + seed_;
+      auto const high = load_chunk<std::uint64_t>(secret + 16 * i + 8, 0) - seed_;
+      memcpy(custom + 16 * i, &low, 8);
+      memcpy(custom + 16 * i + 8, &high, 8);
+    }
+    return hash_long_with_secret(bytes, size, custom);
+  }
+
+  template <typename Extent>
+  constexpr __host__ __device__ result_type hash_long_with_secret(
+    std::byte const* bytes, Extent size, std::uint8_t const* sec) const noexcept
+  {
+    std::uint64_t acc[8] = {
+      prime32_3, prime64_1, prime64_2, prime64_3, prime64_4, prime32_2, prime64_5, prime32_1};
+
+    auto const num_blocks = (size - 1) / block_length;
+    for (std::size_t block = 0; block < num_blocks; ++block) {
+      for (std::size_t stripe = 0; stripe < num_stripes_per_block; ++stripe) {
+        accumulate_stripe(
+          acc, bytes + block * block_length + stripe * stripe_length, sec + 8 * stripe);
+      }
+      scramble(acc, sec + secret_size - stripe_length);
+    }
+
+    auto const num_stripes = ((size - 1) - block_length * num_blocks) / stripe_length;
+    for (std::size_t stripe = 0; stripe < num_stripes; ++stripe) {
+      accumulate_stripe(
+        acc, bytes + num_blocks * block_length + stripe * stripe_length, sec + 8 * stripe);
+    }
+    accumulate_stripe(acc, bytes + size - stripe_length, sec + secret_size - stripe_length - 7);
+
+    std::uint64_t result = size * prime64_1;
+    for (std::size_t i = 0; i < 4; ++i) {
+      result += mul128_fold64(acc[2 * i] ^ load_chunk<std::uint64_t>(sec + 11 + 16 * i, 0),
+                              acc[2 * i + 1] ^ load_chunk<std::uint64_t>(sec + 11 + 16 * i + 8, 0));
+    }
+    return avalanche(result);
+  }
+
+  // processes one 64-byte stripe as four 16-byte chunks
+  static constexpr __host__ __device__ void accumulate_stripe(std::uint64_t* acc,
+                                                              std::byte const* input,
+                                                              std::uint8_t const* sec) noexcept
+  {
+    for (std::size_t i = 0; i < stripe_length / 16; ++i) {
+      auto const chunk    = load_chunk<chunk128>(input + 16 * i, 0);
+      auto const key_low  = chunk.low ^ load_chunk<std::uint64_t>(sec + 16 * i, 0);
+      auto const key_high = chunk.high ^ load_chunk<std::uint64_t>(sec + 16 * i + 8, 0);
+      acc[(2 * i) ^ 1] += chunk.low;
+      acc[2 * i] += (key_low & 0xffffffffull) * (key_low >> 32);
+      acc[(2 * i + 1) ^ 1] += chunk.high;
+      acc[2 * i + 1] += (key_high & 0xffffffffull) * (key_high >> 32);
+    }
+  }
+
+  static constexpr __host__ __device__ void scramble(std::uint64_t* acc,
+                                                     std::uint8_t const* sec) noexcept
+  {
+    for (std::size_t i = 0; i < 8; ++i) {
+      acc[i] = (acc[i] ^ (acc[i] >> 47) ^ load_chunk<std::uint64_t>(sec + 8 * i, 0)) * prime32_1;
+    }
+  }
+
+  // mixes one 16-byte input chunk with the given secret material
+  constexpr __host__ __device__ std::uint64_t mix16(std::byte const* input,
+                                                    std::uint8_t const* sec) const noexcept
+  {
+    auto const chunk = load_chunk<chunk128>(input, 0);
+    return mul128_fold64(chunk.low ^ (load_chunk<std::uint64_t>(sec, 0) + seed_),
+                         chunk.high ^ (load_chunk<std::uint64_t>(sec + 8, 0) - seed_));
+  }
+
+  static constexpr __host__ __device__ std::uint64_t mul128_fold64(std::uint64_t lhs,
+                                                                   std::uint64_t rhs) noexcept
+  {
+#if defined(CUCO_HAS_INT128)
+    auto const product = static_cast<unsigned __int128>(lhs) * rhs;
+    return static_cast<std::uint64_t>(product) ^ static_cast<std::uint64_t>(product >> 64);
+#else
+    // portable 64x64->128-bit multiplication
+    auto const lo_lo = (lhs & 0xffffffffull) * (rhs & 0xffffffffull);
+    auto const hi_lo = (lhs >> 32) * (rhs & 0xffffffffull);
+    auto const lo_hi = (lhs & 0xffffffffull) * (rhs >> 32);
+    auto const hi_hi = (lhs >> 32) * (rhs >> 32);
+    auto const cross = (lo_lo >> 32) + (hi_lo & 0xffffffffull) + lo_hi;
+    auto const upper = (hi_lo >> 32) + (cross >> 32) + hi_hi;
+    auto const lower = (cross << 32) | (lo_lo & 0xffffffffull);
+    return lower ^ upper;
+#endif
+  }
+
+  // avalanche helper
+  static constexpr __host__ __device__ std::uint64_t avalanche(std::uint64_t h) noexcept
+  {
+    h ^= h >> 37;
+    h *= prime_mx1;
+    h ^= h >> 32;
+    return h;
+  }
+
+  // XXH64-style avalanche helper used for short inputs
+  static constexpr __host__ __device__ std::uint64_t avalanche64(std::uint64_t h) noexcept
+  {
+    h ^= h >> 33;
+    h *= prime64_2;
+    h ^= h >> 29;
+    h *= prime64_3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  static constexpr __host__ __device__ std::uint64_t rrmxmx(std::uint64_t h,
+                                                            std::uint64_t length) noexcept
+  {
+    h ^= rotl64(h, 49) ^ rotl64(h, 24);
+    h *= prime_mx2;
+    h ^= (h >> 35) + length;
+    h *= prime_mx2;
+    return h ^ (h >> 28);
+  }
+
+  static constexpr __host__ __device__ std::uint32_t byteswap32(std::uint32_t x) noexcept
+  {
+    return ((x << 24) & 0xff000000u) | ((x << 8) & 0x00ff0000u) | ((x >> 8) & 0x0000ff00u) |
+           ((x >> 24) & 0x000000ffu);
+  }
+
+  static constexpr __host__ __device__ std::uint64_t byteswap64(std::uint64_t x) noexcept
+  {
+    return (static_cast<std::uint64_t>(byteswap32(static_cast<std::uint32_t>(x))) << 32) |
+           byteswap32(static_cast<std::uint32_t>(x >> 32));
+  }
+
+  std::uint64_t seed_;
+};
+
 }  // namespace cuco::detail
@@ -257,6 +257,41 @@ class hyperloglog {
     this->ref_.merge(other_ref, stream);
   }
 
+  /**
+   * @brief Asynchronously merges a batch of contiguous sketches into `*this` estimator.
+   *
+   * @note Registers are max-reduced over all given sketches by a single tree-structured kernel,
+   * i.e., merging N sketches costs one launch instead of N.
+   *
+   * @throw If `sketches.size()` is not a multiple of `this->sketch_bytes()`
+   *
+   * @param sketches Contiguous storage holding the to-be-merged sketches; each sketch must have
+   * the same size as `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void merge_many_async(cuda::std::span<std::byte const> sketches,
+                                  cuda::stream_ref stream)
+  {
+    this->ref_.merge_many_async(sketches, stream);
+  }
+
+  /**
+   * @brief Merges a batch of contiguous sketches into `*this` estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `merge_many_async`.
+   *
+   * @throw If `sketches.size()` is not a multiple of `this->sketch_bytes()`
+   *
+   * @param sketches Contiguous storage holding the to-be-merged sketches; each sketch must have
+   * the same size as `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void merge_many(cuda::std::span<std::byte const> sketches, cuda::stream_ref stream)
+  {
+    this->ref_.merge_many(sketches, stream);
+  }
+
   /**
    * @brief Compute the estimated distinct items count.
    *
@@ -0,0 +1,338 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/hyperloglog/hyperloglog_ref.cuh>
+#include <cuco/detail/hyperloglog/kernels.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utils.hpp>
+#include <cuco/types.cuh>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <cuda/std/span>
+#include <cuda/stream_ref>
+
+#include <climits>
+#include <cstddef>
+#include <memory>
+
+namespace cuco::detail {
+/**
+ * @brief A batch of `hyperloglog` estimators sharing one contiguous storage allocation.
+ *
+ * @note This class serves grouped distinct-count workloads (`COUNT(DISTINCT x) GROUP BY k`): all
+ * sketches are updated by a single kernel launch taking (group id, item) pairs and finalized by a
+ * single kernel launch, instead of one launch per group. If the whole sketch array fits into
+ * shared memory, updates are staged in block-local sketches and merged into global memory once per
+ * block; otherwise registers are updated in global memory directly.
+ *
+ * @tparam T Type of items to count
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam Hash Hash function used to hash items
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+class hyperloglog_array {
+ public:
+  static constexpr auto thread_scope = Scope;  ///< CUDA thread scope
+
+  template <cuda::thread_scope NewScope = thread_scope>
+  using ref_type = hyperloglog_ref<T, NewScope, Hash>;  ///< Non-owning reference
+                                                        ///< type
+
+  using value_type    = typename ref_type<>::value_type;     ///< Type of items to count
+  using hasher        = typename ref_type<>::hasher;         ///< Hash function type
+  using register_type = typename ref_type<>::register_type;  ///< HLL register type
+  using allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<register_type>;  ///< Allocator
+                                                                                      ///< type
+
+  /**
+   * @brief Constructs a `hyperloglog_array` host object.
+   *
+   * @param num_sketches Number of sketches, i.e., distinct groups
+   * @param sketch_size_kb Maximum sketch size in KB (per sketch)
+   * @param hash The hash function used to hash items
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the object
+   */
+  constexpr hyperloglog_array(std::size_t num_sketches,
+                              cuco::sketch_size_kb sketch_size_kb,
+                              Hash const& hash,
+                              Allocator const& alloc,
+                              cuda::stream_ref stream)
+    : hash_{hash},
+      allocator_{alloc},
+      num_sketches_{num_sketches},
+      sketch_bytes_{ref_type<>::sketch_bytes(sketch_size_kb)},
+      sketches_{
+        this->allocator_.allocate(num_sketches * this->sketch_bytes_ / sizeof(register_type)),
+        custom_deleter{num_sketches * this->sketch_bytes_ / sizeof(register_type),
+                       this->allocator_}}
+  {
+    CUCO_EXPECTS(num_sketches > 0, "Number of sketches must be greater than zero");
+    this->clear_async(stream);
+  }
+
+  ~hyperloglog_array() = default;
+
+  hyperloglog_array(hyperloglog_array const&)            = delete;
+  hyperloglog_array& operator=(hyperloglog_array const&) = delete;
+  hyperloglog_array(hyperloglog_array&&)                 = default;  ///< Move constructor
+
+  /**
+   * @brief Copy-assignment operator.
+   *
+   * @return Copy of `*this`
+   */
+  hyperloglog_array& operator=(hyperloglog_array&&) = default;
+
+  /**
+   * @brief Asynchronously resets all estimators, i.e., clears the current count estimates.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear_async(cuda::stream_ref stream) noexcept
+  {
+    auto constexpr block_size = 1024;
+    cuco::hyperloglog_ns::detail::clear_batch<ref_type<>>
+      <<<this->num_sketches_, block_size, 0, stream.get()>>>(
+        this->sketch_data(),
+        static_cast<cuco::detail::index_type>(this->num_sketches_),
+        this->sketch_bytes_,
+        this->hash_);
+  }
+
+  /**
+   * @brief Resets all estimators, i.e., clears the current count estimates.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `clear_async`.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear(cuda::stream_ref stream)
+  {
+    this->clear_async(stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Asynchronously adds to be counted (group id, item) pairs to the estimators.
+   *
+   * @note Behavior is undefined if a group id is `>= num_sketches()`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   * @tparam GroupIt Device accessible random access input iterator whose `value_type` is
+   * convertible to `std::size_t`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param group_first Beginning of the sequence of group ids
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt, class GroupIt>
+  constexpr void add_async(InputIt first, InputIt last, GroupIt group_first, cuda::stream_ref stream)
+  {
+    auto const num_items = cuco::detail::distance(first, last);
+    if (num_items == 0) { return; }
+
+    auto const total_sketch_bytes = this->num_sketches_ * this->sketch_bytes_;
+    auto const kernel             = reinterpret_cast<void const*>(
+      cuco::hyperloglog_ns::detail::add_batch_shmem<InputIt, GroupIt, ref_type<>>);
+
+    if (total_sketch_bytes <= static_cast<std::size_t>(INT_MAX) and
+        this->try_reserve_shmem(kernel, static_cast<int>(total_sketch_bytes))) {
+      int grid_size  = 0;
+      int block_size = 0;
+      CUCO_CUDA_TRY(cudaOccupancyMaxPotentialBlockSize(
+        &grid_size, &block_size, kernel, static_cast<int>(total_sketch_bytes)));
+
+      cuco::hyperloglog_ns::detail::add_batch_shmem<InputIt, GroupIt, ref_type<>>
+        <<<grid_size, block_size, total_sketch_bytes, stream.get()>>>(
+          first,
+          group_first,
+          num_items,
+          this->sketch_data(),
+          static_cast<cuco::detail::index_type>(this->num_sketches_),
+          this->sketch_bytes_,
+          this->hash_);
+    } else {
+      // Updates registers directly in global memory. (Fallback path in case there is not enough
+      // shared memory available to stage the whole sketch array)
+      auto const grid_size = cuco::detail::grid_size(num_items);
+      cuco::hyperloglog_ns::detail::add_batch_gmem<InputIt, GroupIt, ref_type<>>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first, group_first, num_items, this->sketch_data(), this->sketch_bytes_, this->hash_);
+    }
+  }
+
+  /**
+   * @brief Adds to be counted (group id, item) pairs to the estimators.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `add_async`.
+   *
+   * @note Behavior is undefined if a group id is `>= num_sketches()`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   * @tparam GroupIt Device accessible random access input iterator whose `value_type` is
+   * convertible to `std::size_t`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param group_first Beginning of the sequence of group ids
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt, class GroupIt>
+  constexpr void add(InputIt first, InputIt last, GroupIt group_first, cuda::stream_ref stream)
+  {
+    this->add_async(first, last, group_first, stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Asynchronously computes the estimated distinct items counts of all sketches.
+   *
+   * @param cardinalities Device-accessible pointer to an array of `num_sketches()` elements the
+   * estimates are written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void estimate_async(std::size_t* cardinalities, cuda::stream_ref stream) const noexcept
+  {
+    auto constexpr block_size = 1024;
+    cuco::hyperloglog_ns::detail::estimate_batch<ref_type<>>
+      <<<this->num_sketches_, block_size, 0, stream.get()>>>(
+        this->sketch_data(),
+        static_cast<cuco::detail::index_type>(this->num_sketches_),
+        this->sketch_bytes_,
+        this->hash_,
+        cardinalities);
+  }
+
+  /**
+   * @brief Computes the estimated distinct items counts of all sketches.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `estimate_async`.
+   *
+   * @param cardinalities Device-accessible pointer to an array of `num_sketches()` elements the
+   * estimates are written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void estimate(std::size_t* cardinalities, cuda::stream_ref stream) const
+  {
+    this->estimate_async(cardinalities, stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Get device ref of the sketch at position `i`.
+   *
+   * @param i Sketch index
+   *
+   * @return Device ref object of the `i`-th sketch
+   */
+  [[nodiscard]] constexpr ref_type<> ref(std::size_t i) const noexcept
+  {
+    return ref_type<>{
+      cuda::std::span<std::byte>{this->sketch_data() + i * this->sketch_bytes_,
+                                 this->sketch_bytes_},
+      this->hash_};
+  }
+
+  /**
+   * @brief Get hash function.
+   *
+   * @return The hash function
+   */
+  [[nodiscard]] constexpr auto hash_function() const noexcept { return this->hash_; }
+
+  /**
+   * @brief Gets the number of sketches.
+   *
+   * @return The number of sketches
+   */
+  [[nodiscard]] constexpr std::size_t num_sketches() const noexcept { return this->num_sketches_; }
+
+  /**
+   * @brief Gets the number of bytes required for a single sketch.
+   *
+   * @return The number of bytes required for a single sketch
+   */
+  [[nodiscard]] constexpr std::size_t sketch_bytes() const noexcept { return this->sketch_bytes_; }
+
+  /**
+   * @brief Gets the span of the contiguous sketch storage.
+   *
+   * @return The cuda::std::span over all sketches
+   */
+  [[nodiscard]] constexpr cuda::std::span<std::byte> sketches() const noexcept
+  {
+    return cuda::std::span<std::byte>{this->sketch_data(),
+                                      this->num_sketches_ * this->sketch_bytes_};
+  }
+
+ private:
+  /**
+   * @brief Gets the base pointer of the sketch storage.
+   *
+   * @return Pointer to the first byte of the first sketch
+   */
+  [[nodiscard]] constexpr std::byte* sketch_data() const noexcept
+  {
+    return reinterpret_cast<std::byte*>(this->sketches_.get());
+  }
+
+  /**
+   * @brief Try expanding the shmem partition for a given kernel beyond 48KB if necessary.
+   *
+   * @param kernel The kernel function
+   * @param shmem_bytes Number of requested dynamic shared memory bytes
+   *
+   * @returns True iff kernel configuration is succesful
+   */
+  [[nodiscard]] constexpr bool try_reserve_shmem(void const* kernel, int shmem_bytes) const
+  {
+    int device = -1;
+    CUCO_CUDA_TRY(cudaGetDevice(&device));
+    int max_shmem_bytes = 0;
+    CUCO_CUDA_TRY(
+      cudaDeviceGetAttribute(&max_shmem_bytes, cudaDevAttrMaxSharedMemoryPerBlockOptin, device));
+
+    if (shmem_bytes <= max_shmem_bytes) {
+      CUCO_CUDA_TRY(
+        cudaFuncSetAttribute(kernel, cudaFuncAttributeMaxDynamicSharedMemorySize, shmem_bytes));
+      return true;
+    } else {
+      return false;
+    }
+  }
+
+  hasher hash_;                ///< Hash function used to hash items
+  allocator_type allocator_;   ///< Storage allocator
+  std::size_t num_sketches_;   ///< Number of sketches
+  std::size_t sketch_bytes_;   ///< Size of a single sketch in bytes
+  std::unique_ptr<register_type, custom_deleter<std::size_t, allocator_type>>
+    sketches_;  ///< Sketch storage
+};
+}  // namespace cuco::detail
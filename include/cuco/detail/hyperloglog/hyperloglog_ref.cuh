@@ -19,6 +19,7 @@
 #include <cuco/detail/error.hpp>
 #include <cuco/detail/hyperloglog/finalizer.cuh>
 #include <cuco/detail/hyperloglog/kernels.cuh>
+#include <cuco/detail/utility/math.hpp>
 #include <cuco/detail/utils.hpp>
 #include <cuco/hash_functions.cuh>
 #include <cuco/types.cuh>
@@ -336,6 +337,57 @@ class hyperloglog_ref {
     stream.wait();
   }
 
+  /**
+   * @brief Asynchronously merges a batch of contiguous sketches into `*this` estimator.
+   *
+   * @note Registers are max-reduced over all given sketches by a single tree-structured kernel,
+   * i.e., merging N sketches costs one launch instead of N.
+   *
+   * @throw If `sketches.size()` is not a multiple of `this->sketch_bytes()`
+   *
+   * @param sketches Contiguous storage holding the to-be-merged sketches; each sketch must have
+   * the same size as `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  __host__ constexpr void merge_many_async(cuda::std::span<std::byte const> sketches,
+                                           cuda::stream_ref stream)
+  {
+    CUCO_EXPECTS(sketches.size() % this->sketch_bytes() == 0,
+                 "Sketch storage size must be a multiple of this estimator's sketch size",
+                 std::runtime_error);
+    auto const num_sketches = sketches.size() / this->sketch_bytes();
+    if (num_sketches == 0) { return; }
+
+    auto constexpr block_size = 256;
+    auto const num_registers  = this->sketch_bytes() / sizeof(register_type);
+    dim3 const grid_size(cuco::detail::int_div_ceil(num_registers, block_size),
+                         std::min(num_sketches, std::size_t{128}));
+    cuco::hyperloglog_ns::detail::merge_batch<<<grid_size, block_size, 0, stream.get()>>>(
+      sketches.data(),
+      static_cast<cuco::detail::index_type>(num_sketches),
+      this->sketch_bytes(),
+      *this);
+  }
+
+  /**
+   * @brief Merges a batch of contiguous sketches into `*this` estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `merge_many_async`.
+   *
+   * @throw If `sketches.size()` is not a multiple of `this->sketch_bytes()`
+   *
+   * @param sketches Contiguous storage holding the to-be-merged sketches; each sketch must have
+   * the same size as `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  __host__ constexpr void merge_many(cuda::std::span<std::byte const> sketches,
+                                     cuda::stream_ref stream)
+  {
+    this->merge_many_async(sketches, stream);
+    stream.wait();
+  }
+
   /**
    * @brief Compute the estimated distinct items count.
    *
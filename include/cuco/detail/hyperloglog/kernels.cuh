@@ -18,7 +18,9 @@
 #include <cuco/detail/utility/cuda.cuh>
 #include <cuco/utility/cuda_thread_scope.cuh>
 
+#include <cuda/atomic>
 #include <cuda/std/array>
+#include <cuda/std/bit>
 #include <cuda/std/span>
 
 #include <cooperative_groups.h>
@@ -132,6 +134,163 @@ CUCO_KERNEL void merge(OtherRefType other_ref, RefType ref)
   if (block.group_index().x == 0) { ref.merge(block, other_ref); }
 }
 
+template <class InputIt, class GroupIt, class RefType>
+CUCO_KERNEL void add_batch_gmem(InputIt first,
+                                GroupIt group_first,
+                                cuco::detail::index_type n,
+                                std::byte* sketches,
+                                std::size_t sketch_bytes,
+                                typename RefType::hasher hash)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    auto const group = static_cast<std::size_t>(*(group_first + idx));
+    RefType ref{cuda::std::span<std::byte>{sketches + group * sketch_bytes, sketch_bytes}, hash};
+    ref.add(*(first + idx));
+    idx += loop_stride;
+  }
+}
+
+template <class InputIt, class GroupIt, class RefType>
+CUCO_KERNEL void add_batch_shmem(InputIt first,
+                                 GroupIt group_first,
+                                 cuco::detail::index_type n,
+                                 std::byte* sketches,
+                                 cuco::detail::index_type num_sketches,
+                                 std::size_t sketch_bytes,
+                                 typename RefType::hasher hash)
+{
+  using local_ref_type = typename RefType::with_scope<cuda::thread_scope_block>;
+
+  // Base address of dynamic shared memory is guaranteed to be aligned to at least 16 bytes which is
+  // sufficient for this purpose
+  extern __shared__ std::byte local_sketches[];
+
+  auto const block = cooperative_groups::this_thread_block();
+
+  for (cuco::detail::index_type s = 0; s < num_sketches; ++s) {
+    local_ref_type local_ref(cuda::std::span{local_sketches + s * sketch_bytes, sketch_bytes},
+                             hash);
+    local_ref.clear(block);
+  }
+  block.sync();
+
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+  while (idx < n) {
+    auto const group = static_cast<std::size_t>(*(group_first + idx));
+    local_ref_type local_ref{
+      cuda::std::span<std::byte>{local_sketches + group * sketch_bytes, sketch_bytes}, hash};
+    local_ref.add(*(first + idx));
+    idx += loop_stride;
+  }
+  block.sync();
+
+  for (cuco::detail::index_type s = 0; s < num_sketches; ++s) {
+    RefType ref{cuda::std::span<std::byte>{sketches + s * sketch_bytes, sketch_bytes}, hash};
+    local_ref_type local_ref{
+      cuda::std::span<std::byte>{local_sketches + s * sketch_bytes, sketch_bytes}, hash};
+    ref.merge(block, local_ref);
+  }
+}
+
+template <class RefType>
+CUCO_KERNEL void merge_batch(std::byte const* sketches,
+                             cuco::detail::index_type num_sketches,
+                             std::size_t sketch_bytes,
+                             RefType ref)
+{
+  using register_type = typename RefType::register_type;
+
+  auto const num_registers = static_cast<cuco::detail::index_type>(sketch_bytes / sizeof(register_type));
+  auto* const target       = reinterpret_cast<register_type*>(ref.sketch().data());
+
+  // two-level max-reduction tree: each thread reduces one register over a strided chunk of
+  // sketches (y-dimension) before issuing a single atomic on the target register
+  auto const register_stride = static_cast<cuco::detail::index_type>(gridDim.x) * blockDim.x;
+  for (cuco::detail::index_type r = blockIdx.x * blockDim.x + threadIdx.x; r < num_registers;
+       r += register_stride) {
+    register_type local_max{};
+    for (cuco::detail::index_type s = blockIdx.y; s < num_sketches; s += gridDim.y) {
+      auto const* const regs = reinterpret_cast<register_type const*>(sketches + s * sketch_bytes);
+      local_max              = regs[r] > local_max ? regs[r] : local_max;
+    }
+    cuda::atomic_ref<register_type, RefType::thread_scope> register_ref(target[r]);
+    register_ref.fetch_max(local_max, cuda::memory_order_relaxed);
+  }
+}
+
+template <class RefType>
+CUCO_KERNEL void clear_batch(std::byte* sketches,
+                             cuco::detail::index_type num_sketches,
+                             std::size_t sketch_bytes,
+                             typename RefType::hasher hash)
+{
+  auto const block = cooperative_groups::this_thread_block();
+
+  for (cuco::detail::index_type s = block.group_index().x; s < num_sketches; s += gridDim.x) {
+    RefType ref{cuda::std::span<std::byte>{sketches + s * sketch_bytes, sketch_bytes}, hash};
+    ref.clear(block);
+  }
+}
+
+template <class RefType>
+CUCO_KERNEL void estimate_batch(std::byte* sketches,
+                                cuco::detail::index_type num_sketches,
+                                std::size_t sketch_bytes,
+                                typename RefType::hasher hash,
+                                std::size_t* cardinalities)
+{
+  auto const block = cooperative_groups::this_thread_block();
+
+  for (cuco::detail::index_type s = block.group_index().x; s < num_sketches; s += gridDim.x) {
+    RefType ref{cuda::std::span<std::byte>{sketches + s * sketch_bytes, sketch_bytes}, hash};
+    auto const estimate = ref.estimate(block);
+    if (block.thread_rank() == 0) { cardinalities[s] = estimate; }
+  }
+}
+
+template <class InputIt, class HashValue, class Hash>
+CUCO_KERNEL void sparse_add(InputIt first,
+                            cuco::detail::index_type n,
+                            HashValue* entries,
+                            Hash hash)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    entries[idx] = hash(*(first + idx));
+    idx += loop_stride;
+  }
+}
+
+template <class HashValue, class RefType>
+CUCO_KERNEL void sparse_to_dense(HashValue const* entries, cuco::detail::index_type n, RefType ref)
+{
+  using register_type = typename RefType::register_type;
+
+  auto const num_registers = ref.sketch_bytes() / sizeof(register_type);
+  auto const register_mask = static_cast<HashValue>(num_registers - 1);
+  auto* const registers    = reinterpret_cast<register_type*>(ref.sketch().data());
+
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    // same register/rank split as `hyperloglog_ref::add`
+    auto const h      = entries[idx];
+    auto const reg    = h & register_mask;
+    auto const zeroes = cuda::std::countl_zero(h | register_mask) + 1;
+
+    cuda::atomic_ref<register_type, RefType::thread_scope> register_ref(registers[reg]);
+    register_ref.fetch_max(static_cast<register_type>(zeroes), cuda::memory_order_relaxed);
+    idx += loop_stride;
+  }
+}
+
 // TODO this kernel currently isn't being used
 template <class RefType>
 CUCO_KERNEL void estimate(std::size_t* cardinality, RefType ref)
@@ -0,0 +1,412 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/hyperloglog/finalizer.cuh>
+#include <cuco/detail/hyperloglog/hyperloglog.cuh>
+#include <cuco/detail/hyperloglog/kernels.cuh>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utils.hpp>
+#include <cuco/types.cuh>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <cuda/std/bit>
+#include <cuda/std/utility>
+#include <cuda/stream_ref>
+
+#include <algorithm>  // there is no <cuda/std/algorithm>
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cuco::detail {
+/**
+ * @brief A memory-frugal variant of `hyperloglog` for small cardinalities.
+ *
+ * @note Instead of eagerly materializing the dense register array, this class records the raw item
+ * hashes in a small append buffer (akin to the HLL++ sparse encoding). Once the buffer would
+ * overflow -- either through `add` or `merge` -- the recorded hashes are replayed into a freshly
+ * allocated dense `hyperloglog` sketch and all subsequent operations take the dense path. For
+ * estimators that never exceed the sparse capacity, device storage stays at
+ * `sparse_capacity * sizeof(hash_value_type)` bytes instead of the full dense sketch size.
+ *
+ * @tparam T Type of items to count
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam Hash Hash function used to hash items
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class T, cuda::thread_scope Scope, class Hash, class Allocator>
+class sparse_hyperloglog {
+  using dense_type = hyperloglog<T, Scope, Hash, Allocator>;  ///< Dense estimator type
+  using hash_value_type =
+    decltype(cuda::std::declval<Hash>()(cuda::std::declval<T>()));  ///< Hash value type
+  using fp_type = double;  ///< Floating point type used for host-side estimation
+
+ public:
+  static constexpr auto thread_scope = Scope;  ///< CUDA thread scope
+
+  using value_type    = typename dense_type::value_type;     ///< Type of items to count
+  using hasher        = typename dense_type::hasher;         ///< Hash function type
+  using register_type = typename dense_type::register_type;  ///< HLL register type
+  using allocator_type =
+    typename std::allocator_traits<Allocator>::template rebind_alloc<hash_value_type>;  ///< Sparse
+                                                                                        ///< buffer
+                                                                                        ///< allocator
+
+  /**
+   * @brief Constructs a `sparse_hyperloglog` host object.
+   *
+   * @param sketch_size_kb Maximum dense sketch size in KB; used once the estimator is promoted
+   * @param sparse_capacity Maximum number of items held in the sparse buffer before promotion
+   * @param hash The hash function used to hash items
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the object
+   */
+  constexpr sparse_hyperloglog(cuco::sketch_size_kb sketch_size_kb,
+                               std::size_t sparse_capacity,
+                               Hash const& hash,
+                               Allocator const& alloc,
+                               [[maybe_unused]] cuda::stream_ref stream)
+    : dense_sketch_size_kb_{sketch_size_kb},
+      hash_{hash},
+      alloc_{alloc},
+      entry_allocator_{alloc},
+      capacity_{sparse_capacity},
+      size_{0},
+      entries_{this->entry_allocator_.allocate(sparse_capacity),
+               custom_deleter{sparse_capacity, this->entry_allocator_}},
+      dense_{nullptr}
+  {
+    CUCO_EXPECTS(sparse_capacity > 0, "Sparse capacity must be greater than zero");
+  }
+
+  ~sparse_hyperloglog() = default;
+
+  sparse_hyperloglog(sparse_hyperloglog const&)            = delete;
+  sparse_hyperloglog& operator=(sparse_hyperloglog const&) = delete;
+  sparse_hyperloglog(sparse_hyperloglog&&)                 = default;  ///< Move constructor
+
+  /**
+   * @brief Copy-assignment operator.
+   *
+   * @return Copy of `*this`
+   */
+  sparse_hyperloglog& operator=(sparse_hyperloglog&&) = default;
+
+  /**
+   * @brief Asynchronously resets the estimator, i.e., clears the current count estimate.
+   *
+   * @note This function also releases the dense sketch storage if the estimator has previously
+   * been promoted, i.e., the estimator returns to sparse mode.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear_async(cuda::stream_ref stream)
+  {
+    this->size_ = 0;
+    if (this->dense_) {
+      this->dense_->clear_async(stream);
+      stream.wait();
+      this->dense_.reset();
+    }
+  }
+
+  /**
+   * @brief Resets the estimator, i.e., clears the current count estimate.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `clear_async`.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear(cuda::stream_ref stream)
+  {
+    this->clear_async(stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Asynchronously adds to be counted items to the estimator.
+   *
+   * @note If adding the given items would overflow the sparse buffer, the estimator is promoted
+   * to its dense representation first.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt>
+  constexpr void add_async(InputIt first, InputIt last, cuda::stream_ref stream)
+  {
+    auto const num_items = cuco::detail::distance(first, last);
+    if (num_items == 0) { return; }
+
+    if (not this->dense_ and
+        this->size_ + static_cast<std::size_t>(num_items) > this->capacity_) {
+      this->promote(stream);
+    }
+
+    if (this->dense_) {
+      this->dense_->add_async(first, last, stream);
+      return;
+    }
+
+    auto const grid_size = cuco::detail::grid_size(num_items);
+    cuco::hyperloglog_ns::detail::sparse_add<<<grid_size,
+                                               cuco::detail::default_block_size(),
+                                               0,
+                                               stream.get()>>>(
+      first, num_items, this->entries_.get() + this->size_, this->hash_);
+    this->size_ += num_items;
+  }
+
+  /**
+   * @brief Adds to be counted items to the estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `add_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt>
+  constexpr void add(InputIt first, InputIt last, cuda::stream_ref stream)
+  {
+    this->add_async(first, last, stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Asynchronously merges the result of `other` estimator into `*this` estimator.
+   *
+   * @note If the merged content would overflow the sparse buffer, the estimator is promoted to
+   * its dense representation first.
+   *
+   * @throw If this->dense_sketch_bytes() != other.dense_sketch_bytes()
+   *
+   * @tparam OtherScope Thread scope of `other` estimator
+   * @tparam OtherAllocator Allocator type of `other` estimator
+   *
+   * @param other Other estimator to be merged into `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <cuda::thread_scope OtherScope, class OtherAllocator>
+  constexpr void merge_async(sparse_hyperloglog<T, OtherScope, Hash, OtherAllocator> const& other,
+                             cuda::stream_ref stream)
+  {
+    CUCO_EXPECTS(this->dense_sketch_bytes() == other.dense_sketch_bytes(),
+                 "Cannot merge estimators with different dense sketch sizes",
+                 std::runtime_error);
+
+    if (other.dense_) {
+      if (not this->dense_) { this->promote(stream); }
+      this->dense_->merge_async(*(other.dense_), stream);
+      return;
+    }
+
+    if (other.size_ == 0) { return; }
+
+    if (not this->dense_) {
+      if (this->size_ + other.size_ <= this->capacity_) {
+        CUCO_CUDA_TRY(cudaMemcpyAsync(this->entries_.get() + this->size_,
+                                      other.entries_.get(),
+                                      sizeof(hash_value_type) * other.size_,
+                                      cudaMemcpyDefault,
+                                      stream.get()));
+        this->size_ += other.size_;
+        return;
+      }
+      this->promote(stream);
+    }
+
+    this->replay_async(other.entries_.get(), other.size_, stream);
+  }
+
+  /**
+   * @brief Merges the result of `other` estimator into `*this` estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `merge_async`.
+   *
+   * @throw If this->dense_sketch_bytes() != other.dense_sketch_bytes()
+   *
+   * @tparam OtherScope Thread scope of `other` estimator
+   * @tparam OtherAllocator Allocator type of `other` estimator
+   *
+   * @param other Other estimator to be merged into `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <cuda::thread_scope OtherScope, class OtherAllocator>
+  constexpr void merge(sparse_hyperloglog<T, OtherScope, Hash, OtherAllocator> const& other,
+                       cuda::stream_ref stream)
+  {
+    this->merge_async(other, stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Compute the estimated distinct items count.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream this operation is executed in
+   *
+   * @return Approximate distinct items count
+   */
+  [[nodiscard]] constexpr std::size_t estimate(cuda::stream_ref stream) const
+  {
+    if (this->dense_) { return this->dense_->estimate(stream); }
+
+    // replay the recorded hashes into a host-side dense sketch; this yields exactly the same
+    // estimate the promoted estimator would produce
+    std::vector<hash_value_type> host_entries(this->size_);
+    if (this->size_ > 0) {
+      CUCO_CUDA_TRY(cudaMemcpyAsync(host_entries.data(),
+                                    this->entries_.get(),
+                                    sizeof(hash_value_type) * this->size_,
+                                    cudaMemcpyDefault,
+                                    stream.get()));
+    }
+    stream.wait();
+
+    auto const precision =
+      cuda::std::countr_zero(this->dense_sketch_bytes() / sizeof(register_type));
+    auto const register_mask = static_cast<hash_value_type>((1ull << precision) - 1);
+
+    std::vector<register_type> host_sketch(1ull << precision);
+    for (auto const h : host_entries) {
+      auto const reg    = h & register_mask;
+      auto const zeroes = cuda::std::countl_zero(h | register_mask) + 1;
+      host_sketch[reg]  = std::max(host_sketch[reg], static_cast<register_type>(zeroes));
+    }
+
+    fp_type sum = 0;
+    int zeroes  = 0;
+    for (auto const reg : host_sketch) {
+      sum += fp_type{1} / static_cast<fp_type>(1ull << reg);
+      zeroes += reg == 0;
+    }
+
+    auto const finalize = cuco::hyperloglog_ns::detail::finalizer(precision);
+    return finalize(sum, zeroes);
+  }
+
+  /**
+   * @brief Get hash function.
+   *
+   * @return The hash function
+   */
+  [[nodiscard]] constexpr auto hash_function() const noexcept { return this->hash_; }
+
+  /**
+   * @brief Indicates whether the estimator is still in its sparse representation.
+   *
+   * @return `true` iff the estimator has not yet been promoted to its dense representation
+   */
+  [[nodiscard]] constexpr bool is_sparse() const noexcept { return this->dense_ == nullptr; }
+
+  /**
+   * @brief Gets the maximum number of items held in the sparse buffer before promotion.
+   *
+   * @return The sparse buffer capacity
+   */
+  [[nodiscard]] constexpr std::size_t sparse_capacity() const noexcept { return this->capacity_; }
+
+  /**
+   * @brief Gets the number of bytes currently occupied by the sketch storage.
+   *
+   * @return The number of bytes occupied by the sketch
+   */
+  [[nodiscard]] constexpr std::size_t sketch_bytes() const noexcept
+  {
+    return this->dense_ ? this->dense_->sketch_bytes()
+                        : this->capacity_ * sizeof(hash_value_type);
+  }
+
+  /**
+   * @brief Gets the number of bytes required for the dense sketch storage after promotion.
+   *
+   * @return The number of bytes required for the dense sketch
+   */
+  [[nodiscard]] constexpr std::size_t dense_sketch_bytes() const noexcept
+  {
+    return dense_type::sketch_bytes(this->dense_sketch_size_kb_);
+  }
+
+ private:
+  /**
+   * @brief Promotes the estimator to its dense representation.
+   *
+   * @note Allocates the dense sketch and replays all recorded hashes into it.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void promote(cuda::stream_ref stream)
+  {
+    this->dense_ = std::make_unique<dense_type>(
+      this->dense_sketch_size_kb_, this->hash_, this->alloc_, stream);
+    this->replay_async(this->entries_.get(), this->size_, stream);
+    this->size_ = 0;
+  }
+
+  /**
+   * @brief Asynchronously replays recorded hashes into the dense sketch.
+   *
+   * @param entries Device pointer to the recorded hashes
+   * @param num_entries Number of recorded hashes
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void replay_async(hash_value_type const* entries,
+                              std::size_t num_entries,
+                              cuda::stream_ref stream)
+  {
+    if (num_entries == 0) { return; }
+    auto const num = static_cast<cuco::detail::index_type>(num_entries);
+    auto const grid_size = cuco::detail::grid_size(num);
+    cuco::hyperloglog_ns::detail::sparse_to_dense<<<grid_size,
+                                                    cuco::detail::default_block_size(),
+                                                    0,
+                                                    stream.get()>>>(
+      entries, num, this->dense_->ref());
+  }
+
+  cuco::sketch_size_kb dense_sketch_size_kb_;  ///< Dense sketch size used after promotion
+  hasher hash_;                                ///< Hash function used to hash items
+  Allocator alloc_;                            ///< Allocator used for the dense sketch
+  allocator_type entry_allocator_;             ///< Sparse buffer allocator
+  std::size_t capacity_;                       ///< Sparse buffer capacity
+  std::size_t size_;                           ///< Number of recorded hashes
+  std::unique_ptr<hash_value_type, custom_deleter<std::size_t, allocator_type>>
+    entries_;                            ///< Sparse buffer storage
+  std::unique_ptr<dense_type> dense_;  ///< Dense estimator; allocated lazily on promotion
+
+  // Needs to be friends with other instantiations of this class template to have access to their
+  // storage
+  template <class T_, cuda::thread_scope Scope_, class Hash_, class Allocator_>
+  friend class sparse_hyperloglog;
+};
+}  // namespace cuco::detail
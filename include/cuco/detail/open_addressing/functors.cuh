@@ -107,4 +107,51 @@ struct slot_is_filled {
   }
 };
 
+/**
+ * @brief Device functor applying a transformation to the slot indexed by `idx` if the slot is
+ * filled, and returning the reduction identity otherwise
+ *
+ * @tparam StorageRef Storage ref type
+ * @tparam IsFilled Type of unary predicate indicating whether a slot is filled
+ * @tparam TransformOp Type of unary transform function object
+ * @tparam T Type of the transformed value
+ */
+template <typename StorageRef, typename IsFilled, typename TransformOp, typename T>
+struct transform_filled_slot {
+  StorageRef storage_;        ///< Storage ref
+  IsFilled is_filled_;        ///< Predicate indicating whether a slot is filled
+  TransformOp transform_op_;  ///< Transformation to apply to filled slots
+  T identity_;                ///< Value returned for empty and erased slots
+
+  /**
+   * @brief Constructs `transform_filled_slot` functor.
+   *
+   * @param s Input storage ref
+   * @param is_filled Predicate indicating whether a slot is filled
+   * @param transform_op Transformation to apply to filled slots
+   * @param identity Value returned for empty and erased slots
+   */
+  explicit constexpr transform_filled_slot(StorageRef s,
+                                           IsFilled is_filled,
+                                           TransformOp transform_op,
+                                           T identity) noexcept
+    : storage_{s}, is_filled_{is_filled}, transform_op_{transform_op}, identity_{identity}
+  {
+  }
+
+  /**
+   * @brief Transforms the slot content with the given index.
+   *
+   * @param idx The slot index
+   * @return The transformed slot content if the slot is filled, the identity otherwise
+   */
+  __device__ constexpr T operator()(typename StorageRef::size_type idx) const noexcept
+  {
+    auto const window_idx = idx / StorageRef::window_size;
+    auto const intra_idx  = idx % StorageRef::window_size;
+    auto const slot       = storage_[window_idx][intra_idx];
+    return is_filled_(slot) ? static_cast<T>(transform_op_(slot)) : identity_;
+  }
+};
+
 }  // namespace cuco::open_addressing_ns::detail
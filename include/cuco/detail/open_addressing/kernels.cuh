@@ -15,7 +15,11 @@
  */
 #pragma once
 
+#include <cuco/detail/__config>
+#include <cuco/detail/bitwise_compare.cuh>
 #include <cuco/detail/utility/cuda.cuh>
+#include <cuco/pair.cuh>
+#include <cuco/tagged_aow_storage.cuh>
 
 #include <cub/block/block_reduce.cuh>
 #include <cuda/atomic>
@@ -51,7 +55,10 @@ CUCO_SUPPRESS_KERNEL_WARNINGS
  * @param n Number of input elements
  * @param stencil Beginning of the stencil sequence
  * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
- * @param num_successes Number of successful inserted elements
+ * @param num_successes Number of successful inserted elements, or `nullptr` if not needed
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
  * @param ref Non-owning container device ref used to access the slot storage
  */
 template <int32_t CGSize,
@@ -66,6 +73,8 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(InputIt first,
                                                           StencilIt stencil,
                                                           Predicate pred,
                                                           AtomicT* num_successes,
+                                                          AtomicT* size_stripes,
+                                                          int32_t num_stripes,
                                                           Ref ref)
 {
   using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
@@ -93,7 +102,13 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_if_n(InputIt first,
   // and atomically add to the grand total
   auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
   if (threadIdx.x == 0) {
-    num_successes->fetch_add(block_num_successes, cuda::std::memory_order_relaxed);
+    if (num_successes != nullptr) {
+      num_successes->fetch_add(block_num_successes, cuda::std::memory_order_relaxed);
+    }
+    if (size_stripes != nullptr) {
+      size_stripes[blockIdx.x % num_stripes].fetch_add(block_num_successes,
+                                                       cuda::std::memory_order_relaxed);
+    }
   }
 }
 
@@ -182,6 +197,157 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void erase(InputIt first,
   }
 }
 
+/**
+ * @brief Erases keys in the range `[first, first + n)` and subtracts the number of successful
+ * erasures from the container-maintained striped size counters.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is
+ * convertible to the `value_type` of the data structure
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of input elements
+ * @param n Number of input elements
+ * @param size_stripes Striped size counters maintained by the container
+ * @param num_stripes Number of striped size counters
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename AtomicT, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void erase(InputIt first,
+                                                    cuco::detail::index_type n,
+                                                    AtomicT* size_stripes,
+                                                    int32_t num_stripes,
+                                                    Ref ref)
+{
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_erased = 0;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& erase_element{*(first + idx)};
+    if constexpr (CGSize == 1) {
+      if (ref.erase(erase_element)) { thread_num_erased++; }
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      if (ref.erase(tile, erase_element) && tile.thread_rank() == 0) { thread_num_erased++; }
+    }
+    idx += loop_stride;
+  }
+
+  auto const block_num_erased = BlockReduce(temp_storage).Sum(thread_num_erased);
+  if (threadIdx.x == 0) {
+    size_stripes[blockIdx.x % num_stripes].fetch_sub(block_num_erased,
+                                                     cuda::std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Erases the contents of all filled slots in the windows `[window_offset, window_offset +
+ * n)` that satisfy `pred`.
+ *
+ * @note Candidate slots are reclaimed via the regular CAS-based `erase` path, so the sweep is safe
+ * to run concurrently with readers and writers: a probed slot is observed either intact or as the
+ * erased sentinel, never in a torn state.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam IsFilled Type of predicate indicating if the given slot is filled
+ * @tparam Predicate Type of unary predicate applied to the contents of filled slots
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param window_offset Index of the first window to sweep
+ * @param n Number of windows to sweep
+ * @param is_filled Predicate indicating if the given slot is filled
+ * @param pred Predicate selecting the filled slots to evict
+ * @param num_evicted Counter incremented by the number of evicted slots, or `nullptr`
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr`
+ * @param num_stripes Number of striped size counters
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename StorageRef,
+          typename IsFilled,
+          typename Predicate,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void evict_if_n(StorageRef storage,
+                                                         typename StorageRef::size_type
+                                                           window_offset,
+                                                         cuco::detail::index_type n,
+                                                         IsFilled is_filled,
+                                                         Predicate pred,
+                                                         AtomicT* num_evicted,
+                                                         AtomicT* size_stripes,
+                                                         int32_t num_stripes,
+                                                         Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto constexpr has_payload =
+    not std::is_same_v<typename Ref::key_type, typename Ref::value_type>;
+  auto const extract_key = [](auto const& slot) {
+    if constexpr (has_payload) {
+      return slot.first;
+    } else {
+      return slot;
+    }
+  };
+
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_evicted = 0;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    auto const window_idx = window_offset + idx;
+    auto const window     = storage[window_idx];
+    if constexpr (CGSize == 1) {
+      for (auto const& slot : window) {
+        if (is_filled(slot) and pred(slot)) {
+          if (ref.erase(extract_key(slot))) { thread_num_evicted++; }
+        }
+      }
+    } else {
+      auto const tile = cg::tiled_partition<CGSize>(cg::this_thread_block());
+      for (int32_t i = 0; i < StorageRef::window_size; ++i) {
+        // rank 0 selects the candidate so that all ranks agree on the outcome even if the slot is
+        // modified concurrently
+        auto const evict = tile.shfl(is_filled(window[i]) and pred(window[i]), 0);
+        if (evict) {
+          auto const key = tile.shfl(extract_key(window[i]), 0);
+          if (ref.erase(tile, key) and tile.thread_rank() == 0) { thread_num_evicted++; }
+        }
+      }
+    }
+    idx += loop_stride;
+  }
+
+  if (num_evicted == nullptr and size_stripes == nullptr) { return; }
+
+  auto const block_num_evicted = BlockReduce(temp_storage).Sum(thread_num_evicted);
+  if (threadIdx.x == 0) {
+    if (num_evicted != nullptr) {
+      num_evicted->fetch_add(block_num_evicted, cuda::std::memory_order_relaxed);
+    }
+    if (size_stripes != nullptr) {
+      size_stripes[blockIdx.x % num_stripes].fetch_sub(block_num_evicted,
+                                                       cuda::std::memory_order_relaxed);
+    }
+  }
+}
+
 /**
  * @brief For each key in the range [first, first + n), applies the function object `callback_op` to
  * the copy of all corresponding matches found in the container.
@@ -296,6 +462,262 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void contains_if_n(InputIt first,
   }
 }
 
+#if defined(CUCO_HAS_CUDA_BARRIER)
+/**
+ * @brief Indicates whether the keys in the range `[first, first + n)` are contained in the
+ * container, software-pipelining the probe window loads.
+ *
+ * Each thread owns a double buffer of two windows in shared memory and prefetches the window of
+ * its next probing step via `cuda::memcpy_async` while comparing the current one, overlapping the
+ * global memory latency of multi-step probe chains.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputIt Device accessible output iterator assignable from `bool`
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys
+ * @param output_begin Beginning of the sequence of booleans for the presence of each key
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename OutputIt, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void contains_pipelined(InputIt first,
+                                                                 cuco::detail::index_type n,
+                                                                 OutputIt output_begin,
+                                                                 Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block       = cg::this_thread_block();
+  auto const thread_idx  = block.thread_rank();
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  __shared__ typename Ref::window_type window_buffer[2 * BlockSize];
+  auto* const buffer = window_buffer + 2 * thread_idx;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+    if constexpr (CGSize == 1) {
+      *(output_begin + idx) = ref.contains_pipelined(key, buffer);
+    } else {
+      auto const tile  = cg::tiled_partition<CGSize>(block);
+      auto const found = ref.contains_pipelined(tile, key, buffer);
+      if (tile.thread_rank() == 0) { *(output_begin + idx) = found; }
+    }
+    idx += loop_stride;
+  }
+}
+#endif  // end CUCO_HAS_CUDA_BARRIER
+
+/**
+ * @brief Indicates whether the keys in the range `[first, first + n)` are contained in the data
+ * structure if `pred` of the corresponding stencil returns true, writing the results as a packed
+ * bitmask.
+ *
+ * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff `pred( *(stencil + i) )` is
+ * true and the key `*(first + i)` is present in the container. Each warp produces one fully
+ * assembled output word via ballot, so the kernel writes one 32-bit word per 32 keys instead of 32
+ * booleans. Trailing bits of the last word (past `n`) are zero.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam StencilIt Device accessible random access iterator whose value_type is
+ * convertible to Predicate's argument type
+ * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool`
+ * and argument type is convertible from `std::iterator_traits<StencilIt>::value_type`
+ * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys
+ * @param stencil Beginning of the stencil sequence
+ * @param pred Predicate to test on every element in the range `[stencil, stencil + n)`
+ * @param output_begin Beginning of the sequence of `(n + 31) / 32` bitmask words
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename StencilIt,
+          typename Predicate,
+          typename OutputIt,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void contains_bitmask_if_n(InputIt first,
+                                                                    cuco::detail::index_type n,
+                                                                    StencilIt stencil,
+                                                                    Predicate pred,
+                                                                    OutputIt output_begin,
+                                                                    Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  constexpr int32_t word_bits      = 32;
+  constexpr int32_t tiles_per_word = word_bits / CGSize;
+
+  auto const block     = cg::this_thread_block();
+  auto const warp      = cg::tiled_partition<word_bits>(block);
+  auto const num_words = (n + word_bits - 1) / word_bits;
+
+  auto const loop_stride = cuco::detail::grid_stride() / word_bits;
+  auto word_idx          = cuco::detail::global_thread_id() / word_bits;
+
+  while (word_idx < num_words) {
+    auto const base = word_idx * word_bits;
+    uint32_t word   = 0;
+    if constexpr (CGSize == 1) {
+      auto const idx = base + warp.thread_rank();
+      bool found     = false;
+      if (idx < n) {
+        typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+        found = pred(*(stencil + idx)) ? ref.contains(key) : false;
+      }
+      word = warp.ballot(found);
+    } else {
+      // each tile probes one key per phase; the warp covers the full 32-key window after `CGSize`
+      // phases, compacting the per-tile ballot bits into consecutive positions of the output word
+      auto const tile         = cg::tiled_partition<CGSize>(block);
+      auto const tile_in_warp = warp.thread_rank() / CGSize;
+      for (int32_t phase = 0; phase < CGSize; ++phase) {
+        auto const offset = phase * tiles_per_word + tile_in_warp;
+        auto const idx    = base + offset;
+        bool found        = false;
+        if (idx < n) {
+          typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+          found = pred(*(stencil + idx)) ? ref.contains(tile, key) : false;
+        }
+        auto const ballot = warp.ballot(found and tile.thread_rank() == 0);
+        for (int32_t t = 0; t < tiles_per_word; ++t) {
+          word |= ((ballot >> (t * CGSize)) & 1u) << (phase * tiles_per_word + t);
+        }
+      }
+    }
+    if (warp.thread_rank() == 0) { *(output_begin + word_idx) = word; }
+    word_idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Inserts all elements in the range `[first, first + *n_ptr)`.
+ *
+ * @note The actual number of input elements is read from device memory so that the kernel can be
+ * recorded into a CUDA graph once with a fixed maximum batch size and replayed with varying batch
+ * sizes.
+ * @note If multiple elements in `[first, first + *n_ptr)` compare equal, it is unspecified which
+ * element is inserted.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator whose `value_type` is
+ * convertible to the `value_type` of the data structure
+ * @tparam SizeT Size type of the batch count
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of input elements
+ * @param n_ptr Pointer to the device memory holding the actual number of input elements
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename SizeT,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void insert_bounded(
+  InputIt first, SizeT const* n_ptr, AtomicT* size_stripes, int32_t num_stripes, Ref ref)
+{
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_successes = 0;
+
+  auto const n           = static_cast<cuco::detail::index_type>(*n_ptr);
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& insert_element{*(first + idx)};
+    if constexpr (CGSize == 1) {
+      if (ref.insert(insert_element)) { thread_num_successes++; };
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      if (ref.insert(tile, insert_element) && tile.thread_rank() == 0) { thread_num_successes++; }
+    }
+    idx += loop_stride;
+  }
+
+  // compute number of successfully inserted elements for each block
+  // and atomically add to the container's size counters
+  auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+  if (threadIdx.x == 0 and size_stripes != nullptr) {
+    size_stripes[blockIdx.x % num_stripes].fetch_add(block_num_successes,
+                                                     cuda::std::memory_order_relaxed);
+  }
+}
+
+/**
+ * @brief Indicates whether the keys in the range `[first, first + *n_ptr)` are contained in the
+ * container.
+ *
+ * @note The actual number of input keys is read from device memory so that the kernel can be
+ * recorded into a CUDA graph once with a fixed maximum batch size and replayed with varying batch
+ * sizes.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam SizeT Size type of the batch count
+ * @tparam OutputIt Device accessible output iterator assignable from `bool`
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n_ptr Pointer to the device memory holding the actual number of keys
+ * @param output_begin Beginning of the sequence of booleans for the presence of each key
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename SizeT, typename OutputIt, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void contains_bounded(InputIt first,
+                                                               SizeT const* n_ptr,
+                                                               OutputIt output_begin,
+                                                               Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block       = cg::this_thread_block();
+  auto const thread_idx  = block.thread_rank();
+  auto const n           = static_cast<cuco::detail::index_type>(*n_ptr);
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  __shared__ bool output_buffer[BlockSize / CGSize];
+
+  while ((idx - thread_idx / CGSize) < n) {  // the whole thread block falls into the same iteration
+    if constexpr (CGSize == 1) {
+      if (idx < n) {
+        typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+        output_buffer[thread_idx]                                     = ref.contains(key);
+      }
+      block.sync();
+      if (idx < n) { *(output_begin + idx) = output_buffer[thread_idx]; }
+    } else {
+      auto const tile = cg::tiled_partition<CGSize>(block);
+      if (idx < n) {
+        typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+        auto const found                                              = ref.contains(tile, key);
+        if (tile.thread_rank() == 0) { *(output_begin + idx) = found; }
+      }
+    }
+    idx += loop_stride;
+  }
+}
+
 /**
  * @brief Helper to determine the buffer type for the find kernel
  *
@@ -400,13 +822,181 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void find(InputIt first,
 }
 
 /**
- * @brief Inserts all elements in the range `[first, last)`.
+ * @brief Finds the equivalent container elements of all keys in the range `[first, first +
+ * *n_ptr)`.
  *
- * @note: For a given element `*(first + i)`, if the container doesn't already contain an element
- * with an equivalent key, inserts the element at a location pointed by `iter` and writes
- * `iter` to `found_begin + i` and writes `true` to `inserted_begin + i`. Otherwise, finds the
- * location of the equivalent element, `iter` and writes `iter` to `found_begin + i` and writes
- * `false` to `inserted_begin + i`.
+ * @note The actual number of input keys is read from device memory so that the kernel can be
+ * recorded into a CUDA graph once with a fixed maximum batch size and replayed with varying batch
+ * sizes.
+ * @note If the key `*(first + i)` has a match in the container, copies the match to `(output_begin
+ * + i)`. Else, copies the empty sentinel.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam SizeT Size type of the batch count
+ * @tparam OutputIt Device accessible output iterator
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n_ptr Pointer to the device memory holding the actual number of keys
+ * @param output_begin Beginning of the sequence of matched payloads retrieved for each key
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename SizeT, typename OutputIt, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void find_bounded(InputIt first,
+                                                           SizeT const* n_ptr,
+                                                           OutputIt output_begin,
+                                                           Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const block       = cg::this_thread_block();
+  auto const thread_idx  = block.thread_rank();
+  auto const n           = static_cast<cuco::detail::index_type>(*n_ptr);
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  using output_type = typename find_buffer<Ref>::type;
+  __shared__ output_type output_buffer[BlockSize / CGSize];
+
+  auto constexpr has_payload = not std::is_same_v<typename Ref::key_type, typename Ref::value_type>;
+
+  auto const sentinel = [&]() {
+    if constexpr (has_payload) {
+      return ref.empty_value_sentinel();
+    } else {
+      return ref.empty_key_sentinel();
+    }
+  }();
+
+  auto output = cuda::proclaim_return_type<output_type>([&] __device__(auto found) {
+    if constexpr (has_payload) {
+      return found == ref.end() ? sentinel : found->second;
+    } else {
+      return found == ref.end() ? sentinel : *found;
+    }
+  });
+
+  while ((idx - thread_idx / CGSize) < n) {  // the whole thread block falls into the same iteration
+    if constexpr (CGSize == 1) {
+      if (idx < n) {
+        typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+        output_buffer[thread_idx]                                     = output(ref.find(key));
+      }
+      block.sync();
+      if (idx < n) { *(output_begin + idx) = output_buffer[thread_idx]; }
+    } else {
+      auto const tile = cg::tiled_partition<CGSize>(block);
+      if (idx < n) {
+        typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+        auto const found                                              = ref.find(tile, key);
+
+        if (tile.thread_rank() == 0) { *(output_begin + idx) = output(found); }
+      }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Finds all keys in the range `[first, first + n)` and partitions the results into
+ * compacted found and missing outputs in a single pass.
+ *
+ * @note For each key `*(first + i)` with a match in the container, writes the pair `{i, match}` to
+ * the found output; for each key without a match, writes the index `i` to the missing output.
+ * Output positions are claimed with one atomic update per group of coalesced writers, so both
+ * outputs are compacted but not ordered by key index.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize The size of the thread block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam FoundIt Device accessible output iterator of (key index, match) pairs
+ * @tparam MissingIt Device accessible output iterator of key indices
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of keys
+ * @param n Number of keys to query
+ * @param found_begin Beginning of the compacted sequence of (key index, match) pairs
+ * @param missing_begin Beginning of the compacted sequence of key indices without a match
+ * @param found_counter Counter of keys with a match
+ * @param missing_counter Counter of keys without a match
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename FoundIt,
+          typename MissingIt,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void find_partitioned(InputIt first,
+                                                               cuco::detail::index_type n,
+                                                               FoundIt found_begin,
+                                                               MissingIt missing_begin,
+                                                               AtomicT* found_counter,
+                                                               AtomicT* missing_counter,
+                                                               Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  using size_type = typename Ref::size_type;
+
+  auto constexpr has_payload = not std::is_same_v<typename Ref::key_type, typename Ref::value_type>;
+
+  // claims a contiguous output range with a single atomic update per group of coalesced writers
+  auto const append = [](AtomicT* counter, auto output_it, auto const& value) {
+    auto const writers = cg::coalesced_threads();
+    size_type offset{};
+    if (writers.thread_rank() == 0) {
+      offset = counter->fetch_add(static_cast<size_type>(writers.size()),
+                                  cuda::std::memory_order_relaxed);
+    }
+    offset = writers.shfl(offset, 0);
+    *(output_it + offset + writers.thread_rank()) = value;
+  };
+
+  while (idx < n) {
+    typename std::iterator_traits<InputIt>::value_type const& key = *(first + idx);
+
+    auto const emit = [&](auto found) {
+      if (found == ref.end()) {
+        append(missing_counter, missing_begin, static_cast<size_type>(idx));
+      } else {
+        auto const match = [&]() {
+          if constexpr (has_payload) {
+            return found->second;
+          } else {
+            return *found;
+          }
+        }();
+        append(found_counter, found_begin, cuco::pair{static_cast<size_type>(idx), match});
+      }
+    };
+
+    if constexpr (CGSize == 1) {
+      emit(ref.find(key));
+    } else {
+      auto const tile  = cg::tiled_partition<CGSize>(cg::this_thread_block());
+      auto const found = ref.find(tile, key);
+      if (tile.thread_rank() == 0) { emit(found); }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Inserts all elements in the range `[first, last)`.
+ *
+ * @note: For a given element `*(first + i)`, if the container doesn't already contain an element
+ * with an equivalent key, inserts the element at a location pointed by `iter` and writes
+ * `iter` to `found_begin + i` and writes `true` to `inserted_begin + i`. Otherwise, finds the
+ * location of the equivalent element, `iter` and writes `iter` to `found_begin + i` and writes
+ * `false` to `inserted_begin + i`.
  *
  * @tparam CGSize Number of threads in each CG
  * @tparam BlockSize Number of threads in each block
@@ -422,6 +1012,9 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void find(InputIt first,
  * @param n Number of input elements
  * @param found_begin Beginning of the sequence of elements found for each key
  * @param inserted_begin Beginning of the sequence of booleans for the presence of each key
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
  * @param ref Non-owning container device ref used to access the slot storage
  */
 template <int32_t CGSize,
@@ -429,15 +1022,22 @@ template <int32_t CGSize,
           typename InputIt,
           typename FoundIt,
           typename InsertedIt,
+          typename AtomicT,
           typename Ref>
 CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
                                                               cuco::detail::index_type n,
                                                               FoundIt found_begin,
                                                               InsertedIt inserted_begin,
+                                                              AtomicT* size_stripes,
+                                                              int32_t num_stripes,
                                                               Ref ref)
 {
   namespace cg = cooperative_groups;
 
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_successes = 0;
+
   auto const block       = cg::this_thread_block();
   auto const thread_idx  = block.thread_rank();
   auto const loop_stride = cuco::detail::grid_stride() / CGSize;
@@ -471,6 +1071,7 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
          */
         output_location_buffer[thread_idx] = output(iter);
         output_inserted_buffer[thread_idx] = inserted;
+        if (inserted) { thread_num_successes++; }
       }
       block.sync();
       if (idx < n) {
@@ -485,11 +1086,18 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_and_find(InputIt first,
         if (tile.thread_rank() == 0) {
           *(found_begin + idx)    = output(iter);
           *(inserted_begin + idx) = inserted;
+          if (inserted) { thread_num_successes++; }
         }
       }
     }
     idx += loop_stride;
   }
+
+  auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+  if (threadIdx.x == 0 and size_stripes != nullptr) {
+    size_stripes[blockIdx.x % num_stripes].fetch_add(block_num_successes,
+                                                     cuda::std::memory_order_relaxed);
+  }
 }
 
 /**
@@ -555,6 +1163,211 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void count(InputIt first,
   if (threadIdx.x == 0) { count->fetch_add(block_count, cuda::std::memory_order_relaxed); }
 }
 
+/**
+ * @brief Flushes the first `num` buffered (probe key, matched slot) pairs to the global output
+ * sequences.
+ *
+ * @note The output positions are claimed with a single atomic update per group; the copy itself is
+ * strided over all group threads.
+ *
+ * @tparam CG Cooperative Group type
+ * @tparam Size Type of the buffer size
+ * @tparam PairT Buffered (probe key, matched slot) pair type
+ * @tparam AtomicT Atomic counter type
+ * @tparam OutputProbeIt Device accessible output iterator of probe keys
+ * @tparam OutputMatchIt Device accessible output iterator of matched slots
+ *
+ * @param group The Cooperative Group performing the flush
+ * @param num Number of buffered pairs
+ * @param buffer Shared memory buffer holding the pairs
+ * @param counter Global counter used to claim the output positions
+ * @param output_probe Beginning of the output sequence of probe keys
+ * @param output_match Beginning of the output sequence of matched slots
+ */
+template <typename CG,
+          typename Size,
+          typename PairT,
+          typename AtomicT,
+          typename OutputProbeIt,
+          typename OutputMatchIt>
+__device__ void flush_buffer(CG const& group,
+                             Size num,
+                             PairT const* buffer,
+                             AtomicT* counter,
+                             OutputProbeIt output_probe,
+                             OutputMatchIt output_match)
+{
+  auto i = group.thread_rank();
+
+#if defined(CUCO_HAS_CG_INVOKE_ONE)
+  auto const offset = cooperative_groups::invoke_one_broadcast(
+    group, [&]() { return counter->fetch_add(num, cuda::std::memory_order_relaxed); });
+#else
+  typename AtomicT::value_type offset;
+  if (i == 0) { offset = counter->fetch_add(num, cuda::std::memory_order_relaxed); }
+  offset = group.shfl(offset, 0);
+#endif
+
+  while (i < num) {
+    *(output_probe + offset + i) = buffer[i].first;
+    *(output_match + offset + i) = buffer[i].second;
+
+    i += group.size();
+  }
+}
+
+/**
+ * @brief Retrieves all matches of the probe keys in the range `[first, first + n)` into compacted
+ * (probe key, matched slot) output sequences.
+ *
+ * Matches are staged in a shared memory buffer per probing tile and flushed in bulk so that the
+ * global output counter is updated once per buffer instead of once per match. The buffer is
+ * auto-sized from the occupancy budget: each block spends at most 32 bytes of shared memory per
+ * thread (the slice still available when the maximum number of blocks of this size is resident),
+ * but never less than two probing steps' worth of matches per tile so flushes stay amortized.
+ *
+ * @note If `IsOuter` is `true`, a probe key without any match emits a single pair of the key and
+ * the empty key sentinel.
+ * @note The order in which matches are written is non-deterministic.
+ *
+ * @tparam IsOuter Flag indicating whether it's an outer retrieve or not
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam InputIt Device accessible input iterator
+ * @tparam OutputProbeIt Device accessible output iterator of probe keys
+ * @tparam OutputMatchIt Device accessible output iterator of matched slots
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device ref allowing access to storage
+ *
+ * @param first Beginning of the sequence of probe keys
+ * @param n Number of probe keys
+ * @param output_probe Beginning of the output sequence of the probe keys of each match
+ * @param output_match Beginning of the output sequence of matched slots
+ * @param counter Counter incremented by the number of retrieved pairs
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <bool IsOuter,
+          int32_t CGSize,
+          int32_t BlockSize,
+          typename InputIt,
+          typename OutputProbeIt,
+          typename OutputMatchIt,
+          typename AtomicT,
+          typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void retrieve(InputIt first,
+                                                       cuco::detail::index_type n,
+                                                       OutputProbeIt output_probe,
+                                                       OutputMatchIt output_match,
+                                                       AtomicT* counter,
+                                                       Ref ref)
+{
+  namespace cg = cooperative_groups;
+
+  using probe_type = typename std::iterator_traits<InputIt>::value_type;
+  using slot_type  = typename Ref::value_type;
+  using pair_type  = cuco::pair<probe_type, slot_type>;
+
+  auto constexpr num_tiles = BlockSize / CGSize;
+  // every tile thread traverses its own window per probing step, so a single step emits at most
+  // `CGSize * window_size` matches
+  auto constexpr step_bound = CGSize * Ref::window_size;
+  auto constexpr occupancy_bound =
+    (BlockSize * 32) / (num_tiles * static_cast<int32_t>(sizeof(pair_type)));
+  auto constexpr buffer_capacity =
+    occupancy_bound > 2 * step_bound ? occupancy_bound : 2 * step_bound;
+
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  __shared__ pair_type buffer[num_tiles][buffer_capacity];
+
+  if constexpr (CGSize == 1) {
+    auto* const thread_buffer = buffer[threadIdx.x];
+    int32_t num               = 0;
+
+    auto const flush = [&]() {
+      auto const offset = counter->fetch_add(num, cuda::std::memory_order_relaxed);
+      for (int32_t i = 0; i < num; ++i) {
+        *(output_probe + offset + i) = thread_buffer[i].first;
+        *(output_match + offset + i) = thread_buffer[i].second;
+      }
+      num = 0;
+    };
+
+    while (idx < n) {
+      probe_type const& probe_key = *(first + idx);
+      [[maybe_unused]] bool found = false;
+
+      ref.for_each(probe_key, [&](slot_type const& slot) {
+        found                = true;
+        thread_buffer[num++] = {probe_key, slot};
+        if (num == buffer_capacity) { flush(); }
+      });
+
+      if constexpr (IsOuter) {
+        if (not found) {
+          thread_buffer[num++] = {probe_key, ref.empty_key_sentinel()};
+          if (num == buffer_capacity) { flush(); }
+        }
+      }
+      idx += loop_stride;
+    }
+    if (num > 0) { flush(); }
+  } else {
+    auto const block        = cg::this_thread_block();
+    auto const tile         = cg::tiled_partition<CGSize>(block);
+    auto const tile_idx     = tile.meta_group_rank();
+    auto* const tile_buffer = buffer[tile_idx];
+
+    __shared__ uint32_t num[num_tiles];
+
+    if (tile.thread_rank() == 0) { num[tile_idx] = 0; }
+    tile.sync();
+
+    // flushes the tile's buffer whenever the next probing step could overflow it, keeping room
+    // for at least `step_bound` further matches at all times
+    auto const flush_if_full = [&](cg::thread_block_tile<CGSize> const& group) {
+      group.sync();
+      auto const size = num[tile_idx];
+      if (size + step_bound > buffer_capacity) {
+        flush_buffer(group, size, tile_buffer, counter, output_probe, output_match);
+        if (group.thread_rank() == 0) { num[tile_idx] = 0; }
+      }
+      group.sync();
+    };
+
+    while (idx < n) {
+      probe_type const& probe_key = *(first + idx);
+      [[maybe_unused]] bool found = false;
+
+      ref.for_each(
+        tile,
+        probe_key,
+        [&](slot_type const& slot) {
+          auto const offset   = atomicAdd_block(&num[tile_idx], 1u);
+          found               = true;
+          tile_buffer[offset] = {probe_key, slot};
+        },
+        flush_if_full);
+
+      if constexpr (IsOuter) {
+        if (not tile.any(found)) {
+          // the preceding `flush_if_full` call guarantees room for the sentinel pair
+          if (tile.thread_rank() == 0) {
+            tile_buffer[num[tile_idx]++] = {probe_key, ref.empty_key_sentinel()};
+          }
+          flush_if_full(tile);
+        }
+      }
+      idx += loop_stride;
+    }
+
+    tile.sync();
+    auto const size = num[tile_idx];
+    if (size > 0) { flush_buffer(tile, size, tile_buffer, counter, output_probe, output_match); }
+  }
+}
+
 /**
  * @brief Calculates the number of filled slots for the given window storage.
  *
@@ -595,6 +1408,241 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void size(StorageRef storage,
   if (threadIdx.x == 0) { count->fetch_add(block_count, cuda::std::memory_order_relaxed); }
 }
 
+/**
+ * @brief Computes probing diagnostics for all keys resident in the given window storage.
+ *
+ * For every filled slot, the kernel replays the cooperative probe sequence a `find` for the
+ * resident key would take and counts the number of probed windows until the key is reached. Each
+ * tile of `CGSize` threads scans one slot at a time and cooperates on the replay so that the
+ * recorded lengths match the container's device operations exactly.
+ *
+ * @tparam HasPayload Flag indicating whether the slot contains a payload
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam ProbingScheme Probing scheme type
+ * @tparam Key Key type
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param probing_scheme Probing scheme used to generate the probe sequences
+ * @param empty_key_sentinel The reserved key value for empty slots
+ * @param erased_key_sentinel The reserved key value for erased slots
+ * @param num_bins Number of probe length histogram bins
+ * @param histogram Probe length histogram; bin `i` counts the keys reached after exactly `i + 1`
+ * window probes and the last bin aggregates all longer probe chains
+ * @param max_probe_length Longest probe chain of any resident key
+ * @param num_erased Number of erased slots
+ */
+template <bool HasPayload,
+          int32_t CGSize,
+          int32_t BlockSize,
+          typename StorageRef,
+          typename ProbingScheme,
+          typename Key,
+          typename AtomicT>
+CUCO_KERNEL __launch_bounds__(BlockSize) void probe_statistics(
+  StorageRef storage,
+  ProbingScheme probing_scheme,
+  Key empty_key_sentinel,
+  Key erased_key_sentinel,
+  cuco::detail::index_type num_bins,
+  AtomicT* histogram,
+  AtomicT* max_probe_length,
+  AtomicT* num_erased)
+{
+  namespace cg = cooperative_groups;
+
+  using size_type = typename StorageRef::size_type;
+
+  auto const extract_key = [](typename StorageRef::value_type const& slot) {
+    if constexpr (HasPayload) {
+      return slot.first;
+    } else {
+      return slot;
+    }
+  };
+
+  auto const tile        = cg::tiled_partition<CGSize>(cg::this_thread_block());
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+  auto const num_windows = static_cast<cuco::detail::index_type>(storage.num_windows());
+  auto const n           = num_windows * StorageRef::window_size;
+
+  while (idx < n) {
+    auto const key =
+      extract_key(storage[idx / StorageRef::window_size][idx % StorageRef::window_size]);
+
+    if (cuco::detail::bitwise_compare(key, erased_key_sentinel)) {
+      if (tile.thread_rank() == 0) { num_erased->fetch_add(1, cuda::std::memory_order_relaxed); }
+    } else if (not cuco::detail::bitwise_compare(key, empty_key_sentinel)) {
+      auto probing_iter = probing_scheme(tile, key, storage.window_extent());
+      auto length       = cuco::detail::index_type{1};
+
+      while (true) {
+        auto const window_slots = storage[*probing_iter];
+
+        auto found = false;
+        for (auto const& slot : window_slots) {
+          if (cuco::detail::bitwise_compare(extract_key(slot), key)) { found = true; }
+        }
+
+        // `length > num_windows` guards against sequences broken by concurrent modifications
+        if (tile.ballot(found) or length > num_windows) { break; }
+        ++probing_iter;
+        ++length;
+      }
+
+      if (tile.thread_rank() == 0) {
+        auto const bin = (length < num_bins ? length : num_bins) - 1;
+        histogram[bin].fetch_add(1, cuda::std::memory_order_relaxed);
+        max_probe_length->fetch_max(static_cast<size_type>(length),
+                                    cuda::std::memory_order_relaxed);
+      }
+    }
+
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Writes the contents of all filled slots in `[slot_offset, slot_offset + n)` to
+ * `output_begin`, compacted via a global counter.
+ *
+ * @note The order in which slots are written is non-deterministic. Writers of one warp aggregate
+ * their counter updates into a single `fetch_add` so the compaction does not serialize on the
+ * global atomic.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam GetSlot Type of functor returning the slot content for a given slot index
+ * @tparam IsFilled Type of predicate indicating if the given slot is filled
+ * @tparam OutputIt Device accessible output iterator assignable from the slot content
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param get_slot Functor returning the slot content for a given slot index
+ * @param slot_offset Index of the first slot to retrieve
+ * @param n Number of slots to retrieve
+ * @param is_filled Predicate indicating if the given slot is filled
+ * @param output_begin Beginning of the output sequence of retrieved slots
+ * @param num_retrieved Counter incremented by the number of retrieved slots
+ */
+template <int32_t BlockSize, typename GetSlot, typename IsFilled, typename OutputIt, typename AtomicT>
+CUCO_KERNEL __launch_bounds__(BlockSize) void retrieve_chunk(GetSlot get_slot,
+                                                             cuco::detail::index_type slot_offset,
+                                                             cuco::detail::index_type n,
+                                                             IsFilled is_filled,
+                                                             OutputIt output_begin,
+                                                             AtomicT* num_retrieved)
+{
+  namespace cg = cooperative_groups;
+
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    auto const slot = get_slot(slot_offset + idx);
+    if (is_filled(slot)) {
+      auto const writers = cg::coalesced_threads();
+      typename AtomicT::value_type offset{};
+      if (writers.thread_rank() == 0) {
+        offset = num_retrieved->fetch_add(writers.size(), cuda::std::memory_order_relaxed);
+      }
+      offset                                           = writers.shfl(offset, 0);
+      *(output_begin + offset + writers.thread_rank()) = slot;
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Extracts all filled slots of the windows in `[window_offset, window_offset + n)` into
+ * `buffer` and resets every slot of the extracted windows to the empty sentinel.
+ *
+ * @note Erased-sentinel tombstones carry no data to extract but are still reset, so the sweep
+ * reclaims them.
+ *
+ * @tparam BlockSize Number of threads in each block
+ * @tparam StorageRef Type of non-owning ref allowing access to storage
+ * @tparam Predicate Type of predicate indicating if the given slot is filled
+ * @tparam AtomicT Atomic counter type
+ *
+ * @param storage Non-owning device ref used to access the slot storage
+ * @param window_offset Index of the first window to extract
+ * @param n Number of windows to extract
+ * @param is_filled Predicate indicating if the given slot is filled
+ * @param empty_sentinel The sentinel value denoting an empty slot
+ * @param buffer Device buffer large enough to hold all slots of the extracted windows
+ * @param buffer_size Number of extracted slots
+ */
+template <int32_t BlockSize, typename StorageRef, typename Predicate, typename AtomicT>
+CUCO_KERNEL __launch_bounds__(BlockSize) void extract_and_clear(
+  StorageRef storage,
+  typename StorageRef::size_type window_offset,
+  cuco::detail::index_type n,
+  Predicate is_filled,
+  typename StorageRef::value_type empty_sentinel,
+  typename StorageRef::value_type* buffer,
+  AtomicT* buffer_size)
+{
+  auto const loop_stride = cuco::detail::grid_stride();
+  auto idx               = cuco::detail::global_thread_id();
+
+  while (idx < n) {
+    auto const window_idx = window_offset + idx;
+    auto const window     = storage[window_idx];
+#pragma unroll
+    for (int32_t i = 0; i < StorageRef::window_size; ++i) {
+      if (is_filled(window[i])) {
+        auto const offset = buffer_size->fetch_add(1, cuda::std::memory_order_relaxed);
+        buffer[offset]    = window[i];
+      }
+      storage.data()[window_idx][i] = empty_sentinel;
+      if constexpr (cuco::detail::has_window_tags_v<StorageRef>) {
+        storage.tags()[window_idx * StorageRef::window_size + i] = StorageRef::empty_tag;
+      }
+    }
+    idx += loop_stride;
+  }
+}
+
+/**
+ * @brief Re-inserts the first `*buffer_size` elements of `buffer` into the container.
+ *
+ * @note The number of buffered elements is read from device memory so that the kernel can be
+ * launched without synchronizing with a preceding extraction step.
+ *
+ * @tparam CGSize Number of threads in each CG
+ * @tparam BlockSize Number of threads in each block
+ * @tparam T Slot type
+ * @tparam AtomicT Atomic counter type
+ * @tparam Ref Type of non-owning device container ref allowing access to storage
+ *
+ * @param buffer Device buffer holding the elements to insert
+ * @param buffer_size Number of buffered elements
+ * @param ref Non-owning container device ref used to access the slot storage
+ */
+template <int32_t CGSize, int32_t BlockSize, typename T, typename AtomicT, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void insert_from_buffer(T const* buffer,
+                                                                 AtomicT const* buffer_size,
+                                                                 Ref ref)
+{
+  auto const n           = static_cast<cuco::detail::index_type>(
+    buffer_size->load(cuda::std::memory_order_relaxed));
+  auto const loop_stride = cuco::detail::grid_stride() / CGSize;
+  auto idx               = cuco::detail::global_thread_id() / CGSize;
+
+  while (idx < n) {
+    if constexpr (CGSize == 1) {
+      ref.insert(buffer[idx]);
+    } else {
+      auto const tile =
+        cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
+      ref.insert(tile, buffer[idx]);
+    }
+    idx += loop_stride;
+  }
+}
+
 template <int32_t BlockSize, typename ContainerRef, typename Predicate>
 CUCO_KERNEL __launch_bounds__(BlockSize) void rehash(
   typename ContainerRef::storage_ref_type storage_ref,
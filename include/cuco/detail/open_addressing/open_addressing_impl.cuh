@@ -20,24 +20,47 @@
 #include <cuco/detail/open_addressing/functors.cuh>
 #include <cuco/detail/open_addressing/kernels.cuh>
 #include <cuco/detail/storage/counter_storage.cuh>
+#include <cuco/detail/storage/striped_counter_storage.cuh>
 #include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utility/math.hpp>
 #include <cuco/extent.cuh>
 #include <cuco/operator.hpp>
 #include <cuco/probing_scheme.cuh>
 #include <cuco/storage.cuh>
+#include <cuco/utility/probing_statistics.hpp>
 #include <cuco/utility/traits.hpp>
 
 #include <cub/device/device_for.cuh>
+#include <cub/device/device_reduce.cuh>
 #include <cub/device/device_select.cuh>
 #include <cuda/atomic>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
 
 namespace cuco {
 namespace detail {
+
+/**
+ * @brief Metadata header prepended to a serialized open addressing container.
+ *
+ * The header is validated on restore to reject buffers that were serialized with an incompatible
+ * container configuration.
+ */
+struct serialization_header {
+  std::uint64_t num_windows;  ///< Number of slot windows
+  std::uint32_t window_size;  ///< Number of slots per window
+  std::uint32_t value_size;   ///< Size of the slot type in bytes
+};
+
 /**
  * @brief An open addressing impl class.
  *
@@ -87,6 +110,8 @@ class open_addressing_impl {
   static constexpr auto cg_size      = ProbingScheme::cg_size;  ///< CG size used for probing
   static constexpr auto window_size  = Storage::window_size;    ///< Window size used for probing
   static constexpr auto thread_scope = Scope;                   ///< CUDA thread scope
+  /// Number of privatized size counters used in counted mode
+  static constexpr int32_t num_size_stripes = 128;
 
   using key_type   = Key;    ///< Key type
   using value_type = Value;  ///< The storage value type, NOT payload type
@@ -100,6 +125,9 @@ class open_addressing_impl {
 
   using storage_ref_type = typename storage_type::ref_type;  ///< Non-owning window storage ref type
   using probing_scheme_type = ProbingScheme;                 ///< Probe scheme type
+  /// Striped size counter storage type used in counted mode
+  using size_counter_type =
+    detail::striped_counter_storage<size_type, thread_scope, allocator_type, num_size_stripes>;
 
   /**
    * @brief Constructs a statically-sized open addressing data structure with the specified initial
@@ -228,13 +256,121 @@ class open_addressing_impl {
     this->clear_async(stream);
   }
 
+  /**
+   * @brief Constructs an open addressing data structure by restoring previously serialized slot
+   * storage, skipping slot initialization.
+   *
+   * @note The configuration parameters must match the ones the container was constructed with at
+   * serialization time; in particular, `capacity` must resolve to the same window extent and the
+   * sentinels, key equality predicate, and probing scheme must be equivalent. Mismatches in the
+   * slot layout are detected via the serialized header; semantic mismatches (e.g., a different
+   * hasher) result in undefined behavior.
+   * @note `serialized` may point to host or device memory. The slot storage is restored with a
+   * single `cudaMemcpyAsync` on the given stream.
+   *
+   * @throw If the serialized header does not match the container's slot layout
+   *
+   * @param serialized Pointer to a buffer previously filled via `serialize`
+   * @param capacity The requested lower-bound size used at serialization time
+   * @param empty_slot_sentinel The reserved slot value for empty slots
+   * @param erased_key_sentinel The reserved key value for erased slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to restore the data structure
+   */
+  constexpr open_addressing_impl(std::byte const* serialized,
+                                 Extent capacity,
+                                 Value empty_slot_sentinel,
+                                 Key erased_key_sentinel,
+                                 KeyEqual const& pred,
+                                 ProbingScheme const& probing_scheme,
+                                 Allocator const& alloc,
+                                 cuda::stream_ref stream)
+    : empty_slot_sentinel_{empty_slot_sentinel},
+      erased_key_sentinel_{erased_key_sentinel},
+      predicate_{pred},
+      probing_scheme_{probing_scheme},
+      storage_{make_window_extent<open_addressing_impl>(capacity), alloc}
+  {
+    serialization_header header;
+    CUCO_CUDA_TRY(cudaMemcpy(&header, serialized, sizeof(header), cudaMemcpyDefault));
+    CUCO_EXPECTS(header.value_size == sizeof(value_type),
+                 "Serialized slot size does not match the container's slot type");
+    CUCO_EXPECTS(header.window_size == window_size,
+                 "Serialized window size does not match the container's window size");
+    CUCO_EXPECTS(header.num_windows == static_cast<std::uint64_t>(storage_.num_windows()),
+                 "Serialized capacity does not match the requested capacity");
+
+    CUCO_CUDA_TRY(cudaMemcpyAsync(storage_.data(),
+                                  serialized + sizeof(header),
+                                  sizeof(value_type) * window_size * storage_.num_windows(),
+                                  cudaMemcpyDefault,
+                                  stream.get()));
+  }
+
+  /**
+   * @brief Gets the number of bytes required to serialize the container's slot storage.
+   *
+   * @return The serialized size in bytes
+   */
+  [[nodiscard]] constexpr std::size_t serialized_size() const noexcept
+  {
+    return sizeof(serialization_header) +
+           sizeof(value_type) * window_size * static_cast<std::size_t>(storage_.num_windows());
+  }
+
+  /**
+   * @brief Asynchronously serializes the container's slot storage and layout metadata into
+   * `buffer`.
+   *
+   * @note `buffer` may point to host or device memory and must provide at least
+   * `serialized_size()` bytes. The slot storage is written with a single `cudaMemcpyAsync` on the
+   * given stream; passing a device buffer allows writing the bytes to disk via cuFile/GPUDirect
+   * Storage without staging through host memory.
+   *
+   * @param buffer Pointer to the output buffer
+   * @param stream CUDA stream this operation is executed in
+   */
+  void serialize_async(std::byte* buffer, cuda::stream_ref stream) const
+  {
+    auto const header = serialization_header{static_cast<std::uint64_t>(storage_.num_windows()),
+                                             static_cast<std::uint32_t>(window_size),
+                                             static_cast<std::uint32_t>(sizeof(value_type))};
+    CUCO_CUDA_TRY(cudaMemcpy(buffer, &header, sizeof(header), cudaMemcpyDefault));
+    CUCO_CUDA_TRY(cudaMemcpyAsync(buffer + sizeof(header),
+                                  storage_.data(),
+                                  sizeof(value_type) * window_size * storage_.num_windows(),
+                                  cudaMemcpyDefault,
+                                  stream.get()));
+  }
+
+  /**
+   * @brief Serializes the container's slot storage and layout metadata into `buffer`.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `serialize_async`.
+   *
+   * @param buffer Pointer to the output buffer
+   * @param stream CUDA stream this operation is executed in
+   */
+  void serialize(std::byte* buffer, cuda::stream_ref stream) const
+  {
+    this->serialize_async(buffer, stream);
+    stream.wait();
+  }
+
   /**
    * @brief Erases all elements from the container. After this call, `size()` returns zero.
    * Invalidates any references, pointers, or iterators referring to contained elements.
    *
    * @param stream CUDA stream this operation is executed in
    */
-  void clear(cuda::stream_ref stream) { storage_.initialize(empty_slot_sentinel_, stream); }
+  void clear(cuda::stream_ref stream)
+  {
+    storage_.initialize(empty_slot_sentinel_, stream);
+    if (size_counter_) { size_counter_->reset(stream); }
+  }
 
   /**
    * @brief Asynchronously erases all elements from the container. After this call, `size()` returns
@@ -245,6 +381,7 @@ class open_addressing_impl {
   void clear_async(cuda::stream_ref stream) noexcept
   {
     storage_.initialize_async(empty_slot_sentinel_, stream);
+    if (size_counter_) { size_counter_->reset(stream); }
   }
 
   /**
@@ -296,6 +433,44 @@ class open_addressing_impl {
     this->insert_if_async(first, last, always_true, thrust::identity{}, container_ref, stream);
   }
 
+  /**
+   * @brief Asynchronously inserts all elements in the range `[first, first + *num_items)`.
+   *
+   * @note The actual number of input elements is read from device memory at kernel execution time
+   * while the launch configuration is derived from `max_num_items`, making this function safe to
+   * record into a CUDA graph and replay with varying batch sizes.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * open_addressing_impl::value_type></tt> is `true`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of input elements
+   * @param num_items Pointer to the device memory holding the actual number of input elements
+   * @param max_num_items Maximum number of input elements
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt, typename Ref>
+  void insert_bounded_async(InputIt first,
+                            size_type const* num_items,
+                            size_type max_num_items,
+                            Ref container_ref,
+                            cuda::stream_ref stream) noexcept
+  {
+    if (max_num_items == 0) { return; }
+
+    auto const grid_size = cuco::detail::grid_size(max_num_items, cg_size);
+
+    detail::insert_bounded<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first,
+        num_items,
+        size_counter_ ? size_counter_->data() : nullptr,
+        num_size_stripes,
+        container_ref);
+  }
+
   /**
    * @brief Inserts keys in the range `[first, last)` if `pred` of the corresponding stencil returns
    * true.
@@ -341,7 +516,14 @@ class open_addressing_impl {
 
     detail::insert_if_n<cg_size, cuco::detail::default_block_size()>
       <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, stencil, pred, counter.data(), container_ref);
+        first,
+        num_keys,
+        stencil,
+        pred,
+        counter.data(),
+        size_counter_ ? size_counter_->data() : nullptr,
+        num_size_stripes,
+        container_ref);
 
     return counter.load_to_host(stream);
   }
@@ -381,9 +563,22 @@ class open_addressing_impl {
 
     auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
 
-    detail::insert_if_n<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, stencil, pred, container_ref);
+    if (size_counter_) {
+      detail::insert_if_n<cg_size, cuco::detail::default_block_size()>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first,
+          num_keys,
+          stencil,
+          pred,
+          static_cast<typename size_counter_type::value_type*>(nullptr),
+          size_counter_->data(),
+          num_size_stripes,
+          container_ref);
+    } else {
+      detail::insert_if_n<cg_size, cuco::detail::default_block_size()>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first, num_keys, stencil, pred, container_ref);
+    }
   }
 
   /**
@@ -425,7 +620,13 @@ class open_addressing_impl {
 
     detail::insert_and_find<cg_size, cuco::detail::default_block_size()>
       <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, found_begin, inserted_begin, container_ref);
+        first,
+        num_keys,
+        found_begin,
+        inserted_begin,
+        size_counter_ ? size_counter_->data() : nullptr,
+        num_size_stripes,
+        container_ref);
   }
 
   /**
@@ -463,9 +664,99 @@ class open_addressing_impl {
 
     auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
 
-    detail::erase<cg_size, cuco::detail::default_block_size()>
-      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num_keys, container_ref);
+    if (size_counter_) {
+      detail::erase<cg_size, cuco::detail::default_block_size()>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first, num_keys, size_counter_->data(), num_size_stripes, container_ref);
+    } else {
+      detail::erase<cg_size, cuco::detail::default_block_size()>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first, num_keys, container_ref);
+    }
+  }
+
+  /**
+   * @brief Erases the contents of all filled slots satisfying `pred` from the container.
+   *
+   * @note This function synchronizes the given stream and returns the number of evicted slots. For
+   * asynchronous execution use `evict_if_async`.
+   *
+   * @tparam Predicate Type of unary predicate applied to the copy of every filled slot
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param pred Predicate selecting the slots to evict
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   *
+   * @return Number of evicted slots
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate, typename Ref>
+  size_type evict_if(Predicate pred, Ref container_ref, cuda::stream_ref stream = {})
+  {
+    auto counter =
+      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+    counter.reset(stream);
+    this->evict_windows_async(
+      pred, 0, storage_.num_windows(), counter.data(), container_ref, stream);
+    return counter.load_to_host(stream);
+  }
+
+  /**
+   * @brief Asynchronously erases the contents of all filled slots satisfying `pred` from the
+   * container.
+   *
+   * @tparam Predicate Type of unary predicate applied to the copy of every filled slot
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param pred Predicate selecting the slots to evict
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate, typename Ref>
+  void evict_if_async(Predicate pred, Ref container_ref, cuda::stream_ref stream = {})
+  {
+    this->evict_windows_async(pred, 0, storage_.num_windows(), nullptr, container_ref, stream);
+  }
+
+  /**
+   * @brief Asynchronously sweeps the next `num_windows` windows of the slot storage, erasing the
+   * contents of all filled slots satisfying `pred`.
+   *
+   * @note The sweep resumes where the previous call left off and wraps around at the end of the
+   * slot storage, so that repeated calls with a small `num_windows` incrementally reclaim expired
+   * slots without ever scanning the whole container at once. Evicted slots are reclaimed via the
+   * regular CAS-based erase path and may be reused by concurrent insertions.
+   *
+   * @tparam Predicate Type of unary predicate applied to the copy of every filled slot
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param pred Predicate selecting the slots to evict
+   * @param num_windows Maximum number of windows to sweep
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate, typename Ref>
+  void sweep_evict_async(Predicate pred,
+                         size_type num_windows,
+                         Ref container_ref,
+                         cuda::stream_ref stream = {})
+  {
+    auto const total_windows = static_cast<size_type>(storage_.num_windows());
+    if (total_windows == 0 or num_windows == 0) { return; }
+
+    auto const offset = sweep_offset_;
+    auto const n      = std::min(num_windows, total_windows - offset);
+    this->evict_windows_async(pred, offset, n, nullptr, container_ref, stream);
+    sweep_offset_ = (offset + n) % total_windows;
   }
 
   /**
@@ -489,11 +780,62 @@ class open_addressing_impl {
                       Ref container_ref,
                       cuda::stream_ref stream) const noexcept
   {
+#if defined(CUCO_HAS_CUDA_BARRIER)
+    // Software-pipelined kernel prefetching each next probe window via cp.async. Tagged storage
+    // keeps the plain path since its fingerprint filter skips most window loads entirely.
+    if constexpr (not detail::has_window_tags_v<storage_ref_type>) {
+      auto const num_keys = cuco::detail::distance(first, last);
+      if (num_keys == 0) { return; }
+
+      auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+      detail::contains_pipelined<cg_size, cuco::detail::default_block_size()>
+        <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+          first, num_keys, output_begin, container_ref);
+      return;
+    }
+#endif
     auto const always_true = thrust::constant_iterator<bool>{true};
     this->contains_if_async(
       first, last, always_true, thrust::identity{}, output_begin, container_ref, stream);
   }
 
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, first + *num_keys)` are
+   * contained in the container.
+   *
+   * @note The actual number of input keys is read from device memory at kernel execution time
+   * while the launch configuration is derived from `max_num_keys`, making this function safe to
+   * record into a CUDA graph and replay with varying batch sizes.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys
+   * @param num_keys Pointer to the device memory holding the actual number of keys
+   * @param max_num_keys Maximum number of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt, typename Ref>
+  void contains_bounded_async(InputIt first,
+                              size_type const* num_keys,
+                              size_type max_num_keys,
+                              OutputIt output_begin,
+                              Ref container_ref,
+                              cuda::stream_ref stream) const noexcept
+  {
+    if (max_num_keys == 0) { return; }
+
+    auto const grid_size = cuco::detail::grid_size(max_num_keys, cg_size);
+
+    detail::contains_bounded<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first, num_keys, output_begin, container_ref);
+  }
+
   /**
    * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
    * the container if `pred` of the corresponding stencil returns true.
@@ -542,6 +884,88 @@ class open_addressing_impl {
         first, num_keys, stencil, pred, output_begin, container_ref);
   }
 
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * the container, writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff the key `*(first + i)` is
+   * present in the container. Compared to `contains_async` this writes one bit instead of one
+   * `bool` per key, cutting the output bandwidth of large probe batches by 8x. The output range
+   * must hold `(num_keys + 31) / 32` words; trailing bits of the last word are zero.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt, typename Ref>
+  void contains_bitmask_async(InputIt first,
+                              InputIt last,
+                              OutputIt output_begin,
+                              Ref container_ref,
+                              cuda::stream_ref stream) const noexcept
+  {
+    auto const always_true = thrust::constant_iterator<bool>{true};
+    this->contains_bitmask_if_async(
+      first, last, always_true, thrust::identity{}, output_begin, container_ref, stream);
+  }
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * the container if `pred` of the corresponding stencil returns true, writing the results as a
+   * packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff `pred( *(stencil + i) )`
+   * is true and the key `*(first + i)` is present in the container. The output range must hold
+   * `(num_keys + 31) / 32` words; trailing bits of the last word are zero.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam StencilIt Device accessible random access iterator whose value_type is
+   * convertible to Predicate's argument type
+   * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+   * argument type is convertible from <tt>std::iterator_traits<StencilIt>::value_type</tt>
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stencil Beginning of the stencil sequence
+   * @param pred Predicate to test on every element in the range `[stencil, stencil +
+   * std::distance(first, last))`
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt,
+            typename StencilIt,
+            typename Predicate,
+            typename OutputIt,
+            typename Ref>
+  void contains_bitmask_if_async(InputIt first,
+                                 InputIt last,
+                                 StencilIt stencil,
+                                 Predicate pred,
+                                 OutputIt output_begin,
+                                 Ref container_ref,
+                                 cuda::stream_ref stream) const noexcept
+  {
+    auto const num_keys = cuco::detail::distance(first, last);
+    if (num_keys == 0) { return; }
+
+    // each warp emits one word covering 32 keys, so one thread corresponds to one key regardless
+    // of the probing CG size
+    auto const grid_size = cuco::detail::grid_size(num_keys);
+
+    detail::contains_bitmask_if_n<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first, num_keys, stencil, pred, output_begin, container_ref);
+  }
+
   /**
    * @brief For all keys in the range `[first, last)`, asynchronously finds
    * a match with its key equivalent to the query key.
@@ -574,53 +998,373 @@ class open_addressing_impl {
   }
 
   /**
-   * @brief Counts the occurrences of keys in `[first, last)` contained in the container
+   * @brief For all keys in the range `[first, first + *num_keys)`, asynchronously finds a match
+   * with its key equivalent to the query key.
    *
-   * @tparam Input Device accessible input iterator
-   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   * @note The actual number of input keys is read from device memory at kernel execution time
+   * while the launch configuration is derived from `max_num_keys`, making this function safe to
+   * record into a CUDA graph and replay with varying batch sizes.
    *
-   * @param first Beginning of the sequence of keys to count
-   * @param last End of the sequence of keys to count
-   * @param stream CUDA stream used for count
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
    *
-   * @return The sum of total occurrences of all keys in `[first, last)`
+   * @param first Beginning of the sequence of keys
+   * @param num_keys Pointer to the device memory holding the actual number of keys
+   * @param max_num_keys Maximum number of keys
+   * @param output_begin Beginning of the sequence of matches retrieved for each key
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
    */
-  template <typename InputIt, typename Ref>
-  [[nodiscard]] size_type count(InputIt first,
-                                InputIt last,
-                                Ref container_ref,
-                                cuda::stream_ref stream) const noexcept
+  template <typename InputIt, typename OutputIt, typename Ref>
+  void find_bounded_async(InputIt first,
+                          size_type const* num_keys,
+                          size_type max_num_keys,
+                          OutputIt output_begin,
+                          Ref container_ref,
+                          cuda::stream_ref stream) const noexcept
   {
-    auto constexpr is_outer = false;
-    return this->count<is_outer>(first, last, container_ref, stream);
+    if (max_num_keys == 0) { return; }
+
+    auto const grid_size = cuco::detail::grid_size(max_num_keys, cg_size);
+
+    detail::find_bounded<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first, num_keys, output_begin, container_ref);
   }
 
   /**
-   * @brief Counts the occurrences of keys in `[first, last)` contained in the container
+   * @brief For all keys in the range `[first, last)`, finds a match with its key equivalent to the
+   * query key and partitions the results into compacted found and missing outputs in a single
+   * pass.
    *
-   * @note If a given key has no matches, its occurrence is 1.
+   * @note For each key `*(first + i)` with a match, writes the pair `{i, match}` to the found
+   * output; for each key without a match, writes the index `i` to the missing output. Both outputs
+   * are compacted but not ordered by key index.
+   * @note This function synchronizes the given stream.
    *
-   * @tparam Input Device accessible input iterator
+   * @tparam InputIt Device accessible input iterator
+   * @tparam FoundIt Device accessible output iterator of (key index, match) pairs
+   * @tparam MissingIt Device accessible output iterator of key indices
    * @tparam Ref Type of non-owning device container ref allowing access to storage
    *
-   * @param first Beginning of the sequence of keys to count
-   * @param last End of the sequence of keys to count
-   * @param stream CUDA stream used for count
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param found_begin Beginning of the compacted sequence of (key index, match) pairs
+   * @param missing_begin Beginning of the compacted sequence of key indices without a match
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
    *
-   * @return The sum of total occurrences of all keys in `[first, last)`
+   * @return Number of keys with a match
    */
-  template <typename InputIt, typename Ref>
-  [[nodiscard]] size_type count_outer(InputIt first,
-                                      InputIt last,
-                                      Ref container_ref,
-                                      cuda::stream_ref stream) const noexcept
+  template <typename InputIt, typename FoundIt, typename MissingIt, typename Ref>
+  size_type find_partitioned(InputIt first,
+                             InputIt last,
+                             FoundIt found_begin,
+                             MissingIt missing_begin,
+                             Ref container_ref,
+                             cuda::stream_ref stream) const
   {
-    auto constexpr is_outer = true;
-    return this->count<is_outer>(first, last, container_ref, stream);
-  }
+    auto const num_keys = cuco::detail::distance(first, last);
+    if (num_keys == 0) { return 0; }
 
-  /**
-   * @brief Retrieves all keys contained in the container.
+    auto found_counter =
+      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+    auto missing_counter =
+      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+    found_counter.reset(stream);
+    missing_counter.reset(stream);
+
+    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+    detail::find_partitioned<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(first,
+                                                                           num_keys,
+                                                                           found_begin,
+                                                                           missing_begin,
+                                                                           found_counter.data(),
+                                                                           missing_counter.data(),
+                                                                           container_ref);
+
+    return found_counter.load_to_host(stream);
+  }
+
+  /**
+   * @brief Inserts all elements in the host range `[first, last)`, overlapping H2D staging copies
+   * with the insert kernels.
+   *
+   * @note Unlike `insert_async`, the input range lives in (pageable) host memory. Elements are
+   * staged chunk-wise through internal pinned buffers and copied to the device on a second stream
+   * so that the copy of one chunk is hidden behind the insertion of the previous one.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator whose `value_type` is
+   * convertible to the container's `value_type`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of elements
+   * @param last End of the sequence of elements
+   * @param chunk_size Number of elements staged per copy/compute pipeline step
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt, typename Ref>
+  void insert_staged(
+    InputIt first, InputIt last, size_type chunk_size, Ref container_ref, cuda::stream_ref stream)
+  {
+    using input_type = typename std::iterator_traits<InputIt>::value_type;
+
+    auto const num_items = cuco::detail::distance(first, last);
+    if (num_items == 0) { return; }
+    CUCO_EXPECTS(chunk_size > 0, "Staging chunk size must be larger than zero");
+
+    using staging_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<input_type>;
+    auto staging_alloc = staging_allocator_type{this->allocator()};
+
+    input_type* h_staging[2];
+    input_type* d_staging[2];
+    cudaEvent_t h2d_done[2];
+    cudaEvent_t compute_done[2];
+    for (auto buffer = 0; buffer < 2; ++buffer) {
+      CUCO_CUDA_TRY(cudaMallocHost(&h_staging[buffer], sizeof(input_type) * chunk_size));
+      d_staging[buffer] = staging_alloc.allocate(chunk_size);
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&h2d_done[buffer], cudaEventDisableTiming));
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&compute_done[buffer], cudaEventDisableTiming));
+    }
+    cudaStream_t copy_stream;
+    CUCO_CUDA_TRY(cudaStreamCreateWithFlags(&copy_stream, cudaStreamNonBlocking));
+
+    auto const num_chunks =
+      cuco::detail::int_div_ceil(num_items, static_cast<index_type>(chunk_size));
+    for (index_type chunk = 0; chunk < num_chunks; ++chunk) {
+      auto const buffer = static_cast<int>(chunk % 2);
+      auto const offset = chunk * static_cast<index_type>(chunk_size);
+      auto const size   = std::min(static_cast<index_type>(chunk_size), num_items - offset);
+
+      if (chunk >= 2) {
+        // the pinned buffer may still feed an in-flight H2D copy and the device buffer may still
+        // feed the insert kernel of the chunk staged two steps ago
+        CUCO_CUDA_TRY(cudaEventSynchronize(h2d_done[buffer]));
+        CUCO_CUDA_TRY(cudaStreamWaitEvent(copy_stream, compute_done[buffer]));
+      }
+      std::copy(first + offset, first + offset + size, h_staging[buffer]);
+      CUCO_CUDA_TRY(cudaMemcpyAsync(d_staging[buffer],
+                                    h_staging[buffer],
+                                    sizeof(input_type) * size,
+                                    cudaMemcpyHostToDevice,
+                                    copy_stream));
+      CUCO_CUDA_TRY(cudaEventRecord(h2d_done[buffer], copy_stream));
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(stream.get(), h2d_done[buffer]));
+      this->insert_async(d_staging[buffer], d_staging[buffer] + size, container_ref, stream);
+      CUCO_CUDA_TRY(cudaEventRecord(compute_done[buffer], stream.get()));
+    }
+    stream.wait();
+
+    for (auto buffer = 0; buffer < 2; ++buffer) {
+      CUCO_CUDA_TRY(cudaEventDestroy(h2d_done[buffer]));
+      CUCO_CUDA_TRY(cudaEventDestroy(compute_done[buffer]));
+      CUCO_CUDA_TRY(cudaFreeHost(h_staging[buffer]));
+      staging_alloc.deallocate(d_staging[buffer], chunk_size);
+    }
+    CUCO_CUDA_TRY(cudaStreamDestroy(copy_stream));
+  }
+
+  /**
+   * @brief Indicates for all keys in the host range `[first, last)` whether they are contained in
+   * the container, writing the results to the host range starting at `output_begin`.
+   *
+   * @note Unlike `contains_async`, both the input and the output range live in (pageable) host
+   * memory. Chunks are staged through internal pinned buffers on a second stream so that the H2D
+   * and D2H copies of one chunk overlap with the probe kernel of another.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator
+   * @tparam OutputIt Host accessible random access output iterator assignable from `bool`
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param chunk_size Number of keys staged per copy/compute pipeline step
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for contains
+   */
+  template <typename InputIt, typename OutputIt, typename Ref>
+  void contains_staged(InputIt first,
+                       InputIt last,
+                       OutputIt output_begin,
+                       size_type chunk_size,
+                       Ref container_ref,
+                       cuda::stream_ref stream) const
+  {
+    using input_type = typename std::iterator_traits<InputIt>::value_type;
+
+    this->staged_apply(
+      first,
+      last,
+      output_begin,
+      chunk_size,
+      [&](input_type const* in, index_type n, auto* out, cuda::stream_ref s) {
+        this->contains_async(in, in + n, out, container_ref, s);
+      },
+      stream);
+  }
+
+  /**
+   * @brief For all keys in the host range `[first, last)`, finds a match with its key equivalent
+   * to the query key, writing the results to the host range starting at `output_begin`.
+   *
+   * @note Unlike `find_async`, both the input and the output range live in (pageable) host memory.
+   * Chunks are staged through internal pinned buffers on a second stream so that the H2D and D2H
+   * copies of one chunk overlap with the probe kernel of another.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator
+   * @tparam OutputIt Host accessible random access output iterator
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of matches retrieved for each key
+   * @param chunk_size Number of keys staged per copy/compute pipeline step
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for find
+   */
+  template <typename InputIt, typename OutputIt, typename Ref>
+  void find_staged(InputIt first,
+                   InputIt last,
+                   OutputIt output_begin,
+                   size_type chunk_size,
+                   Ref container_ref,
+                   cuda::stream_ref stream) const
+  {
+    using input_type = typename std::iterator_traits<InputIt>::value_type;
+
+    this->staged_apply(
+      first,
+      last,
+      output_begin,
+      chunk_size,
+      [&](input_type const* in, index_type n, auto* out, cuda::stream_ref s) {
+        this->find_async(in, in + n, out, container_ref, s);
+      },
+      stream);
+  }
+
+  /**
+   * @brief Counts the occurrences of keys in `[first, last)` contained in the container
+   *
+   * @tparam Input Device accessible input iterator
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param stream CUDA stream used for count
+   *
+   * @return The sum of total occurrences of all keys in `[first, last)`
+   */
+  template <typename InputIt, typename Ref>
+  [[nodiscard]] size_type count(InputIt first,
+                                InputIt last,
+                                Ref container_ref,
+                                cuda::stream_ref stream) const noexcept
+  {
+    auto constexpr is_outer = false;
+    return this->count<is_outer>(first, last, container_ref, stream);
+  }
+
+  /**
+   * @brief Counts the occurrences of keys in `[first, last)` contained in the container
+   *
+   * @note If a given key has no matches, its occurrence is 1.
+   *
+   * @tparam Input Device accessible input iterator
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param stream CUDA stream used for count
+   *
+   * @return The sum of total occurrences of all keys in `[first, last)`
+   */
+  template <typename InputIt, typename Ref>
+  [[nodiscard]] size_type count_outer(InputIt first,
+                                      InputIt last,
+                                      Ref container_ref,
+                                      cuda::stream_ref stream) const noexcept
+  {
+    auto constexpr is_outer = true;
+    return this->count<is_outer>(first, last, container_ref, stream);
+  }
+
+  /**
+   * @brief Retrieves all the matches of the probe keys in the range `[first, last)` contained in
+   * the container
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputProbeIt Device accessible output iterator of probe keys
+   * @tparam OutputMatchIt Device accessible output iterator of matched slots
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the output sequence of the probe keys of each match
+   * @param output_match Beginning of the output sequence of matched slots
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return Number of retrieved (probe key, matched slot) pairs
+   */
+  template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt, typename Ref>
+  [[nodiscard]] size_type retrieve(InputIt first,
+                                   InputIt last,
+                                   OutputProbeIt output_probe,
+                                   OutputMatchIt output_match,
+                                   Ref container_ref,
+                                   cuda::stream_ref stream) const
+  {
+    auto constexpr is_outer = false;
+    return this->retrieve<is_outer>(first, last, output_probe, output_match, container_ref, stream);
+  }
+
+  /**
+   * @brief Retrieves all the matches of the probe keys in the range `[first, last)` contained in
+   * the container
+   *
+   * @note This function synchronizes the given stream.
+   * @note A probe key without any match emits a single pair of the key and the empty key sentinel.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputProbeIt Device accessible output iterator of probe keys
+   * @tparam OutputMatchIt Device accessible output iterator of matched slots
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the output sequence of the probe keys of each match
+   * @param output_match Beginning of the output sequence of matched slots
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return Number of retrieved (probe key, matched slot) pairs
+   */
+  template <typename InputIt, typename OutputProbeIt, typename OutputMatchIt, typename Ref>
+  [[nodiscard]] size_type retrieve_outer(InputIt first,
+                                         InputIt last,
+                                         OutputProbeIt output_probe,
+                                         OutputMatchIt output_match,
+                                         Ref container_ref,
+                                         cuda::stream_ref stream) const
+  {
+    auto constexpr is_outer = true;
+    return this->retrieve<is_outer>(first, last, output_probe, output_match, container_ref, stream);
+  }
+
+  /**
+   * @brief Retrieves all keys contained in the container.
    *
    * @note This API synchronizes the given stream.
    * @note The order in which keys are returned is implementation defined and not guaranteed to be
@@ -698,6 +1442,72 @@ class open_addressing_impl {
     return output_begin + h_num_out;
   }
 
+  /**
+   * @brief Retrieves the contents of the filled slots of the next chunk of windows into a
+   * caller-provided buffer of bounded size.
+   *
+   * Starting at window index `window_offset`, as many consecutive windows are retrieved as are
+   * guaranteed to fit into `buffer_capacity` output slots, and `window_offset` is advanced past
+   * them. Repeated calls thus stream the whole table through a fixed buffer; the export is
+   * complete once `window_offset` has reached the total window count `capacity() / window_size`.
+   *
+   * @note This API synchronizes the given stream.
+   * @note The order in which slots are retrieved is implementation defined.
+   *
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * convertible from the container's `value_type`
+   *
+   * @param output_begin Beginning output iterator of the chunk buffer
+   * @param buffer_capacity Number of output slots the chunk buffer can hold
+   * @param window_offset Window index at which the chunk starts; advanced past the retrieved
+   * windows
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Number of retrieved slots
+   *
+   * @throw std::invalid_argument if `buffer_capacity` is smaller than `window_size`
+   */
+  template <typename OutputIt>
+  [[nodiscard]] size_type retrieve_chunk(OutputIt output_begin,
+                                         size_type buffer_capacity,
+                                         size_type& window_offset,
+                                         cuda::stream_ref stream) const
+  {
+    CUCO_EXPECTS(buffer_capacity >= static_cast<size_type>(window_size),
+                 "Buffer capacity must be able to hold at least one window.",
+                 std::invalid_argument);
+
+    auto const total_windows = static_cast<size_type>(storage_.num_windows());
+    if (window_offset >= total_windows) { return 0; }
+
+    auto const num_windows =
+      std::min<size_type>(buffer_capacity / window_size, total_windows - window_offset);
+    auto const num_slots = static_cast<cuco::detail::index_type>(num_windows) * window_size;
+
+    auto counter =
+      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+    counter.reset(stream);
+
+    auto const get_slot =
+      open_addressing_ns::detail::get_slot<has_payload, storage_ref_type>(this->storage_ref());
+    auto const is_filled = open_addressing_ns::detail::slot_is_filled<has_payload, key_type>{
+      this->empty_key_sentinel(), this->erased_key_sentinel()};
+
+    auto const grid_size = cuco::detail::grid_size(num_slots);
+
+    detail::retrieve_chunk<cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        get_slot,
+        static_cast<cuco::detail::index_type>(window_offset) * window_size,
+        num_slots,
+        is_filled,
+        output_begin,
+        counter.data());
+
+    window_offset += num_windows;
+    return counter.load_to_host(stream);
+  }
+
   /**
    * @brief Asynchronously applies the given function object `callback_op` to the copy of every
    * filled slot in the container
@@ -726,6 +1536,86 @@ class open_addressing_impl {
       storage_ref.data(), storage_ref.num_windows(), op, stream.get()));
   }
 
+  /**
+   * @brief Asynchronously applies `transform_op` to the copy of every filled slot in the container
+   * and reduces the transformed values to a single value using `reduce_op`.
+   *
+   * @note `reduce_op` must be commutative and associative, and `init` must be its identity
+   * element, since empty and erased slots contribute `init` to the reduction.
+   * @note The result is written to `output` in stream order, i.e. its content is undefined until
+   * all previously submitted work on `stream` has completed.
+   *
+   * @tparam T Type of the reduction result
+   * @tparam TransformOp Type of unary device function object transforming a filled slot into a `T`
+   * @tparam ReduceOp Type of commutative binary device function object combining two `T`s
+   *
+   * @param output Pointer to the device accessible result
+   * @param transform_op Function to apply to the copy of every filled slot
+   * @param init Identity element of `reduce_op` seeding the reduction
+   * @param reduce_op Function used to combine the transformed slot contents
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename T, typename TransformOp, typename ReduceOp>
+  void transform_reduce_async(T* output,
+                              TransformOp transform_op,
+                              T init,
+                              ReduceOp reduce_op,
+                              cuda::stream_ref stream) const
+  {
+    using temp_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<char>;
+
+    cuco::detail::index_type constexpr stride = std::numeric_limits<int32_t>::max();
+
+    auto const capacity   = static_cast<cuco::detail::index_type>(this->capacity());
+    auto const num_chunks = static_cast<int32_t>((capacity + stride - 1) / stride);
+
+    auto temp_allocator  = temp_allocator_type{this->allocator()};
+    auto const is_filled = open_addressing_ns::detail::slot_is_filled<has_payload, key_type>{
+      this->empty_key_sentinel(), this->erased_key_sentinel()};
+
+    auto const run_reduce = [&](auto begin, T* out, int32_t num_items) {
+      std::size_t temp_storage_bytes = 0;
+      CUCO_CUDA_TRY(cub::DeviceReduce::Reduce(
+        nullptr, temp_storage_bytes, begin, out, num_items, reduce_op, init, stream.get()));
+
+      // Allocate temporary storage
+      auto d_temp_storage = temp_allocator.allocate(temp_storage_bytes);
+
+      CUCO_CUDA_TRY(cub::DeviceReduce::Reduce(
+        d_temp_storage, temp_storage_bytes, begin, out, num_items, reduce_op, init, stream.get()));
+
+      temp_allocator.deallocate(d_temp_storage, temp_storage_bytes);
+    };
+
+    auto const chunk_begin = [&](cuco::detail::index_type offset) {
+      return thrust::make_transform_iterator(
+        thrust::counting_iterator{static_cast<size_type>(offset)},
+        open_addressing_ns::detail::
+          transform_filled_slot<storage_ref_type, decltype(is_filled), TransformOp, T>{
+            this->storage_ref(), is_filled, transform_op, init});
+    };
+
+    // TODO: PR #580 to be reverted once https://github.com/NVIDIA/cccl/issues/1422 is resolved
+    if (num_chunks == 1) {
+      run_reduce(chunk_begin(0), output, static_cast<int32_t>(capacity));
+      return;
+    }
+
+    auto d_partials = reinterpret_cast<T*>(std::allocator_traits<temp_allocator_type>::allocate(
+      temp_allocator, num_chunks * sizeof(T)));
+
+    for (int32_t chunk = 0; chunk < num_chunks; ++chunk) {
+      auto const offset    = chunk * stride;
+      auto const num_items = std::min(capacity - offset, stride);
+      run_reduce(chunk_begin(offset), d_partials + chunk, static_cast<int32_t>(num_items));
+    }
+    run_reduce(d_partials, output, num_chunks);
+
+    std::allocator_traits<temp_allocator_type>::deallocate(
+      temp_allocator, reinterpret_cast<char*>(d_partials), num_chunks * sizeof(T));
+  }
+
   /**
    * @brief For each key in the range [first, last), asynchronously applies the function object
    * `callback_op` to the copy of all corresponding matches found in the container.
@@ -770,6 +1660,8 @@ class open_addressing_impl {
    */
   [[nodiscard]] size_type size(cuda::stream_ref stream) const
   {
+    if (size_counter_) { return size_counter_->load_to_host(stream); }
+
     auto counter =
       detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
     counter.reset(stream);
@@ -787,6 +1679,121 @@ class open_addressing_impl {
     return counter.load_to_host(stream);
   }
 
+  /**
+   * @brief Takes a probing diagnostics snapshot of the container.
+   *
+   * Replays the cooperative probe sequence of every resident key and reports the resulting probe
+   * length distribution along with the fraction of slots occupied by erased sentinels.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream this operation is executed in
+   *
+   * @return The probing diagnostics snapshot
+   */
+  [[nodiscard]] probing_statistics probe_statistics(cuda::stream_ref stream) const
+  {
+    auto constexpr num_bins = cuco::probing_statistics::num_bins;
+    // one counter per histogram bin plus the maximum probe length and the erased slot count
+    auto constexpr num_counters = num_bins + 2;
+
+    using counter_type = cuda::atomic<size_type, thread_scope>;
+    using counter_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<counter_type>;
+    using counter_deleter_type = custom_deleter<std::size_t, counter_allocator_type>;
+
+    auto counter_allocator = counter_allocator_type{this->allocator()};
+    auto counter_deleter   = counter_deleter_type{num_counters, counter_allocator};
+    auto counters          = std::unique_ptr<counter_type, counter_deleter_type>{
+      counter_allocator.allocate(num_counters), counter_deleter};
+
+    static_assert(sizeof(size_type) == sizeof(counter_type));
+    CUCO_CUDA_TRY(
+      cudaMemsetAsync(counters.get(), 0, num_counters * sizeof(counter_type), stream.get()));
+
+    auto const num_slots =
+      static_cast<cuco::detail::index_type>(storage_.num_windows()) * window_size;
+    auto const grid_size = cuco::detail::grid_size(num_slots, cg_size);
+
+    detail::probe_statistics<has_payload, cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        storage_.ref(),
+        probing_scheme_,
+        this->empty_key_sentinel(),
+        this->erased_key_sentinel(),
+        static_cast<cuco::detail::index_type>(num_bins),
+        counters.get(),
+        counters.get() + num_bins,
+        counters.get() + num_bins + 1);
+
+    std::array<size_type, num_counters> h_counters{};
+    CUCO_CUDA_TRY(cudaMemcpyAsync(h_counters.data(),
+                                  counters.get(),
+                                  num_counters * sizeof(counter_type),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    stream.wait();
+
+    cuco::probing_statistics stats{};
+    for (std::size_t i = 0; i < num_bins; ++i) {
+      stats.histogram[i] = static_cast<std::size_t>(h_counters[i]);
+    }
+    stats.max_probe_length = static_cast<std::size_t>(h_counters[num_bins]);
+    stats.tombstone_fraction =
+      static_cast<double>(h_counters[num_bins + 1]) / static_cast<double>(this->capacity());
+    return stats;
+  }
+
+  /**
+   * @brief Enables counted mode, i.e., maintains the number of elements during bulk modify
+   * operations so that `size()` becomes a near-free read.
+   *
+   * In counted mode, the bulk `insert`, `insert_if`, `insert_and_find`, and `erase` code paths,
+   * as well as the map-only `insert_or_assign` and `insert_or_apply` code paths, update a striped
+   * set of privatized device counters. `size()` then lazily reduces the stripes instead of
+   * scanning the entire slot storage.
+   *
+   * @note This function synchronizes the given stream to capture the current size.
+   * @note Device-side modify operations performed through a container ref do not update the
+   * maintained counters. Behavior of `size()` is undefined if such operations were performed after
+   * counted mode was enabled.
+   *
+   * @param stream CUDA stream used to initialize the counters
+   */
+  void enable_counted_size(cuda::stream_ref stream)
+  {
+    if (size_counter_) { return; }
+    auto const current_size = this->size(stream);
+    size_counter_           = std::make_unique<size_counter_type>(this->allocator());
+    size_counter_->set(current_size, stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Disables counted mode. `size()` falls back to scanning the slot storage.
+   */
+  void disable_counted_size() noexcept { size_counter_.reset(); }
+
+  /**
+   * @brief Indicates whether counted mode is enabled.
+   *
+   * @return `true` iff the container maintains its size during bulk modify operations
+   */
+  [[nodiscard]] bool counted_size_enabled() const noexcept
+  {
+    return static_cast<bool>(size_counter_);
+  }
+
+  /**
+   * @brief Gets the striped size counters maintained in counted mode.
+   *
+   * @return Pointer to the first striped size counter, or `nullptr` if counted mode is disabled
+   */
+  [[nodiscard]] typename size_counter_type::value_type* size_stripes() const noexcept
+  {
+    return size_counter_ ? size_counter_->data() : nullptr;
+  }
+
   /**
    * @brief Regenerates the container
    *
@@ -889,6 +1896,91 @@ class open_addressing_impl {
       old_storage.ref(), container.ref(op::insert), is_filled);
   }
 
+  /**
+   * @brief Regenerates the container in place, reusing the existing allocation.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_in_place_async`.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param container The container to be rehashed
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Container>
+  void rehash_in_place(Container const& container, cuda::stream_ref stream)
+  {
+    this->rehash_in_place_async(container, stream);
+    stream.wait();
+  }
+
+  /**
+   * @brief Asynchronously regenerates the container in place, reusing the existing allocation.
+   *
+   * Unlike `rehash_async`, this function does not allocate a new slot storage, so peak memory
+   * usage stays at the container's capacity plus a chunk-sized scratch buffer instead of twice the
+   * capacity. The extent is unchanged; the primary use case is reclaiming `erased_key_sentinel`
+   * tombstones after heavy `erase` traffic to restore probe performance.
+   *
+   * The storage is migrated chunk by chunk: each chunk's filled slots are extracted to a scratch
+   * buffer, the chunk's windows are reset to the empty sentinel, and the buffered elements are
+   * re-inserted. Since extraction and re-insertion of a chunk are ordered on the given stream and
+   * `insert` de-duplicates, every element ends up in a slot reachable via its probe sequence.
+   *
+   * @note This function synchronizes the given stream before returning in order to safely
+   * deallocate the scratch buffer. All kernels are nevertheless launched in stream order.
+   *
+   * @tparam Container The container type this function operates on
+   *
+   * @param container The container to be rehashed
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename Container>
+  void rehash_in_place_async(Container const& container, cuda::stream_ref stream)
+  {
+    auto const num_windows = storage_.num_windows();
+    if (num_windows == 0) { return; }
+
+    using temp_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<value_type>;
+
+    // Chunk size bounds the scratch allocation to ~1/16th of the container's slot storage
+    auto const chunk_num_windows =
+      cuco::detail::int_div_ceil(static_cast<size_type>(num_windows), size_type{16});
+    auto const chunk_num_slots = chunk_num_windows * window_size;
+
+    auto temp_allocator = temp_allocator_type{this->allocator()};
+    auto buffer         = temp_allocator.allocate(chunk_num_slots);
+    auto buffer_counter =
+      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+
+    auto constexpr block_size = cuco::detail::default_block_size();
+    auto const is_filled      = open_addressing_ns::detail::slot_is_filled<has_payload, key_type>{
+      this->empty_key_sentinel(), this->erased_key_sentinel()};
+
+    for (size_type offset = 0; offset < static_cast<size_type>(num_windows);
+         offset += chunk_num_windows) {
+      auto const n = std::min(chunk_num_windows, static_cast<size_type>(num_windows) - offset);
+
+      buffer_counter.reset(stream);
+
+      auto const extract_grid_size = cuco::detail::grid_size(n, 1);
+      detail::extract_and_clear<block_size><<<extract_grid_size, block_size, 0, stream.get()>>>(
+        this->storage_ref(), offset, n, is_filled, empty_slot_sentinel_, buffer,
+        buffer_counter.data());
+
+      // The grid is sized for the worst case since the actual number of extracted slots is only
+      // known on the device
+      auto const insert_grid_size = cuco::detail::grid_size(chunk_num_slots, cg_size);
+      detail::insert_from_buffer<cg_size, block_size>
+        <<<insert_grid_size, block_size, 0, stream.get()>>>(
+          buffer, buffer_counter.data(), container.ref(op::insert));
+    }
+
+    stream.wait();
+    temp_allocator.deallocate(buffer, chunk_num_slots);
+  }
+
   /**
    * @brief Gets the maximum number of elements the container can hold.
    *
@@ -985,6 +2077,224 @@ class open_addressing_impl {
     return counter.load_to_host(stream);
   }
 
+  /**
+   * @brief Retrieves all the matches of the probe keys in the range `[first, last)` contained in
+   * the container
+   *
+   * @note If `IsOuter` is `true`, a probe key without any match emits a single pair of the key and
+   * the empty key sentinel.
+   *
+   * @tparam IsOuter Flag indicating whether it's an outer retrieve or not
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputProbeIt Device accessible output iterator of probe keys
+   * @tparam OutputMatchIt Device accessible output iterator of matched slots
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the output sequence of the probe keys of each match
+   * @param output_match Beginning of the output sequence of matched slots
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return Number of retrieved (probe key, matched slot) pairs
+   */
+  template <bool IsOuter,
+            typename InputIt,
+            typename OutputProbeIt,
+            typename OutputMatchIt,
+            typename Ref>
+  [[nodiscard]] size_type retrieve(InputIt first,
+                                   InputIt last,
+                                   OutputProbeIt output_probe,
+                                   OutputMatchIt output_match,
+                                   Ref container_ref,
+                                   cuda::stream_ref stream) const
+  {
+    auto const num_keys = cuco::detail::distance(first, last);
+    if (num_keys == 0) { return 0; }
+
+    auto counter =
+      detail::counter_storage<size_type, thread_scope, allocator_type>{this->allocator()};
+    counter.reset(stream);
+
+    auto const grid_size = cuco::detail::grid_size(num_keys, cg_size);
+
+    detail::retrieve<IsOuter, cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        first, num_keys, output_probe, output_match, counter.data(), container_ref);
+
+    return counter.load_to_host(stream);
+  }
+
+  /**
+   * @brief Asynchronously erases the contents of all filled slots satisfying `pred` in the windows
+   * `[window_offset, window_offset + num_windows)`.
+   *
+   * @tparam Predicate Type of unary predicate applied to the copy of every filled slot
+   * @tparam Ref Type of non-owning device container ref allowing access to storage
+   *
+   * @param pred Predicate selecting the slots to evict
+   * @param window_offset Index of the first window to sweep
+   * @param num_windows Number of windows to sweep
+   * @param num_evicted Counter incremented by the number of evicted slots, or `nullptr`
+   * @param container_ref Non-owning device container ref used to access the slot storage
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate, typename Ref>
+  void evict_windows_async(Predicate pred,
+                           size_type window_offset,
+                           size_type num_windows,
+                           cuda::atomic<size_type, thread_scope>* num_evicted,
+                           Ref container_ref,
+                           cuda::stream_ref stream)
+  {
+    CUCO_EXPECTS(this->empty_key_sentinel() != this->erased_key_sentinel(),
+                 "The empty key sentinel and erased key sentinel cannot be the same value.",
+                 std::logic_error);
+
+    if (num_windows == 0) { return; }
+
+    auto const grid_size = cuco::detail::grid_size(num_windows, cg_size);
+    auto const is_filled = open_addressing_ns::detail::slot_is_filled<has_payload, key_type>{
+      this->empty_key_sentinel(), this->erased_key_sentinel()};
+
+    detail::evict_if_n<cg_size, cuco::detail::default_block_size()>
+      <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+        storage_.ref(),
+        window_offset,
+        static_cast<cuco::detail::index_type>(num_windows),
+        is_filled,
+        pred,
+        num_evicted,
+        size_counter_ ? size_counter_->data() : nullptr,
+        num_size_stripes,
+        container_ref);
+  }
+
+  /**
+   * @brief Applies a device-side lookup operation to a host input range chunk-wise, overlapping
+   * the H2D and D2H staging copies with the probe kernels.
+   *
+   * Each chunk is copied from the host input range into a pinned staging buffer, transferred to a
+   * device buffer on an internal copy stream, processed by `async_op` on the given stream, and its
+   * results are transferred back and written to the host output range. Two buffer sets are cycled
+   * so that the copies of one chunk are hidden behind the kernel of another.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator
+   * @tparam OutputIt Host accessible random access output iterator
+   * @tparam AsyncOp Callable issuing the lookup kernel, invoked as `async_op(device_in, n,
+   * device_out, stream)`
+   *
+   * @param first Beginning of the host sequence of keys
+   * @param last End of the host sequence of keys
+   * @param output_begin Beginning of the host sequence of results
+   * @param chunk_size Number of keys staged per copy/compute pipeline step
+   * @param async_op Callable issuing the device-side lookup for one chunk
+   * @param stream CUDA stream used for the lookup kernels
+   */
+  template <typename InputIt, typename OutputIt, typename AsyncOp>
+  void staged_apply(InputIt first,
+                    InputIt last,
+                    OutputIt output_begin,
+                    size_type chunk_size,
+                    AsyncOp&& async_op,
+                    cuda::stream_ref stream) const
+  {
+    using input_type  = typename std::iterator_traits<InputIt>::value_type;
+    using output_type = typename std::iterator_traits<OutputIt>::value_type;
+
+    auto const num_keys = cuco::detail::distance(first, last);
+    if (num_keys == 0) { return; }
+    CUCO_EXPECTS(chunk_size > 0, "Staging chunk size must be larger than zero");
+
+    using input_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<input_type>;
+    using output_allocator_type =
+      typename std::allocator_traits<allocator_type>::template rebind_alloc<output_type>;
+    auto input_alloc  = input_allocator_type{this->allocator()};
+    auto output_alloc = output_allocator_type{this->allocator()};
+
+    input_type* h_in[2];
+    input_type* d_in[2];
+    output_type* d_out[2];
+    output_type* h_out[2];
+    cudaEvent_t h2d_done[2];
+    cudaEvent_t compute_done[2];
+    cudaEvent_t d2h_done[2];
+    index_type staged_size[2] = {0, 0};
+    for (auto buffer = 0; buffer < 2; ++buffer) {
+      CUCO_CUDA_TRY(cudaMallocHost(&h_in[buffer], sizeof(input_type) * chunk_size));
+      CUCO_CUDA_TRY(cudaMallocHost(&h_out[buffer], sizeof(output_type) * chunk_size));
+      d_in[buffer]  = input_alloc.allocate(chunk_size);
+      d_out[buffer] = output_alloc.allocate(chunk_size);
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&h2d_done[buffer], cudaEventDisableTiming));
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&compute_done[buffer], cudaEventDisableTiming));
+      CUCO_CUDA_TRY(cudaEventCreateWithFlags(&d2h_done[buffer], cudaEventDisableTiming));
+    }
+    cudaStream_t copy_stream;
+    CUCO_CUDA_TRY(cudaStreamCreateWithFlags(&copy_stream, cudaStreamNonBlocking));
+
+    auto const num_chunks =
+      cuco::detail::int_div_ceil(num_keys, static_cast<index_type>(chunk_size));
+    for (index_type chunk = 0; chunk < num_chunks; ++chunk) {
+      auto const buffer = static_cast<int>(chunk % 2);
+      auto const offset = chunk * static_cast<index_type>(chunk_size);
+      auto const size   = std::min(static_cast<index_type>(chunk_size), num_keys - offset);
+
+      if (chunk >= 2) {
+        // drain the chunk staged two steps ago; this also guarantees that all buffers of this set
+        // are idle since its D2H copy is ordered after its H2D copy and kernel
+        CUCO_CUDA_TRY(cudaEventSynchronize(d2h_done[buffer]));
+        std::copy(h_out[buffer],
+                  h_out[buffer] + staged_size[buffer],
+                  output_begin + (chunk - 2) * static_cast<index_type>(chunk_size));
+      }
+      std::copy(first + offset, first + offset + size, h_in[buffer]);
+      CUCO_CUDA_TRY(cudaMemcpyAsync(d_in[buffer],
+                                    h_in[buffer],
+                                    sizeof(input_type) * size,
+                                    cudaMemcpyHostToDevice,
+                                    copy_stream));
+      CUCO_CUDA_TRY(cudaEventRecord(h2d_done[buffer], copy_stream));
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(stream.get(), h2d_done[buffer]));
+      async_op(d_in[buffer], size, d_out[buffer], stream);
+      CUCO_CUDA_TRY(cudaEventRecord(compute_done[buffer], stream.get()));
+      CUCO_CUDA_TRY(cudaStreamWaitEvent(copy_stream, compute_done[buffer]));
+      CUCO_CUDA_TRY(cudaMemcpyAsync(h_out[buffer],
+                                    d_out[buffer],
+                                    sizeof(output_type) * size,
+                                    cudaMemcpyDeviceToHost,
+                                    copy_stream));
+      CUCO_CUDA_TRY(cudaEventRecord(d2h_done[buffer], copy_stream));
+      staged_size[buffer] = size;
+    }
+    for (index_type chunk = num_chunks > 2 ? num_chunks - 2 : 0; chunk < num_chunks; ++chunk) {
+      auto const buffer = static_cast<int>(chunk % 2);
+      CUCO_CUDA_TRY(cudaEventSynchronize(d2h_done[buffer]));
+      std::copy(h_out[buffer],
+                h_out[buffer] + staged_size[buffer],
+                output_begin + chunk * static_cast<index_type>(chunk_size));
+    }
+    stream.wait();
+
+    for (auto buffer = 0; buffer < 2; ++buffer) {
+      CUCO_CUDA_TRY(cudaEventDestroy(h2d_done[buffer]));
+      CUCO_CUDA_TRY(cudaEventDestroy(compute_done[buffer]));
+      CUCO_CUDA_TRY(cudaEventDestroy(d2h_done[buffer]));
+      CUCO_CUDA_TRY(cudaFreeHost(h_in[buffer]));
+      CUCO_CUDA_TRY(cudaFreeHost(h_out[buffer]));
+      input_alloc.deallocate(d_in[buffer], chunk_size);
+      output_alloc.deallocate(d_out[buffer], chunk_size);
+    }
+    CUCO_CUDA_TRY(cudaStreamDestroy(copy_stream));
+  }
+
   /**
    * @brief Extracts the key from a given slot.
    *
@@ -1008,6 +2318,10 @@ class open_addressing_impl {
   key_equal predicate_;                 ///< Key equality binary predicate
   probing_scheme_type probing_scheme_;  ///< Probing scheme
   storage_type storage_;                ///< Slot window storage
+  /// Striped size counters, non-null iff counted mode is enabled
+  std::unique_ptr<size_counter_type> size_counter_{};
+  /// Window index at which the next incremental eviction sweep resumes
+  size_type sweep_offset_ = 0;
 };
 
 }  // namespace detail
@@ -21,6 +21,7 @@
 #include <cuco/extent.cuh>
 #include <cuco/pair.cuh>
 #include <cuco/probing_scheme.cuh>
+#include <cuco/tagged_aow_storage.cuh>
 
 #include <cuda/atomic>
 #include <cuda/std/type_traits>
@@ -28,6 +29,7 @@
 #include <thrust/tuple.h>
 #if defined(CUCO_HAS_CUDA_BARRIER)
 #include <cuda/barrier>
+#include <cuda/pipeline>
 #endif
 
 #include <cooperative_groups.h>
@@ -365,6 +367,7 @@ class open_addressing_ref_impl {
     auto const val    = this->heterogeneous_value(value);
     auto const key    = this->extract_key(val);
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -390,7 +393,10 @@ class open_addressing_ref_impl {
               }
             }
             case insert_result::CONTINUE: continue;
-            case insert_result::SUCCESS: return true;
+            case insert_result::SUCCESS: {
+              this->publish_tag(*probing_iter, intra_window_index, tag);
+              return true;
+            }
           }
         }
       }
@@ -415,6 +421,7 @@ class open_addressing_ref_impl {
     auto const val    = this->heterogeneous_value(value);
     auto const key    = this->extract_key(val);
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -455,7 +462,12 @@ class open_addressing_ref_impl {
             : insert_result::CONTINUE;
 
         switch (group.shfl(status, src_lane)) {
-          case insert_result::SUCCESS: return true;
+          case insert_result::SUCCESS: {
+            if (group.thread_rank() == src_lane) {
+              this->publish_tag(*probing_iter, intra_window_index, tag);
+            }
+            return true;
+          }
           case insert_result::DUPLICATE: {
             if constexpr (allows_duplicates) {
               [[fallthrough]];
@@ -500,6 +512,7 @@ class open_addressing_ref_impl {
     auto const val    = this->heterogeneous_value(value);
     auto const key    = this->extract_key(val);
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -524,6 +537,7 @@ class open_addressing_ref_impl {
                 // wait to ensure that the write to the value part also took place
                 this->wait_for_payload((window_ptr + i)->second, this->empty_value_sentinel());
               }
+              this->publish_tag(*probing_iter, i, tag);
               return {iterator{&window_ptr[i]}, true};
             }
             case insert_result::DUPLICATE: {
@@ -571,6 +585,7 @@ class open_addressing_ref_impl {
     auto const val    = this->heterogeneous_value(value);
     auto const key    = this->extract_key(val);
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
       auto const window_slots = storage_ref_[*probing_iter];
@@ -619,6 +634,7 @@ class open_addressing_ref_impl {
                 // wait to ensure that the write to the value part also took place
                 this->wait_for_payload(slot_ptr->second, this->empty_value_sentinel());
               }
+              this->publish_tag(*probing_iter, intra_window_index, tag);
             }
             group.sync();
             return {iterator{reinterpret_cast<value_type*>(res)}, true};
@@ -754,8 +770,19 @@ class open_addressing_ref_impl {
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
+      if constexpr (detail::has_window_tags_v<storage_ref_type>) {
+        // Skip loading the full window unless a fingerprint matches
+        auto const [any_match, any_empty] = this->filter_window_tags(*probing_iter, tag);
+        if (not any_match) {
+          if (any_empty) { return false; }
+          ++probing_iter;
+          continue;
+        }
+      }
+
       // TODO atomic_ref::load if insert operator is present
       auto const window_slots = storage_ref_[*probing_iter];
 
@@ -788,8 +815,19 @@ class open_addressing_ref_impl {
     cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
   {
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
+      if constexpr (detail::has_window_tags_v<storage_ref_type>) {
+        // Skip loading the full windows unless a fingerprint matches in any of them
+        auto const [any_match, any_empty] = this->filter_window_tags(*probing_iter, tag);
+        if (not group.any(any_match)) {
+          if (group.any(any_empty)) { return false; }
+          ++probing_iter;
+          continue;
+        }
+      }
+
       auto const window_slots = storage_ref_[*probing_iter];
 
       auto const state = [&]() {
@@ -808,6 +846,140 @@ class open_addressing_ref_impl {
     }
   }
 
+#if defined(CUCO_HAS_CUDA_BARRIER)
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container.
+   *
+   * Software-pipelined variant of `contains`: while the current probe window is compared, the
+   * window of the following probing step is asynchronously prefetched into a caller-provided
+   * shared memory double buffer, overlapping the global memory latency of multi-step probe chains.
+   *
+   * @note `buffer` must point to two windows of shared memory exclusively owned by the calling
+   * thread.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   * @param buffer Shared memory double buffer used for window prefetching
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains_pipelined(ProbeKey const& key,
+                                                   window_type* buffer) const noexcept
+  {
+    static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
+    auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    auto pipeline     = cuda::make_pipeline();
+
+    auto const prefetch = [&](size_type window_idx, int32_t stage) {
+      pipeline.producer_acquire();
+      cuda::memcpy_async(buffer + stage,
+                         storage_ref_.data() + window_idx,
+                         cuda::aligned_size_t<alignof(window_type)>{sizeof(window_type)},
+                         pipeline);
+      pipeline.producer_commit();
+    };
+
+    int32_t stage = 0;
+    prefetch(*probing_iter, stage);
+
+    while (true) {
+      auto next_iter = probing_iter;
+      ++next_iter;
+      prefetch(*next_iter, stage ^ 1);
+
+      cuda::pipeline_consumer_wait_prior<1>(pipeline);
+      auto const window_slots = buffer[stage];
+      pipeline.consumer_release();
+
+      for (auto& slot_content : window_slots) {
+        auto const res =
+          this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot_content));
+        if (res == detail::equal_result::UNEQUAL) { continue; }
+        // drain the in-flight prefetch so the buffer can be reused for the next probe key
+        cuda::pipeline_consumer_wait_prior<0>(pipeline);
+        pipeline.consumer_release();
+        return res == detail::equal_result::EQUAL;
+      }
+
+      probing_iter = next_iter;
+      stage ^= 1;
+    }
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container.
+   *
+   * Software-pipelined variant of the group `contains`: while the current probe window is
+   * compared, each thread asynchronously prefetches the window of its following probing step into
+   * a caller-provided shared memory double buffer, overlapping the global memory latency of
+   * multi-step probe chains.
+   *
+   * @note `buffer` must point to two windows of shared memory exclusively owned by the calling
+   * thread.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group contains
+   * @param key The key to search for
+   * @param buffer Shared memory double buffer used for window prefetching
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains_pipelined(
+    cooperative_groups::thread_block_tile<cg_size> const& group,
+    ProbeKey const& key,
+    window_type* buffer) const noexcept
+  {
+    auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    auto pipeline     = cuda::make_pipeline();
+
+    auto const prefetch = [&](size_type window_idx, int32_t stage) {
+      pipeline.producer_acquire();
+      cuda::memcpy_async(buffer + stage,
+                         storage_ref_.data() + window_idx,
+                         cuda::aligned_size_t<alignof(window_type)>{sizeof(window_type)},
+                         pipeline);
+      pipeline.producer_commit();
+    };
+
+    int32_t stage = 0;
+    prefetch(*probing_iter, stage);
+
+    while (true) {
+      auto next_iter = probing_iter;
+      ++next_iter;
+      prefetch(*next_iter, stage ^ 1);
+
+      cuda::pipeline_consumer_wait_prior<1>(pipeline);
+      auto const window_slots = buffer[stage];
+      pipeline.consumer_release();
+
+      auto const state = [&]() {
+        auto res = detail::equal_result::UNEQUAL;
+        for (auto& slot : window_slots) {
+          res = this->predicate_.operator()<is_insert::NO>(key, this->extract_key(slot));
+          if (res != detail::equal_result::UNEQUAL) { return res; }
+        }
+        return res;
+      }();
+
+      auto const found = group.any(state == detail::equal_result::EQUAL);
+      if (found or group.any(state == detail::equal_result::EMPTY)) {
+        // drain the in-flight prefetch so the buffer can be reused for the next probe key
+        cuda::pipeline_consumer_wait_prior<0>(pipeline);
+        pipeline.consumer_release();
+        return found;
+      }
+
+      probing_iter = next_iter;
+      stage ^= 1;
+    }
+  }
+#endif  // end CUCO_HAS_CUDA_BARRIER
+
   /**
    * @brief Counts the occurrence of a given key contained in the container
    *
@@ -895,8 +1067,19 @@ class open_addressing_ref_impl {
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
     auto probing_iter = probing_scheme_(key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
+      if constexpr (detail::has_window_tags_v<storage_ref_type>) {
+        // Skip loading the full window unless a fingerprint matches
+        auto const [any_match, any_empty] = this->filter_window_tags(*probing_iter, tag);
+        if (not any_match) {
+          if (any_empty) { return this->end(); }
+          ++probing_iter;
+          continue;
+        }
+      }
+
       // TODO atomic_ref::load if insert operator is present
       auto const window_slots = storage_ref_[*probing_iter];
 
@@ -934,8 +1117,19 @@ class open_addressing_ref_impl {
     cooperative_groups::thread_block_tile<cg_size> const& group, ProbeKey const& key) const noexcept
   {
     auto probing_iter = probing_scheme_(group, key, storage_ref_.window_extent());
+    [[maybe_unused]] auto const tag = this->probe_tag(key);
 
     while (true) {
+      if constexpr (detail::has_window_tags_v<storage_ref_type>) {
+        // Skip loading the full windows unless a fingerprint matches in any of them
+        auto const [any_match, any_empty] = this->filter_window_tags(*probing_iter, tag);
+        if (not group.any(any_match)) {
+          if (group.any(any_empty)) { return this->end(); }
+          ++probing_iter;
+          continue;
+        }
+      }
+
       auto const window_slots = storage_ref_[*probing_iter];
 
       auto const [state, intra_window_index] = [&]() {
@@ -1427,6 +1621,75 @@ class open_addressing_ref_impl {
     } while (cuco::detail::bitwise_compare(current, sentinel));
   }
 
+  /**
+   * @brief Computes the fingerprint tag of the probe key.
+   *
+   * @note This function is only meaningful if the storage provides per-slot fingerprint tags and
+   * requires the probing scheme to expose its (first) hasher via `hash_function()`.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The probe key
+   *
+   * @return The fingerprint tag of the probe key
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ constexpr auto probe_tag(ProbeKey const& key) const noexcept
+  {
+    if constexpr (detail::has_window_tags_v<storage_ref_type>) {
+      return storage_ref_type::make_tag(probing_scheme_.hash_function()(key));
+    } else {
+      return std::uint8_t{};
+    }
+  }
+
+  /**
+   * @brief Inspects the fingerprint tags of the window at the given index.
+   *
+   * @note This function is only available if the storage provides per-slot fingerprint tags.
+   *
+   * @tparam Tag Fingerprint tag type
+   *
+   * @param window_index Index of the window to inspect
+   * @param tag Fingerprint tag of the probe key
+   *
+   * @return A pair of flags denoting whether any tag in the window matches the probe tag and
+   * whether the window contains any empty tag
+   */
+  template <typename Tag>
+  [[nodiscard]] __device__ constexpr cuco::pair<bool, bool> filter_window_tags(
+    size_type window_index, Tag tag) const noexcept
+  {
+    auto const window_tags = storage_ref_.tag_window(window_index);
+    bool any_match         = false;
+    bool any_empty         = false;
+#pragma unroll
+    for (int32_t i = 0; i < window_size; ++i) {
+      any_match = any_match or (window_tags[i] == tag);
+      any_empty = any_empty or (window_tags[i] == storage_ref_type::empty_tag);
+    }
+    return {any_match, any_empty};
+  }
+
+  /**
+   * @brief Publishes the fingerprint tag of a newly inserted key.
+   *
+   * @note This function is a no-op if the storage does not provide per-slot fingerprint tags.
+   *
+   * @param window_index Index of the window the key was inserted into
+   * @param intra_window_index Position of the key within the window
+   * @param tag Fingerprint tag of the inserted key
+   */
+  template <typename Tag>
+  __device__ constexpr void publish_tag(size_type window_index,
+                                        int32_t intra_window_index,
+                                        Tag tag) noexcept
+  {
+    if constexpr (detail::has_window_tags_v<storage_ref_type>) {
+      storage_ref_.tags()[window_index * window_size + intra_window_index] = tag;
+    }
+  }
+
   // TODO: Clean up the sentinel handling since it's duplicated in ref and equal wrapper
   value_type empty_slot_sentinel_;  ///< Sentinel value indicating an empty slot
   detail::equal_wrapper<key_type, key_equal> predicate_;  ///< Key equality binary callable
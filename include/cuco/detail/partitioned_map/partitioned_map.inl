@@ -0,0 +1,515 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/utils.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <cuda_runtime_api.h>
+
+#include <cstdint>
+#include <utility>
+
+namespace cuco {
+namespace detail {
+
+/// Seed decorrelating the partitioner hash from the probing hash
+static constexpr std::uint32_t partitioner_seed = 0xcafef00d;
+
+/**
+ * @brief Functor computing the owning partition of a key-value pair.
+ *
+ * @tparam Hash Partitioner hash type
+ */
+template <typename Hash>
+struct pair_partition_index {
+  Hash hash;                ///< Partitioner hash
+  int32_t num_partitions;   ///< Number of partitions
+
+  /**
+   * @brief Computes the partition index of the given slot.
+   *
+   * @tparam Slot Key-value pair type
+   *
+   * @param slot The slot content
+   *
+   * @return The owning partition index
+   */
+  template <typename Slot>
+  __device__ int32_t operator()(Slot const& slot) const
+  {
+    return static_cast<int32_t>(hash(slot.first) % num_partitions);
+  }
+};
+
+/**
+ * @brief Functor computing the owning partition of a key.
+ *
+ * @tparam Hash Partitioner hash type
+ */
+template <typename Hash>
+struct key_partition_index {
+  Hash hash;                ///< Partitioner hash
+  int32_t num_partitions;   ///< Number of partitions
+
+  /**
+   * @brief Computes the partition index of the given key.
+   *
+   * @tparam ProbeKey Key type
+   *
+   * @param key The query key
+   *
+   * @return The owning partition index
+   */
+  template <typename ProbeKey>
+  __device__ int32_t operator()(ProbeKey const& key) const
+  {
+    return static_cast<int32_t>(hash(key) % num_partitions);
+  }
+};
+
+/**
+ * @brief RAII helper restoring the calling thread's current CUDA device.
+ */
+class current_device_guard {
+ public:
+  current_device_guard() { CUCO_CUDA_TRY(cudaGetDevice(&device_)); }
+  ~current_device_guard() { cudaSetDevice(device_); }
+
+  current_device_guard(current_device_guard const&)            = delete;
+  current_device_guard& operator=(current_device_guard const&) = delete;
+
+  /**
+   * @brief Gets the device that was current at construction.
+   *
+   * @return The saved device ordinal
+   */
+  [[nodiscard]] int device() const noexcept { return device_; }
+
+ private:
+  int device_;  ///< Saved device ordinal
+};
+
+}  // namespace detail
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::partitioned_map(
+  std::vector<int> devices,
+  size_type capacity,
+  empty_key<Key> empty_key_sentinel,
+  empty_value<T> empty_value_sentinel,
+  KeyEqual const& pred,
+  ProbingScheme const& probing_scheme,
+  cuda_thread_scope<Scope> scope,
+  Storage storage,
+  Allocator const& alloc)
+  : devices_{std::move(devices)}
+{
+  CUCO_EXPECTS(not devices_.empty(), "Device list must not be empty");
+
+  auto const num_parts   = devices_.size();
+  auto const subcapacity = (capacity + num_parts - 1) / num_parts;
+
+  detail::current_device_guard device_guard{};
+
+  for (std::size_t p = 0; p < num_parts; ++p) {
+    CUCO_CUDA_TRY(cudaSetDevice(devices_[p]));
+
+    // best-effort peer access; unsupported pairs fall back to staging through host memory
+    for (std::size_t q = 0; q < num_parts; ++q) {
+      if (q == p) { continue; }
+      if (cudaDeviceEnablePeerAccess(devices_[q], 0) != cudaSuccess) { cudaGetLastError(); }
+    }
+
+    cudaStream_t partition_stream;
+    CUCO_CUDA_TRY(cudaStreamCreateWithFlags(&partition_stream, cudaStreamNonBlocking));
+    streams_.push_back(partition_stream);
+
+    cudaEvent_t partition_event;
+    CUCO_CUDA_TRY(cudaEventCreateWithFlags(&partition_event, cudaEventDisableTiming));
+    events_.push_back(partition_event);
+
+    submaps_.push_back(std::make_unique<map_type>(subcapacity,
+                                                  empty_key_sentinel,
+                                                  empty_value_sentinel,
+                                                  pred,
+                                                  probing_scheme,
+                                                  scope,
+                                                  storage,
+                                                  alloc,
+                                                  cuda::stream_ref{partition_stream}));
+    CUCO_CUDA_TRY(cudaStreamSynchronize(partition_stream));
+  }
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::~partitioned_map()
+{
+  int current_device;
+  cudaGetDevice(&current_device);
+  for (std::size_t p = 0; p < devices_.size(); ++p) {
+    cudaSetDevice(devices_[p]);
+    submaps_[p].reset();
+    cudaEventDestroy(events_[p]);
+    cudaStreamDestroy(streams_[p]);
+  }
+  cudaSetDevice(current_device);
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert(
+  InputIt first, InputIt last, cuda::stream_ref stream)
+{
+  auto const num = cuco::detail::distance(first, last);
+  if (num == 0) { return; }
+
+  auto const num_parts = static_cast<int32_t>(devices_.size());
+  auto const policy    = thrust::cuda::par.on(stream.get());
+
+  detail::current_device_guard device_guard{};
+  auto const source_device = device_guard.device();
+
+  value_type* staged;
+  int32_t* part_ids;
+  CUCO_CUDA_TRY(cudaMallocAsync(&staged, sizeof(value_type) * num, stream.get()));
+  CUCO_CUDA_TRY(cudaMallocAsync(&part_ids, sizeof(int32_t) * num, stream.get()));
+
+  // bucket the input by owning partition on the calling device
+  thrust::copy(policy, first, last, staged);
+  thrust::transform(policy,
+                    staged,
+                    staged + num,
+                    part_ids,
+                    detail::pair_partition_index<partitioner_hash_type>{
+                      partitioner_hash_type{detail::partitioner_seed}, num_parts});
+  thrust::sort_by_key(policy, part_ids, part_ids + num, staged);
+
+  std::vector<cuco::detail::index_type> offsets(num_parts + 1);
+  {
+    cuco::detail::index_type* d_offsets;
+    CUCO_CUDA_TRY(
+      cudaMallocAsync(&d_offsets, sizeof(cuco::detail::index_type) * (num_parts + 1), stream.get()));
+    thrust::lower_bound(policy,
+                        part_ids,
+                        part_ids + num,
+                        thrust::counting_iterator<int32_t>{0},
+                        thrust::counting_iterator<int32_t>{num_parts + 1},
+                        d_offsets);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                                  d_offsets,
+                                  sizeof(cuco::detail::index_type) * (num_parts + 1),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    CUCO_CUDA_TRY(cudaFreeAsync(d_offsets, stream.get()));
+    // the sync also orders the peer copies below after the bucketing
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream.get()));
+  }
+
+  for (int32_t p = 0; p < num_parts; ++p) {
+    auto const count = offsets[p + 1] - offsets[p];
+    if (count == 0) { continue; }
+
+    CUCO_CUDA_TRY(cudaSetDevice(devices_[p]));
+    value_type* remote;
+    CUCO_CUDA_TRY(cudaMallocAsync(&remote, sizeof(value_type) * count, streams_[p]));
+    CUCO_CUDA_TRY(cudaMemcpyPeerAsync(remote,
+                                      devices_[p],
+                                      staged + offsets[p],
+                                      source_device,
+                                      sizeof(value_type) * count,
+                                      streams_[p]));
+    submaps_[p]->insert_async(remote, remote + count, cuda::stream_ref{streams_[p]});
+    CUCO_CUDA_TRY(cudaFreeAsync(remote, streams_[p]));
+  }
+
+  for (int32_t p = 0; p < num_parts; ++p) {
+    CUCO_CUDA_TRY(cudaStreamSynchronize(streams_[p]));
+  }
+
+  CUCO_CUDA_TRY(cudaSetDevice(source_device));
+  CUCO_CUDA_TRY(cudaFreeAsync(staged, stream.get()));
+  CUCO_CUDA_TRY(cudaFreeAsync(part_ids, stream.get()));
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains(
+  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream)
+{
+  this->partitioned_lookup<bool>(
+    first,
+    last,
+    output_begin,
+    [this](int32_t p,
+           key_type const* keys,
+           cuco::detail::index_type n,
+           bool* out,
+           cudaStream_t partition_stream) {
+      submaps_[p]->contains_async(keys, keys + n, out, cuda::stream_ref{partition_stream});
+    },
+    stream);
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find(
+  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream)
+{
+  this->partitioned_lookup<mapped_type>(
+    first,
+    last,
+    output_begin,
+    [this](int32_t p,
+           key_type const* keys,
+           cuco::detail::index_type n,
+           mapped_type* out,
+           cudaStream_t partition_stream) {
+      submaps_[p]->find_async(keys, keys + n, out, cuda::stream_ref{partition_stream});
+    },
+    stream);
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename OutT, typename InputIt, typename OutputIt, typename IssueOp>
+void partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  partitioned_lookup(
+    InputIt first, InputIt last, OutputIt output_begin, IssueOp&& issue_op, cuda::stream_ref stream)
+{
+  auto const num = cuco::detail::distance(first, last);
+  if (num == 0) { return; }
+
+  auto const num_parts = static_cast<int32_t>(devices_.size());
+  auto const policy    = thrust::cuda::par.on(stream.get());
+
+  detail::current_device_guard device_guard{};
+  auto const source_device = device_guard.device();
+
+  key_type* keys;
+  cuco::detail::index_type* perm;
+  int32_t* part_ids;
+  OutT* results;
+  CUCO_CUDA_TRY(cudaMallocAsync(&keys, sizeof(key_type) * num, stream.get()));
+  CUCO_CUDA_TRY(cudaMallocAsync(&perm, sizeof(cuco::detail::index_type) * num, stream.get()));
+  CUCO_CUDA_TRY(cudaMallocAsync(&part_ids, sizeof(int32_t) * num, stream.get()));
+  CUCO_CUDA_TRY(cudaMallocAsync(&results, sizeof(OutT) * num, stream.get()));
+
+  // bucket the keys by owning partition, remembering their original positions
+  thrust::copy(policy, first, last, keys);
+  thrust::sequence(policy, perm, perm + num);
+  thrust::transform(policy,
+                    keys,
+                    keys + num,
+                    part_ids,
+                    detail::key_partition_index<partitioner_hash_type>{
+                      partitioner_hash_type{detail::partitioner_seed}, num_parts});
+  thrust::sort_by_key(
+    policy, part_ids, part_ids + num, thrust::make_zip_iterator(thrust::make_tuple(keys, perm)));
+
+  std::vector<cuco::detail::index_type> offsets(num_parts + 1);
+  {
+    cuco::detail::index_type* d_offsets;
+    CUCO_CUDA_TRY(
+      cudaMallocAsync(&d_offsets, sizeof(cuco::detail::index_type) * (num_parts + 1), stream.get()));
+    thrust::lower_bound(policy,
+                        part_ids,
+                        part_ids + num,
+                        thrust::counting_iterator<int32_t>{0},
+                        thrust::counting_iterator<int32_t>{num_parts + 1},
+                        d_offsets);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(offsets.data(),
+                                  d_offsets,
+                                  sizeof(cuco::detail::index_type) * (num_parts + 1),
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    CUCO_CUDA_TRY(cudaFreeAsync(d_offsets, stream.get()));
+    // the sync also orders the peer copies below after the bucketing
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream.get()));
+  }
+
+  for (int32_t p = 0; p < num_parts; ++p) {
+    auto const count = offsets[p + 1] - offsets[p];
+    if (count == 0) { continue; }
+
+    CUCO_CUDA_TRY(cudaSetDevice(devices_[p]));
+    key_type* remote_keys;
+    OutT* remote_results;
+    CUCO_CUDA_TRY(cudaMallocAsync(&remote_keys, sizeof(key_type) * count, streams_[p]));
+    CUCO_CUDA_TRY(cudaMallocAsync(&remote_results, sizeof(OutT) * count, streams_[p]));
+    CUCO_CUDA_TRY(cudaMemcpyPeerAsync(remote_keys,
+                                      devices_[p],
+                                      keys + offsets[p],
+                                      source_device,
+                                      sizeof(key_type) * count,
+                                      streams_[p]));
+    issue_op(p, remote_keys, count, remote_results, streams_[p]);
+    CUCO_CUDA_TRY(cudaMemcpyPeerAsync(results + offsets[p],
+                                      source_device,
+                                      remote_results,
+                                      devices_[p],
+                                      sizeof(OutT) * count,
+                                      streams_[p]));
+    CUCO_CUDA_TRY(cudaFreeAsync(remote_keys, streams_[p]));
+    CUCO_CUDA_TRY(cudaFreeAsync(remote_results, streams_[p]));
+    CUCO_CUDA_TRY(cudaEventRecord(events_[p], streams_[p]));
+  }
+
+  CUCO_CUDA_TRY(cudaSetDevice(source_device));
+  for (int32_t p = 0; p < num_parts; ++p) {
+    if (offsets[p + 1] - offsets[p] == 0) { continue; }
+    CUCO_CUDA_TRY(cudaStreamWaitEvent(stream.get(), events_[p]));
+  }
+
+  // undo the bucketing permutation
+  thrust::scatter(policy, results, results + num, perm, output_begin);
+
+  CUCO_CUDA_TRY(cudaFreeAsync(keys, stream.get()));
+  CUCO_CUDA_TRY(cudaFreeAsync(perm, stream.get()));
+  CUCO_CUDA_TRY(cudaFreeAsync(part_ids, stream.get()));
+  CUCO_CUDA_TRY(cudaFreeAsync(results, stream.get()));
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+typename partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size() const
+{
+  detail::current_device_guard device_guard{};
+
+  size_type total{0};
+  for (std::size_t p = 0; p < devices_.size(); ++p) {
+    CUCO_CUDA_TRY(cudaSetDevice(devices_[p]));
+    total += submaps_[p]->size(cuda::stream_ref{streams_[p]});
+  }
+  return total;
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+typename partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::capacity()
+  const noexcept
+{
+  size_type total{0};
+  for (auto const& submap : submaps_) {
+    total += submap->capacity();
+  }
+  return total;
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+typename partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::num_partitions()
+  const noexcept
+{
+  return devices_.size();
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::clear()
+{
+  detail::current_device_guard device_guard{};
+
+  for (std::size_t p = 0; p < devices_.size(); ++p) {
+    CUCO_CUDA_TRY(cudaSetDevice(devices_[p]));
+    submaps_[p]->clear(cuda::stream_ref{streams_[p]});
+  }
+}
+
+template <class Key,
+          class T,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+typename partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::mapped_type
+partitioned_map<Key, T, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::empty_value_sentinel()
+  const noexcept
+{
+  return submaps_.front()->empty_value_sentinel();
+}
+
+}  // namespace cuco
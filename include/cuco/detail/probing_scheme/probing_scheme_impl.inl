@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cuco/detail/utils.cuh>
+#include <cuco/extent.cuh>
 #include <cuco/pair.cuh>
 
 namespace cuco {
@@ -127,6 +128,12 @@ __host__ __device__ constexpr auto linear_probing<CGSize, Hash>::operator()(
     upper_bound};
 }
 
+template <int32_t CGSize, typename Hash>
+__host__ __device__ constexpr Hash linear_probing<CGSize, Hash>::hash_function() const noexcept
+{
+  return hash_;
+}
+
 template <int32_t CGSize, typename Hash1, typename Hash2>
 __host__ __device__ constexpr double_hashing<CGSize, Hash1, Hash2>::double_hashing(
   Hash1 const& hash1, Hash2 const& hash2)
@@ -169,11 +176,19 @@ __host__ __device__ constexpr auto double_hashing<CGSize, Hash1, Hash2>::operato
   ProbeKey const& probe_key, Extent upper_bound) const noexcept
 {
   using size_type = typename Extent::value_type;
-  return detail::probing_iterator<Extent>{
-    cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
-    cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound - 1) +
-      1,  // step size in range [1, prime - 1]
-    upper_bound};
+  if constexpr (cuco::detail::is_power_of_two_window_extent_v<Extent>) {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
+      (cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % upper_bound) |
+        1,  // odd step size is coprime with the power-of-two extent, preserving full-cycle probing
+      upper_bound};
+  } else {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(hash1_(probe_key)) % upper_bound,
+      cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound - 1) +
+        1,  // step size in range [1, prime - 1]
+      upper_bound};
+  }
 }
 
 template <int32_t CGSize, typename Hash1, typename Hash2>
@@ -184,12 +199,30 @@ __host__ __device__ constexpr auto double_hashing<CGSize, Hash1, Hash2>::operato
   Extent upper_bound) const noexcept
 {
   using size_type = typename Extent::value_type;
-  return detail::probing_iterator<Extent>{
-    cuco::detail::sanitize_hash<size_type>(g, hash1_(probe_key)) % upper_bound,
-    static_cast<size_type>(
-      (cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound / cg_size - 1) +
-       1) *
-      cg_size),
-    upper_bound};  // TODO use fast_int operator
+  if constexpr (cuco::detail::is_power_of_two_window_extent_v<Extent>) {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(g, hash1_(probe_key)) % upper_bound,
+      static_cast<size_type>(
+        ((cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) &
+          (upper_bound / cg_size - 1)) |
+         1) *  // odd CG step count is coprime with the power-of-two number of CG-sized strides
+        cg_size),
+      upper_bound};
+  } else {
+    return detail::probing_iterator<Extent>{
+      cuco::detail::sanitize_hash<size_type>(g, hash1_(probe_key)) % upper_bound,
+      static_cast<size_type>(
+        (cuco::detail::sanitize_hash<size_type>(hash2_(probe_key)) % (upper_bound / cg_size - 1) +
+         1) *
+        cg_size),
+      upper_bound};  // TODO use fast_int operator
+  }
+}
+
+template <int32_t CGSize, typename Hash1, typename Hash2>
+__host__ __device__ constexpr Hash1 double_hashing<CGSize, Hash1, Hash2>::hash_function()
+  const noexcept
+{
+  return hash1_;
 }
 }  // namespace cuco
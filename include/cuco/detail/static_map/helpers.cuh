@@ -31,12 +31,16 @@ namespace cuco::static_map_ns::detail {
  * convertible to the `value_type` of the data structure
  * @tparam Init Type of init value convertible to payload type
  * @tparam Op Callable type used to peform `apply` operation.
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param last End of the sequence of input elements
  * @param init The init value of the `op`
  * @param op Callable object to perform apply operation.
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
  * @param ref Non-owning container device ref used to access the slot storage
  * @param stream CUDA stream used for insert_or_apply operation
  */
@@ -46,9 +50,16 @@ template <bool HasInit,
           typename InputIt,
           typename Init,
           typename Op,
+          typename AtomicT,
           typename Ref>
-void dispatch_insert_or_apply(
-  InputIt first, InputIt last, Init init, Op op, Ref ref, cuda::stream_ref stream)
+void dispatch_insert_or_apply(InputIt first,
+                              InputIt last,
+                              Init init,
+                              Op op,
+                              AtomicT* size_stripes,
+                              int32_t num_stripes,
+                              Ref ref,
+                              cuda::stream_ref stream)
 {
   auto const num = cuco::detail::distance(first, last);
   if (num == 0) { return; }
@@ -85,6 +96,7 @@ void dispatch_insert_or_apply(
                                                               InputIt,
                                                               Init,
                                                               Op,
+                                                              AtomicT,
                                                               Ref>;
 
     int32_t const max_op_grid_size =
@@ -100,16 +112,16 @@ void dispatch_insert_or_apply(
     if (num_elements_per_thread > 2) {
       insert_or_apply_shmem<HasInit, CGSize, shmem_block_size, shared_map_ref_type>
         <<<shmem_grid_size, shmem_block_size, 0, stream.get()>>>(
-          first, num, init, op, ref, window_extent);
+          first, num, init, op, size_stripes, num_stripes, ref, window_extent);
     } else {
       insert_or_apply<HasInit, CGSize, cuco::detail::default_block_size()>
         <<<default_grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-          first, num, init, op, ref);
+          first, num, init, op, size_stripes, num_stripes, ref);
     }
   } else {
     insert_or_apply<HasInit, CGSize, cuco::detail::default_block_size()>
       <<<default_grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-        first, num, init, op, ref);
+        first, num, init, op, size_stripes, num_stripes, ref);
   }
 }
 }  // namespace cuco::static_map_ns::detail
\ No newline at end of file
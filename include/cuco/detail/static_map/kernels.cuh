@@ -42,31 +42,48 @@ CUCO_SUPPRESS_KERNEL_WARNINGS
  * @tparam BlockSize Number of threads in each block
  * @tparam InputIt Device accessible input iterator whose `value_type` is
  * convertible to the `value_type` of the data structure
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
  * @param ref Non-owning container device ref used to access the slot storage
  */
-template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename Ref>
-CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_assign(InputIt first,
-                                                               cuco::detail::index_type n,
-                                                               Ref ref)
+template <int32_t CGSize, int32_t BlockSize, typename InputIt, typename AtomicT, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_assign(
+  InputIt first, cuco::detail::index_type n, AtomicT* size_stripes, int32_t num_stripes, Ref ref)
 {
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_successes = 0;
+
   auto const loop_stride = cuco::detail::grid_stride() / CGSize;
   auto idx               = cuco::detail::global_thread_id() / CGSize;
 
   while (idx < n) {
     typename std::iterator_traits<InputIt>::value_type const& insert_pair = *(first + idx);
     if constexpr (CGSize == 1) {
-      ref.insert_or_assign(insert_pair);
+      if (ref.insert_or_assign(insert_pair)) { thread_num_successes++; }
     } else {
       auto const tile =
         cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
-      ref.insert_or_assign(tile, insert_pair);
+      if (ref.insert_or_assign(tile, insert_pair) and tile.thread_rank() == 0) {
+        thread_num_successes++;
+      }
     }
     idx += loop_stride;
   }
+
+  // compute number of newly inserted elements for each block and add to the container-maintained
+  // size stripes
+  auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+  if (threadIdx.x == 0 and size_stripes != nullptr) {
+    size_stripes[blockIdx.x % num_stripes].fetch_add(block_num_successes,
+                                                     cuda::std::memory_order_relaxed);
+  }
 }
 
 /**
@@ -88,12 +105,16 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_assign(InputIt first,
  * convertible to the `value_type` of the data structure
  * @tparam Init Type of init value convertible to payload type
  * @tparam Op Callable type used to peform `apply` operation.
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param init The init value of the op
  * @param op Callable object to perform apply operation.
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
  * @param ref Non-owning container device ref used to access the slot storage
  */
 template <bool HasInit,
@@ -102,33 +123,54 @@ template <bool HasInit,
           typename InputIt,
           typename Init,
           typename Op,
+          typename AtomicT,
           typename Ref>
-__global__ void insert_or_apply(
-  InputIt first, cuco::detail::index_type n, [[maybe_unused]] Init init, Op op, Ref ref)
+__global__ void insert_or_apply(InputIt first,
+                                cuco::detail::index_type n,
+                                [[maybe_unused]] Init init,
+                                Op op,
+                                AtomicT* size_stripes,
+                                int32_t num_stripes,
+                                Ref ref)
 {
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  typename Ref::size_type thread_num_successes = 0;
+
   auto const loop_stride = cuco::detail::grid_stride() / CGSize;
   auto idx               = cuco::detail::global_thread_id() / CGSize;
 
   while (idx < n) {
     using value_type              = typename std::iterator_traits<InputIt>::value_type;
     value_type const& insert_pair = *(first + idx);
+    bool inserted                 = false;
     if constexpr (CGSize == 1) {
       if constexpr (HasInit) {
-        ref.insert_or_apply(insert_pair, init, op);
+        inserted = ref.insert_or_apply(insert_pair, init, op);
       } else {
-        ref.insert_or_apply(insert_pair, op);
+        inserted = ref.insert_or_apply(insert_pair, op);
       }
+      if (inserted) { thread_num_successes++; }
     } else {
       auto const tile =
         cooperative_groups::tiled_partition<CGSize>(cooperative_groups::this_thread_block());
       if constexpr (HasInit) {
-        ref.insert_or_apply(tile, insert_pair, init, op);
+        inserted = ref.insert_or_apply(tile, insert_pair, init, op);
       } else {
-        ref.insert_or_apply(tile, insert_pair, op);
+        inserted = ref.insert_or_apply(tile, insert_pair, op);
       }
+      if (inserted and tile.thread_rank() == 0) { thread_num_successes++; }
     }
     idx += loop_stride;
   }
+
+  // compute number of newly inserted elements for each block and add to the container-maintained
+  // size stripes
+  auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+  if (threadIdx.x == 0 and size_stripes != nullptr) {
+    size_stripes[blockIdx.x % num_stripes].fetch_add(block_num_successes,
+                                                     cuda::std::memory_order_relaxed);
+  }
 }
 
 /**
@@ -142,6 +184,10 @@ __global__ void insert_or_apply(
  * @note If `HasInit` is `true` and if `init == empty_sentinel_value`, we directly
  * `apply` the `op` instead of atomic store and then waiting for the payload to get materalized.
  * This has potential speedups when insert strategy is not `packed_cas`.
+ * @note Once the block-local cardinality exceeds the threshold, the policy depends on how well the
+ * current epoch aggregated: if at least half of the processed elements were merged, the shared map
+ * is flushed and reset and pre-aggregation continues (skewed inputs stay in the fast path);
+ * otherwise the remaining elements are applied to the global map directly.
  *
  * @tparam HasInit Boolean to dispatch based on init parameter
  * @tparam CGSize Number of threads in each CG
@@ -151,12 +197,16 @@ __global__ void insert_or_apply(
  * convertible to the `value_type` of the data structure
  * @tparam Init Type of init value convertible to payload type
  * @tparam Op Callable type used to peform `apply` operation.
+ * @tparam AtomicT Atomic counter type
  * @tparam Ref Type of non-owning device ref allowing access to storage
  *
  * @param first Beginning of the sequence of input elements
  * @param n Number of input elements
  * @param init The init value of the op
  * @param op Callable object to perform apply operation.
+ * @param size_stripes Striped size counters maintained by the container, or `nullptr` if the
+ * container does not track its size
+ * @param num_stripes Number of striped size counters
  * @param ref Non-owning container device ref used to access the slot storage
  * @param window_extent Window Extent used for shared memory map slot storage
  */
@@ -167,12 +217,15 @@ template <bool HasInit,
           class InputIt,
           class Init,
           class Op,
+          class AtomicT,
           class Ref>
 CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply_shmem(
   InputIt first,
   cuco::detail::index_type n,
   [[maybe_unused]] Init init,
   Op op,
+  AtomicT* size_stripes,
+  int32_t num_stripes,
   Ref ref,
   typename SharedMapRefType::extent_type window_extent)
 {
@@ -210,6 +263,29 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply_shmem(
   shared_map_ref.initialize(block);
   block.sync();
 
+  // number of new elements this thread inserted into the global map; the shared-map
+  // pre-aggregation itself never changes the global size
+  typename Ref::size_type thread_num_successes = 0;
+
+  auto const flush_shared_map = [&]() {
+    auto window_idx = thread_idx;
+    while (window_idx < num_windows) {
+      auto const slot = storage[window_idx][0];
+      if (not cuco::detail::bitwise_compare(slot.first, ref.empty_key_sentinel())) {
+        bool global_inserted = false;
+        if constexpr (HasInit) {
+          global_inserted = ref.insert_or_apply(slot, init, op);
+        } else {
+          global_inserted = ref.insert_or_apply(slot, op);
+        }
+        if (global_inserted) { thread_num_successes++; }
+      }
+      window_idx += BlockSize;
+    }
+  };
+
+  bool fallback                            = false;
+  cuco::detail::index_type epoch_processed = 0;
   while ((idx - thread_idx / CGSize) < n) {
     int32_t inserted         = 0;
     int32_t warp_cardinality = 0;
@@ -228,38 +304,55 @@ CUCO_KERNEL __launch_bounds__(BlockSize) void insert_or_apply_shmem(
     if (warp_thread_idx == 0) {
       block_cardinality.fetch_add(warp_cardinality, cuda::memory_order_relaxed);
     }
+    epoch_processed += BlockSize;
     block.sync();
-    if (block_cardinality > BlockSize) { break; }
+    auto const cardinality = block_cardinality.load(cuda::memory_order_relaxed);
+    if (cardinality > BlockSize) {
+      // unique-heavy epochs gain nothing from staging: fall back to the global map
+      if (2 * static_cast<cuco::detail::index_type>(cardinality) > epoch_processed) {
+        fallback = true;
+        break;
+      }
+      // the epoch aggregated well, i.e., the input is skewed: flush the merged partials and keep
+      // pre-aggregating in shared memory
+      flush_shared_map();
+      block.sync();
+      shared_map_ref.initialize(block);
+      if (thread_idx == 0) { block_cardinality.store(0, cuda::memory_order_relaxed); }
+      epoch_processed = 0;
+      block.sync();
+    }
     idx += loop_stride;
   }
 
   // insert-or-apply from shared map to global map
-  auto window_idx = thread_idx;
-  while (window_idx < num_windows) {
-    auto const slot = storage[window_idx][0];
-    if (not cuco::detail::bitwise_compare(slot.first, ref.empty_key_sentinel())) {
-      if constexpr (HasInit) {
-        ref.insert_or_apply(slot, init, op);
-      } else {
-        ref.insert_or_apply(slot, op);
-      }
-    }
-    window_idx += BlockSize;
-  }
+  flush_shared_map();
 
-  // insert-or-apply into global map for the remaining elements whose block_cardinality
-  // exceeds the cardinality threshold.
-  if (block_cardinality > BlockSize) {
+  // insert-or-apply into global map for the remaining elements after shared-memory
+  // pre-aggregation was abandoned due to poor aggregation
+  if (fallback) {
     idx += loop_stride;
     while (idx < n) {
       value_type const& insert_pair = *(first + idx);
+      bool global_inserted          = false;
       if constexpr (HasInit) {
-        ref.insert_or_apply(insert_pair, init, op);
+        global_inserted = ref.insert_or_apply(insert_pair, init, op);
       } else {
-        ref.insert_or_apply(insert_pair, op);
+        global_inserted = ref.insert_or_apply(insert_pair, op);
       }
+      if (global_inserted) { thread_num_successes++; }
       idx += loop_stride;
     }
   }
+
+  // compute number of newly inserted elements for each block and add to the container-maintained
+  // size stripes
+  using BlockReduce = cub::BlockReduce<typename Ref::size_type, BlockSize>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  auto const block_num_successes = BlockReduce(temp_storage).Sum(thread_num_successes);
+  if (threadIdx.x == 0 and size_stripes != nullptr) {
+    size_stripes[blockIdx.x % num_stripes].fetch_add(block_num_successes,
+                                                     cuda::std::memory_order_relaxed);
+  }
 }
 }  // namespace cuco::static_map_ns::detail
\ No newline at end of file
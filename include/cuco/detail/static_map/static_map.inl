@@ -117,6 +117,81 @@ constexpr static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator,
 {
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  static_map(std::byte const* serialized,
+             Extent capacity,
+             empty_key<Key> empty_key_sentinel,
+             empty_value<T> empty_value_sentinel,
+             erased_key<Key> erased_key_sentinel,
+             KeyEqual const& pred,
+             ProbingScheme const& probing_scheme,
+             cuda_thread_scope<Scope>,
+             Storage,
+             Allocator const& alloc,
+             cuda::stream_ref stream)
+  : impl_{std::make_unique<impl_type>(serialized,
+                                      capacity,
+                                      cuco::pair{empty_key_sentinel, empty_value_sentinel},
+                                      erased_key_sentinel,
+                                      pred,
+                                      probing_scheme,
+                                      alloc,
+                                      stream)},
+    empty_value_sentinel_{empty_value_sentinel}
+{
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+constexpr std::size_t
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::serialized_size()
+  const noexcept
+{
+  return impl_->serialized_size();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::serialize(
+  std::byte* buffer, cuda::stream_ref stream) const
+{
+  impl_->serialize(buffer, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  serialize_async(std::byte* buffer, cuda::stream_ref stream) const
+{
+  impl_->serialize_async(buffer, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -176,6 +251,39 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->insert_async(first, last, ref(op::insert), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  insert_bounded_async(InputIt first,
+                       size_type const* num_items,
+                       size_type max_num_items,
+                       cuda::stream_ref stream) noexcept
+{
+  impl_->insert_bounded_async(first, num_items, max_num_items, ref(op::insert), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::insert_staged(
+  InputIt first, InputIt last, size_type chunk_size, cuda::stream_ref stream)
+{
+  impl_->insert_staged(first, last, chunk_size, ref(op::insert), stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -286,7 +394,7 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
 
   static_map_ns::detail::insert_or_assign<cg_size, cuco::detail::default_block_size()>
     <<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
-      first, num, ref(op::insert_or_assign));
+      first, num, impl_->size_stripes(), impl_type::num_size_stripes, ref(op::insert_or_assign));
 }
 
 template <class Key,
@@ -336,7 +444,14 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   auto constexpr has_init = false;
   auto const init = this->empty_value_sentinel();  // use empty_sentinel as unused init value
   static_map_ns::detail::dispatch_insert_or_apply<has_init, cg_size, Allocator>(
-    first, last, init, op, ref(op::insert_or_apply), stream);
+    first,
+    last,
+    init,
+    op,
+    impl_->size_stripes(),
+    impl_type::num_size_stripes,
+    ref(op::insert_or_apply),
+    stream);
 }
 
 template <class Key,
@@ -354,7 +469,14 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
 {
   auto constexpr has_init = true;
   static_map_ns::detail::dispatch_insert_or_apply<has_init, cg_size, Allocator>(
-    first, last, init, op, ref(op::insert_or_apply), stream);
+    first,
+    last,
+    init,
+    op,
+    impl_->size_stripes(),
+    impl_type::num_size_stripes,
+    ref(op::insert_or_apply),
+    stream);
 }
 
 template <class Key,
@@ -388,6 +510,52 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->erase_async(first, last, ref(op::erase), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename Predicate>
+typename static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::evict_if(
+  Predicate pred, cuda::stream_ref stream)
+{
+  return impl_->evict_if(pred, ref(op::erase), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename Predicate>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::evict_if_async(
+  Predicate pred, cuda::stream_ref stream)
+{
+  impl_->evict_if_async(pred, ref(op::erase), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename Predicate>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  sweep_evict_async(Predicate pred, size_type num_windows, cuda::stream_ref stream)
+{
+  impl_->sweep_evict_async(pred, num_windows, ref(op::erase), stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -419,6 +587,45 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->contains_async(first, last, output_begin, ref(op::contains), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bounded_async(InputIt first,
+                         size_type const* num_keys,
+                         size_type max_num_keys,
+                         OutputIt output_begin,
+                         cuda::stream_ref stream) const noexcept
+{
+  impl_->contains_bounded_async(
+    first, num_keys, max_num_keys, output_begin, ref(op::contains), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_staged(InputIt first,
+                  InputIt last,
+                  OutputIt output_begin,
+                  size_type chunk_size,
+                  cuda::stream_ref stream) const
+{
+  impl_->contains_staged(first, last, output_begin, chunk_size, ref(op::contains), stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -460,6 +667,83 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask(InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream)
+    const
+{
+  contains_bitmask_async(first, last, output_begin, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask_async(InputIt first,
+                         InputIt last,
+                         OutputIt output_begin,
+                         cuda::stream_ref stream) const noexcept
+{
+  impl_->contains_bitmask_async(first, last, output_begin, ref(op::contains), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask_if(InputIt first,
+                      InputIt last,
+                      StencilIt stencil,
+                      Predicate pred,
+                      OutputIt output_begin,
+                      cuda::stream_ref stream) const
+{
+  contains_bitmask_if_async(first, last, stencil, pred, output_begin, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask_if_async(InputIt first,
+                            InputIt last,
+                            StencilIt stencil,
+                            Predicate pred,
+                            OutputIt output_begin,
+                            cuda::stream_ref stream) const noexcept
+{
+  impl_->contains_bitmask_if_async(
+    first, last, stencil, pred, output_begin, ref(op::contains), stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -491,6 +775,64 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->find_async(first, last, output_begin, ref(op::find), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename FoundIt, typename MissingIt>
+typename static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_partitioned(
+  InputIt first,
+  InputIt last,
+  FoundIt found_begin,
+  MissingIt missing_begin,
+  cuda::stream_ref stream) const
+{
+  return impl_->find_partitioned(first, last, found_begin, missing_begin, ref(op::find), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  find_bounded_async(InputIt first,
+                     size_type const* num_keys,
+                     size_type max_num_keys,
+                     OutputIt output_begin,
+                     cuda::stream_ref stream) const
+{
+  impl_->find_bounded_async(first, num_keys, max_num_keys, output_begin, ref(op::find), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::find_staged(
+  InputIt first,
+  InputIt last,
+  OutputIt output_begin,
+  size_type chunk_size,
+  cuda::stream_ref stream) const
+{
+  impl_->find_staged(first, last, output_begin, chunk_size, ref(op::find), stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -522,6 +864,25 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   impl_->for_each_async(std::forward<CallbackOp>(callback_op), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename ResultT, typename TransformOp, typename ReduceOp>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  transform_reduce_async(ResultT* output,
+                         TransformOp transform_op,
+                         ResultT init,
+                         ReduceOp reduce_op,
+                         cuda::stream_ref stream) const
+{
+  impl_->transform_reduce_async(output, transform_op, init, reduce_op, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -575,6 +936,27 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   return std::make_pair(keys_out + num, values_out + num);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename KeyOut, typename ValueOut>
+typename static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_chunk(
+  KeyOut keys_out,
+  ValueOut values_out,
+  size_type buffer_capacity,
+  size_type& window_offset,
+  cuda::stream_ref stream) const
+{
+  auto const zipped_out_begin = thrust::make_zip_iterator(thrust::make_tuple(keys_out, values_out));
+  return impl_->retrieve_chunk(zipped_out_begin, buffer_capacity, window_offset, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -633,6 +1015,34 @@ void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stora
   this->impl_->rehash_async(extent, *this, stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_in_place(cuda::stream_ref stream)
+{
+  this->impl_->rehash_in_place(*this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_in_place_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_in_place_async(*this, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -648,6 +1058,63 @@ static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
   return impl_->size(stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  enable_counted_size(cuda::stream_ref stream)
+{
+  impl_->enable_counted_size(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  disable_counted_size() noexcept
+{
+  impl_->disable_counted_size();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  counted_size_enabled() const noexcept
+{
+  return impl_->counted_size_enabled();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+probing_statistics
+static_map<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::probe_statistics(
+  cuda::stream_ref stream) const
+{
+  return impl_->probe_statistics(stream);
+}
+
 template <class Key,
           class T,
           class Extent,
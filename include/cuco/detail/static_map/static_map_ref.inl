@@ -433,9 +433,12 @@ class operator_impl<
    * @tparam Value Input type which is convertible to 'value_type'
    *
    * @param value The element to insert
+   *
+   * @return Returns `true` if the given `value` is inserted as a new element, `false` if an
+   * existing element was assigned instead
    */
   template <typename Value>
-  __device__ void insert_or_assign(Value const& value) noexcept
+  __device__ bool insert_or_assign(Value const& value) noexcept
   {
     static_assert(cg_size == 1, "Non-CG operation is incompatible with the current probing scheme");
 
@@ -460,10 +463,13 @@ class operator_impl<
         if (eq_res == detail::equal_result::EQUAL) {
           cuda::atomic_ref<mapped_type, Scope> payload_ref(slot_ptr->second);
           payload_ref.store(val.second, cuda::memory_order_relaxed);
-          return;
+          return false;
         }
         if (eq_res == detail::equal_result::AVAILABLE) {
-          if (attempt_insert_or_assign(slot_ptr, val)) { return; }
+          auto const status = attempt_insert_or_assign(slot_ptr, val);
+          if (status != detail::insert_result::CONTINUE) {
+            return status == detail::insert_result::SUCCESS;
+          }
         }
       }
       ++probing_iter;
@@ -480,9 +486,12 @@ class operator_impl<
    *
    * @param group The Cooperative Group used to perform group insert
    * @param value The element to insert
+   *
+   * @return Returns `true` if the given `value` is inserted as a new element, `false` if an
+   * existing element was assigned instead
    */
   template <typename Value>
-  __device__ void insert_or_assign(cooperative_groups::thread_block_tile<cg_size> const& group,
+  __device__ bool insert_or_assign(cooperative_groups::thread_block_tile<cg_size> const& group,
                                    Value const& value) noexcept
   {
     ref_type& ref_ = static_cast<ref_type&>(*this);
@@ -518,17 +527,22 @@ class operator_impl<
           payload_ref.store(val.second, cuda::memory_order_relaxed);
         }
         group.sync();
-        return;
+        return false;
       }
 
       auto const group_contains_available = group.ballot(state == detail::equal_result::AVAILABLE);
       if (group_contains_available) {
         auto const src_lane = __ffs(group_contains_available) - 1;
-        auto const status =
-          (group.thread_rank() == src_lane) ? attempt_insert_or_assign(slot_ptr, val) : false;
+        auto const status   = (group.thread_rank() == src_lane)
+                                ? attempt_insert_or_assign(slot_ptr, val)
+                                : detail::insert_result::CONTINUE;
 
         // Exit if inserted or assigned
-        if (group.shfl(status, src_lane)) { return; }
+        switch (group.shfl(status, src_lane)) {
+          case detail::insert_result::SUCCESS: return true;
+          case detail::insert_result::DUPLICATE: return false;
+          default: continue;
+        }
       } else {
         ++probing_iter;
       }
@@ -548,10 +562,13 @@ class operator_impl<
    * @param group The Cooperative Group used to perform group insert
    * @param value The element to insert
    *
-   * @return Returns `true` if the given `value` is inserted or `value` has a match in the map.
+   * @return `insert_result::SUCCESS` if the given `value` is inserted as a new element,
+   * `insert_result::DUPLICATE` if `value` has a match in the map and its payload was assigned,
+   * `insert_result::CONTINUE` otherwise.
    */
   template <typename Value>
-  __device__ constexpr bool attempt_insert_or_assign(value_type* slot, Value const& value) noexcept
+  __device__ constexpr detail::insert_result attempt_insert_or_assign(value_type* slot,
+                                                                      Value const& value) noexcept
   {
     ref_type& ref_    = static_cast<ref_type&>(*this);
     auto expected_key = ref_.impl_.empty_slot_sentinel().first;
@@ -566,9 +583,9 @@ class operator_impl<
       // Update payload
       cuda::atomic_ref<mapped_type, Scope> payload_ref(slot->second);
       payload_ref.store(value.second, cuda::memory_order_relaxed);
-      return true;
+      return success ? detail::insert_result::SUCCESS : detail::insert_result::DUPLICATE;
     }
-    return false;
+    return detail::insert_result::CONTINUE;
   }
 };
 
@@ -1184,6 +1201,59 @@ class operator_impl<
     auto const& ref_ = static_cast<ref_type const&>(*this);
     return ref_.impl_.contains(group, key);
   }
+
+#if defined(CUCO_HAS_CUDA_BARRIER)
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container.
+   *
+   * Software-pipelined variant of `contains` that prefetches the next probe window into a
+   * caller-provided shared memory double buffer while the current one is compared.
+   *
+   * @note `buffer` must point to two windows of shared memory exclusively owned by the calling
+   * thread.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   * @param buffer Shared memory double buffer used for window prefetching
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains_pipelined(
+    ProbeKey const& key, typename base_type::window_type* buffer) const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.impl_.contains_pipelined(key, buffer);
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container.
+   *
+   * Software-pipelined variant of the group `contains` that prefetches the next probe window into
+   * a caller-provided shared memory double buffer while the current one is compared.
+   *
+   * @note `buffer` must point to two windows of shared memory exclusively owned by the calling
+   * thread.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group contains
+   * @param key The key to search for
+   * @param buffer Shared memory double buffer used for window prefetching
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains_pipelined(
+    cooperative_groups::thread_block_tile<cg_size> const& group,
+    ProbeKey const& key,
+    typename base_type::window_type* buffer) const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.impl_.contains_pipelined(group, key, buffer);
+  }
+#endif  // end CUCO_HAS_CUDA_BARRIER
 };
 
 template <typename Key,
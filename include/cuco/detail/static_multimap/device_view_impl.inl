@@ -456,6 +456,7 @@ class static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view_
   using mapped_type    = typename device_view_impl_base::mapped_type;
   using iterator       = typename device_view_impl_base::iterator;
   using const_iterator = typename device_view_impl_base::const_iterator;
+  using joined_type    = cuco::pair<std::size_t, Value>;  ///< Probe-index/payload pair type
 
   __host__ __device__ device_view_impl(pair_atomic_type* slots,
                                        std::size_t capacity,
@@ -567,6 +568,51 @@ class static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view_
     }
   }
 
+  /**
+   * @brief Flushes per-CG buffer of joined results into the output sequence, honoring the
+   * caller-provided output capacity.
+   *
+   * Works like `flush_output_buffer` but clamps the writes so that no element is stored past
+   * `output_capacity`. The global match counter is still advanced by the full `num_outputs` so
+   * that the host can detect truncation and report the required output size.
+   *
+   * @tparam CG Cooperative Group type
+   * @tparam atomicT Type of atomic storage
+   * @tparam OutputIt Device accessible output iterator whose `value_type` is
+   * constructible from `joined_type`
+   * @param g The Cooperative Group used to flush output buffer
+   * @param num_outputs Number of valid output in the buffer
+   * @param output_buffer Buffer of the probe-index/payload pair sequence
+   * @param num_matches Size of the output sequence
+   * @param output_capacity Maximum number of joined pairs the output sequence can hold
+   * @param output_begin Beginning of the output sequence of joined pairs
+   */
+  template <typename CG, typename atomicT, typename OutputIt>
+  __device__ __forceinline__ void flush_join_buffer(CG const& g,
+                                                    uint32_t const num_outputs,
+                                                    joined_type* output_buffer,
+                                                    atomicT* num_matches,
+                                                    std::size_t output_capacity,
+                                                    OutputIt output_begin) noexcept
+  {
+    std::size_t offset;
+    const auto lane_id = g.thread_rank();
+    if (0 == lane_id) {
+      offset = num_matches->fetch_add(num_outputs, cuda::std::memory_order_relaxed);
+    }
+    offset = g.shfl(offset, 0);
+
+    auto const num_writes =
+      offset < output_capacity
+        ? (num_outputs < output_capacity - offset ? num_outputs
+                                                  : static_cast<uint32_t>(output_capacity - offset))
+        : 0u;
+
+    for (auto index = lane_id; index < num_writes; index += g.size()) {
+      *(output_begin + offset + index) = output_buffer[index];
+    }
+  }
+
   /**
    * @brief Indicates whether the probe `element` exists in the map using vector loads.
    *
@@ -1004,6 +1050,113 @@ class static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view_
     }  // while running
   }
 
+  /**
+   * @brief Retrieves all joined probe-index/payload pairs of a given key using vector loads with
+   * per-flushing-CG shared memory buffer, writing at most `output_capacity` pairs.
+   *
+   * For key `k` existing in the map, stores a pair of `probe_idx` and each associated payload to
+   * unspecified locations in the output. Unlike `retrieve`, the writes are bounded by
+   * `output_capacity`: matches beyond it are dropped but still counted in `num_matches`.
+   *
+   * @tparam buffer_size Size of the output buffer
+   * @tparam FlushingCG Type of Cooperative Group used to flush output buffer
+   * @tparam ProbingCG Type of Cooperative Group used to retrieve
+   * @tparam atomicT Type of atomic storage
+   * @tparam OutputIt Device accessible output iterator whose `value_type` is
+   * constructible from `joined_type`
+   * @param flushing_cg The Cooperative Group used to flush output buffer
+   * @param probing_cg The Cooperative Group used to retrieve
+   * @param probe_idx Index of the probe key in the input sequence
+   * @param k The key to search for
+   * @param flushing_cg_counter Pointer to the flushing cg counter
+   * @param output_buffer Shared memory buffer of the probe-index/payload pair sequence
+   * @param num_matches Size of the output sequence
+   * @param output_capacity Maximum number of joined pairs the output sequence can hold
+   * @param output_begin Beginning of the output sequence of joined pairs
+   * @param key_equal The binary callable used to compare two keys
+   * for equality
+   */
+  template <uint32_t buffer_size,
+            typename FlushingCG,
+            typename ProbingCG,
+            typename atomicT,
+            typename OutputIt,
+            typename KeyEqual>
+  __device__ __forceinline__ void join_retrieve(FlushingCG const& flushing_cg,
+                                                ProbingCG const& probing_cg,
+                                                std::size_t probe_idx,
+                                                Key const& k,
+                                                uint32_t* flushing_cg_counter,
+                                                joined_type* output_buffer,
+                                                atomicT* num_matches,
+                                                std::size_t output_capacity,
+                                                OutputIt output_begin,
+                                                KeyEqual key_equal) noexcept
+  {
+    const uint32_t cg_lane_id = probing_cg.thread_rank();
+
+    auto current_slot = initial_slot(probing_cg, k);
+
+    bool running = true;
+
+    while (flushing_cg.any(running)) {
+      if (running) {
+        value_type arr[2];
+        load_pair_array(&arr[0], current_slot);
+
+        auto const first_slot_is_empty =
+          detail::bitwise_compare(arr[0].first, this->get_empty_key_sentinel());
+        auto const second_slot_is_empty =
+          detail::bitwise_compare(arr[1].first, this->get_empty_key_sentinel());
+        auto const first_equals  = (not first_slot_is_empty and key_equal(arr[0].first, k));
+        auto const second_equals = (not second_slot_is_empty and key_equal(arr[1].first, k));
+        auto const first_exists  = probing_cg.ballot(first_equals);
+        auto const second_exists = probing_cg.ballot(second_equals);
+
+        if (first_exists or second_exists) {
+          auto const num_first_matches  = __popc(first_exists);
+          auto const num_second_matches = __popc(second_exists);
+
+          uint32_t output_idx;
+          if (0 == cg_lane_id) {
+            output_idx = atomicAdd(flushing_cg_counter, (num_first_matches + num_second_matches));
+          }
+          output_idx = probing_cg.shfl(output_idx, 0);
+
+          if (first_equals) {
+            auto const lane_offset = detail::count_least_significant_bits(first_exists, cg_lane_id);
+            output_buffer[output_idx + lane_offset] = cuco::make_pair(probe_idx, arr[0].second);
+          }
+          if (second_equals) {
+            auto const lane_offset =
+              detail::count_least_significant_bits(second_exists, cg_lane_id);
+            output_buffer[output_idx + num_first_matches + lane_offset] =
+              cuco::make_pair(probe_idx, arr[1].second);
+          }
+        }
+        if (probing_cg.any(first_slot_is_empty or second_slot_is_empty)) { running = false; }
+      }  // if running
+
+      flushing_cg.sync();
+      if (*flushing_cg_counter + flushing_cg.size() * vector_width() > buffer_size) {
+        flush_join_buffer(flushing_cg,
+                          *flushing_cg_counter,
+                          output_buffer,
+                          num_matches,
+                          output_capacity,
+                          output_begin);
+        // Everyone in the group reads the counter when flushing, so
+        // sync before writing.
+        flushing_cg.sync();
+        // First lane reset warp-level counter
+        if (flushing_cg.thread_rank() == 0) { *flushing_cg_counter = 0; }
+        flushing_cg.sync();
+      }
+
+      current_slot = next_slot(current_slot);
+    }  // while running
+  }
+
   /**
    * @brief Retrieves all the matches of a given key contained in multimap using scalar
    * loads with per-CG shared memory buffer.
@@ -1099,6 +1252,90 @@ class static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view_
     }  // while running
   }
 
+  /**
+   * @brief Retrieves all joined probe-index/payload pairs of a given key using scalar loads with
+   * per-CG shared memory buffer, writing at most `output_capacity` pairs.
+   *
+   * For key `k` existing in the map, stores a pair of `probe_idx` and each associated payload to
+   * unspecified locations in the output. Unlike `retrieve`, the writes are bounded by
+   * `output_capacity`: matches beyond it are dropped but still counted in `num_matches`.
+   *
+   * @tparam buffer_size Size of the output buffer
+   * @tparam CG Cooperative Group type
+   * @tparam atomicT Type of atomic storage
+   * @tparam OutputIt Device accessible output iterator whose `value_type` is
+   * constructible from `joined_type`
+   * @param g The Cooperative Group used to retrieve
+   * @param probe_idx Index of the probe key in the input sequence
+   * @param k The key to search for
+   * @param cg_counter Pointer to the CG counter
+   * @param output_buffer Shared memory buffer of the probe-index/payload pair sequence
+   * @param num_matches Size of the output sequence
+   * @param output_capacity Maximum number of joined pairs the output sequence can hold
+   * @param output_begin Beginning of the output sequence of joined pairs
+   * @param key_equal The binary callable used to compare two keys
+   * for equality
+   */
+  template <uint32_t buffer_size, typename CG, typename atomicT, typename OutputIt, typename KeyEqual>
+  __device__ __forceinline__ void join_retrieve(CG const& g,
+                                                std::size_t probe_idx,
+                                                Key const& k,
+                                                uint32_t* cg_counter,
+                                                joined_type* output_buffer,
+                                                atomicT* num_matches,
+                                                std::size_t output_capacity,
+                                                OutputIt output_begin,
+                                                KeyEqual key_equal) noexcept
+  {
+    const uint32_t lane_id = g.thread_rank();
+
+    auto current_slot = initial_slot(g, k);
+
+    bool running = true;
+
+    while (running) {
+      // TODO: Replace reinterpret_cast with atomic ref when possible. The current implementation
+      // is unsafe!
+      static_assert(sizeof(Key) == sizeof(cuda::atomic<Key>));
+      static_assert(sizeof(Value) == sizeof(cuda::atomic<Value>));
+      value_type slot_contents = *reinterpret_cast<value_type const*>(current_slot);
+
+      auto const slot_is_empty =
+        detail::bitwise_compare(slot_contents.first, this->get_empty_key_sentinel());
+      auto const equals = (not slot_is_empty and key_equal(slot_contents.first, k));
+      auto const exists = g.ballot(equals);
+
+      uint32_t output_idx = *cg_counter;
+
+      if (exists) {
+        auto const num_matches_found = __popc(exists);
+        if (equals) {
+          // Each match computes its lane-level offset
+          auto const lane_offset = detail::count_least_significant_bits(exists, lane_id);
+          output_buffer[output_idx + lane_offset] =
+            cuco::make_pair(probe_idx, slot_contents.second);
+        }
+        if (0 == lane_id) { (*cg_counter) += num_matches_found; }
+      }
+      if (g.any(slot_is_empty)) { running = false; }
+
+      g.sync();
+
+      // Flush if the next iteration won't fit into buffer
+      if ((*cg_counter + g.size()) > buffer_size) {
+        flush_join_buffer(
+          g, *cg_counter, output_buffer, num_matches, output_capacity, output_begin);
+        // Everyone in the group reads the counter when flushing, so
+        // sync before writing.
+        g.sync();
+        // First lane reset CG-level counter
+        if (lane_id == 0) { *cg_counter = 0; }
+        g.sync();
+      }
+      current_slot = next_slot(current_slot);
+    }  // while running
+  }
+
   /**
    * @brief Retrieves all the matches of a given pair using vector loads.
    *
@@ -429,6 +429,101 @@ CUCO_KERNEL void retrieve(InputIt first,
   }
 }
 
+/**
+ * @brief Performs a single-pass inner join of the probe keys in the range `[first, first + n)`
+ * against the map.
+ *
+ * For every match of key `k = *(first + i)`, writes a pair of the probe index `i` and the matched
+ * payload to an unspecified location in `[output_begin, output_begin + output_capacity)`. Matches
+ * beyond `output_capacity` are dropped but still counted in `num_matches` so that the host can
+ * detect truncation and report the required output size.
+ *
+ * @tparam block_size The size of the thread block
+ * @tparam flushing_cg_size The size of the CG used to flush output buffers
+ * @tparam probing_cg_size The size of the CG for parallel retrievals
+ * @tparam buffer_size Size of the output buffer
+ * @tparam InputIt Device accessible input iterator whose `value_type` is
+ * convertible to the map's `key_type`
+ * @tparam OutputIt Device accessible output iterator whose `value_type` is
+ * constructible from the view's `joined_type`
+ * @tparam atomicT Type of atomic storage
+ * @tparam viewT Type of device view allowing access of hash map storage
+ * @tparam KeyEqual Binary callable type
+ *
+ * @param first Beginning of the sequence of probe keys
+ * @param n Number of keys to query
+ * @param output_begin Beginning of the output sequence of joined probe-index/payload pairs
+ * @param output_capacity Maximum number of joined pairs the output sequence can hold
+ * @param num_matches Total number of matches, which may exceed `output_capacity` on truncation
+ * @param view Device view used to access the hash map's slot storage
+ * @param key_equal The binary function to compare two keys for equality
+ */
+template <uint32_t block_size,
+          uint32_t flushing_cg_size,
+          uint32_t probing_cg_size,
+          uint32_t buffer_size,
+          typename InputIt,
+          typename OutputIt,
+          typename atomicT,
+          typename viewT,
+          typename KeyEqual>
+CUCO_KERNEL void join_retrieve(InputIt first,
+                               int64_t n,
+                               OutputIt output_begin,
+                               std::size_t output_capacity,
+                               atomicT* num_matches,
+                               viewT view,
+                               KeyEqual key_equal)
+{
+  using joined_type = typename viewT::joined_type;
+
+  constexpr uint32_t num_flushing_cgs = block_size / flushing_cg_size;
+  const uint32_t flushing_cg_id       = threadIdx.x / flushing_cg_size;
+
+  auto flushing_cg          = cg::tiled_partition<flushing_cg_size>(cg::this_thread_block());
+  auto probing_cg           = cg::tiled_partition<probing_cg_size>(cg::this_thread_block());
+  int64_t const loop_stride = gridDim.x * block_size / probing_cg_size;
+  int64_t idx               = (block_size * blockIdx.x + threadIdx.x) / probing_cg_size;
+
+  __shared__ joined_type output_buffer[num_flushing_cgs][buffer_size];
+  __shared__ uint32_t flushing_cg_counter[num_flushing_cgs];
+
+  if (flushing_cg.thread_rank() == 0) { flushing_cg_counter[flushing_cg_id] = 0; }
+
+  flushing_cg.sync();
+
+  while (flushing_cg.any(idx < n)) {
+    bool active_flag        = idx < n;
+    auto active_flushing_cg = cg::binary_partition<flushing_cg_size>(flushing_cg, active_flag);
+
+    if (active_flag) {
+      auto key = *(first + idx);
+      view.join_retrieve<buffer_size>(active_flushing_cg,
+                                      probing_cg,
+                                      static_cast<std::size_t>(idx),
+                                      key,
+                                      &flushing_cg_counter[flushing_cg_id],
+                                      output_buffer[flushing_cg_id],
+                                      num_matches,
+                                      output_capacity,
+                                      output_begin,
+                                      key_equal);
+    }
+    idx += loop_stride;
+  }
+
+  flushing_cg.sync();
+  // Final flush of output buffer
+  if (flushing_cg_counter[flushing_cg_id] > 0) {
+    view.flush_join_buffer(flushing_cg,
+                           flushing_cg_counter[flushing_cg_id],
+                           output_buffer[flushing_cg_id],
+                           num_matches,
+                           output_capacity,
+                           output_begin);
+  }
+}
+
 /**
  * @brief Retrieves all pairs matching the input probe pair in the range `[first, last)`.
  *
@@ -249,6 +249,177 @@ void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator,
   impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
 }
 
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count(
+  InputIt first, InputIt last, cuda::stream_ref stream) const noexcept
+{
+  return impl_->count(first, last, ref(op::count), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::count_outer(
+  InputIt first, InputIt last, cuda::stream_ref stream) const noexcept
+{
+  return impl_->count_outer(first, last, ref(op::count), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename CallbackOp>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::for_each(
+  CallbackOp&& callback_op, cuda::stream_ref stream) const
+{
+  this->for_each_async(std::forward<CallbackOp>(callback_op), stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename CallbackOp>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  for_each_async(CallbackOp&& callback_op, cuda::stream_ref stream) const
+{
+  impl_->for_each_async(std::forward<CallbackOp>(callback_op), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename CallbackOp>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::for_each(
+  InputIt first, InputIt last, CallbackOp&& callback_op, cuda::stream_ref stream) const
+{
+  this->for_each_async(first, last, std::forward<CallbackOp>(callback_op), stream);
+  stream.wait();
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename CallbackOp>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  for_each_async(InputIt first,
+                 InputIt last,
+                 CallbackOp&& callback_op,
+                 cuda::stream_ref stream) const noexcept
+{
+  impl_->for_each_async(
+    first, last, std::forward<CallbackOp>(callback_op), ref(op::for_each), stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size(
+  cuda::stream_ref stream) const
+{
+  return impl_->size(stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::rehash(
+  cuda::stream_ref stream)
+{
+  this->impl_->rehash(*this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::rehash(
+  size_type capacity, cuda::stream_ref stream)
+{
+  auto const extent = make_window_extent<static_multimap>(capacity);
+  this->impl_->rehash(extent, *this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_async(*this, stream);
+}
+
+template <class Key,
+          class T,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_multimap<Key, T, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_async(size_type capacity, cuda::stream_ref stream)
+{
+  auto const extent = make_window_extent<static_multimap>(capacity);
+  this->impl_->rehash_async(extent, *this, stream);
+}
+
 template <class Key,
           class T,
           class Extent,
@@ -641,6 +812,45 @@ OutputIt static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::retrieve_
   return output_begin + counter.load_to_host(stream);
 }
 
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          class ProbeSequence>
+template <typename InputIt, typename OutputIt, typename KeyEqual>
+typename static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::size_type
+static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::inner_join(
+  InputIt first,
+  InputIt last,
+  OutputIt output_begin,
+  size_type output_capacity,
+  cudaStream_t stream,
+  KeyEqual key_equal) const
+{
+  auto const num_keys = cuco::detail::distance(first, last);
+  if (num_keys == 0) { return 0; }
+
+  // Using per-warp buffer for vector loads and per-CG buffer for scalar loads
+  constexpr auto buffer_size = uses_vector_load() ? (warp_size() * 3u) : (cg_size() * 3u);
+
+  auto view                   = get_device_view();
+  auto const flushing_cg_size = [&]() {
+    if constexpr (uses_vector_load()) { return warp_size(); }
+    return cg_size();
+  }();
+
+  auto const grid_size = detail::grid_size(num_keys, cg_size());
+
+  auto counter = detail::counter_storage<size_type, Scope, allocator_type>{allocator_};
+  counter.reset(stream);
+
+  detail::join_retrieve<detail::default_block_size(), flushing_cg_size, cg_size(), buffer_size>
+    <<<grid_size, detail::default_block_size(), 0, stream>>>(
+      first, num_keys, output_begin, output_capacity, counter.data(), view, key_equal);
+
+  return counter.load_to_host(stream);
+}
+
 template <typename Key,
           typename Value,
           cuda::thread_scope Scope,
@@ -829,6 +1039,24 @@ static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view::flush
                             contained_output_begin);
 }
 
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          class ProbeSequence>
+template <typename CG, typename atomicT, typename OutputIt>
+__device__ __forceinline__ void
+static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view::flush_join_buffer(
+  CG const& g,
+  uint32_t const num_outputs,
+  joined_type* output_buffer,
+  atomicT* num_matches,
+  std::size_t output_capacity,
+  OutputIt output_begin) noexcept
+{
+  impl_.flush_join_buffer(g, num_outputs, output_buffer, num_matches, output_capacity, output_begin);
+}
+
 template <typename Key,
           typename Value,
           cuda::thread_scope Scope,
@@ -963,6 +1191,54 @@ static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view::retri
   }
 }
 
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          class ProbeSequence>
+template <uint32_t buffer_size,
+          typename FlushingCG,
+          typename atomicT,
+          typename OutputIt,
+          typename KeyEqual>
+__device__ __forceinline__ void
+static_multimap<Key, Value, Scope, Allocator, ProbeSequence>::device_view::join_retrieve(
+  FlushingCG const& flushing_cg,
+  cooperative_groups::thread_block_tile<ProbeSequence::cg_size> const& probing_cg,
+  std::size_t probe_idx,
+  Key const& k,
+  uint32_t* flushing_cg_counter,
+  joined_type* output_buffer,
+  atomicT* num_matches,
+  std::size_t output_capacity,
+  OutputIt output_begin,
+  KeyEqual key_equal) noexcept
+{
+  if constexpr (uses_vector_load()) {
+    impl_.join_retrieve<buffer_size>(flushing_cg,
+                                     probing_cg,
+                                     probe_idx,
+                                     k,
+                                     flushing_cg_counter,
+                                     output_buffer,
+                                     num_matches,
+                                     output_capacity,
+                                     output_begin,
+                                     key_equal);
+  } else  // In the case of scalar load, flushing CG is the same as probing CG
+  {
+    impl_.join_retrieve<buffer_size>(probing_cg,
+                                     probe_idx,
+                                     k,
+                                     flushing_cg_counter,
+                                     output_buffer,
+                                     num_matches,
+                                     output_capacity,
+                                     output_begin,
+                                     key_equal);
+  }
+}
+
 template <typename Key,
           typename Value,
           cuda::thread_scope Scope,
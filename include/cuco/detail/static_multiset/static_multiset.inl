@@ -337,6 +337,48 @@ static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
     stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt1, typename OutputIt2>
+cuda::std::pair<OutputIt1, OutputIt2>
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve(
+  InputIt first,
+  InputIt last,
+  OutputIt1 output_probe,
+  OutputIt2 output_match,
+  cuda::stream_ref stream) const
+{
+  auto const num =
+    impl_->retrieve(first, last, output_probe, output_match, ref(op::for_each), stream);
+  return {output_probe + num, output_match + num};
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt1, typename OutputIt2>
+cuda::std::pair<OutputIt1, OutputIt2>
+static_multiset<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_outer(
+  InputIt first,
+  InputIt last,
+  OutputIt1 output_probe,
+  OutputIt2 output_match,
+  cuda::stream_ref stream) const
+{
+  auto const num =
+    impl_->retrieve_outer(first, last, output_probe, output_match, ref(op::for_each), stream);
+  return {output_probe + num, output_match + num};
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -410,6 +410,59 @@ class operator_impl<
     auto const& ref_ = static_cast<ref_type const&>(*this);
     return ref_.impl_.contains(group, key);
   }
+
+#if defined(CUCO_HAS_CUDA_BARRIER)
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container.
+   *
+   * Software-pipelined variant of `contains` that prefetches the next probe window into a
+   * caller-provided shared memory double buffer while the current one is compared.
+   *
+   * @note `buffer` must point to two windows of shared memory exclusively owned by the calling
+   * thread.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param key The key to search for
+   * @param buffer Shared memory double buffer used for window prefetching
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains_pipelined(
+    ProbeKey const& key, typename base_type::window_type* buffer) const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.impl_.contains_pipelined(key, buffer);
+  }
+
+  /**
+   * @brief Indicates whether the probe key `key` was inserted into the container.
+   *
+   * Software-pipelined variant of the group `contains` that prefetches the next probe window into
+   * a caller-provided shared memory double buffer while the current one is compared.
+   *
+   * @note `buffer` must point to two windows of shared memory exclusively owned by the calling
+   * thread.
+   *
+   * @tparam ProbeKey Probe key type
+   *
+   * @param group The Cooperative Group used to perform group contains
+   * @param key The key to search for
+   * @param buffer Shared memory double buffer used for window prefetching
+   *
+   * @return A boolean indicating whether the probe key is present
+   */
+  template <typename ProbeKey>
+  [[nodiscard]] __device__ bool contains_pipelined(
+    cooperative_groups::thread_block_tile<cg_size> const& group,
+    ProbeKey const& key,
+    typename base_type::window_type* buffer) const noexcept
+  {
+    auto const& ref_ = static_cast<ref_type const&>(*this);
+    return ref_.impl_.contains_pipelined(group, key, buffer);
+  }
+#endif  // end CUCO_HAS_CUDA_BARRIER
 };
 
 template <typename Key,
@@ -309,6 +309,78 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   impl_->contains_if_async(first, last, stencil, pred, output_begin, ref(op::contains), stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::contains_bitmask(
+  InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream) const
+{
+  contains_bitmask_async(first, last, output_begin, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename OutputIt>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask_async(InputIt first,
+                         InputIt last,
+                         OutputIt output_begin,
+                         cuda::stream_ref stream) const noexcept
+{
+  impl_->contains_bitmask_async(first, last, output_begin, ref(op::contains), stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask_if(InputIt first,
+                      InputIt last,
+                      StencilIt stencil,
+                      Predicate pred,
+                      OutputIt output_begin,
+                      cuda::stream_ref stream) const
+{
+  contains_bitmask_if_async(first, last, stencil, pred, output_begin, stream);
+  stream.wait();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  contains_bitmask_if_async(InputIt first,
+                            InputIt last,
+                            StencilIt stencil,
+                            Predicate pred,
+                            OutputIt output_begin,
+                            cuda::stream_ref stream) const noexcept
+{
+  impl_->contains_bitmask_if_async(
+    first, last, stencil, pred, output_begin, ref(op::contains), stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -404,6 +476,42 @@ OutputIt static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Stor
   return impl_->retrieve_all(output_begin, stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename OutputIt>
+typename static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::size_type
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::retrieve_chunk(
+  OutputIt output_begin,
+  size_type buffer_capacity,
+  size_type& window_offset,
+  cuda::stream_ref stream) const
+{
+  return impl_->retrieve_chunk(output_begin, buffer_capacity, window_offset, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+template <typename ResultT, typename TransformOp, typename ReduceOp>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  transform_reduce_async(ResultT* output,
+                         TransformOp transform_op,
+                         ResultT init,
+                         ReduceOp reduce_op,
+                         cuda::stream_ref stream) const
+{
+  impl_->transform_reduce_async(output, transform_op, init, reduce_op, stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -458,6 +566,32 @@ void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>
   this->impl_->rehash_async(extent, *this, stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::rehash_in_place(
+  cuda::stream_ref stream)
+{
+  this->impl_->rehash_in_place(*this, stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  rehash_in_place_async(cuda::stream_ref stream)
+{
+  this->impl_->rehash_in_place_async(*this, stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
@@ -472,6 +606,59 @@ static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::siz
   return impl_->size(stream);
 }
 
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  enable_counted_size(cuda::stream_ref stream)
+{
+  impl_->enable_counted_size(stream);
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+void static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  disable_counted_size() noexcept
+{
+  impl_->disable_counted_size();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+bool static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::
+  counted_size_enabled() const noexcept
+{
+  return impl_->counted_size_enabled();
+}
+
+template <class Key,
+          class Extent,
+          cuda::thread_scope Scope,
+          class KeyEqual,
+          class ProbingScheme,
+          class Allocator,
+          class Storage>
+probing_statistics
+static_set<Key, Extent, Scope, KeyEqual, ProbingScheme, Allocator, Storage>::probe_statistics(
+  cuda::stream_ref stream) const
+{
+  return impl_->probe_statistics(stream);
+}
+
 template <class Key,
           class Extent,
           cuda::thread_scope Scope,
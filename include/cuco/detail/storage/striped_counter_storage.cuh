@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/extent.cuh>
+
+#include <cuda/atomic>
+#include <cuda/stream_ref>
+
+#include <memory>
+#include <numeric>
+
+namespace cuco {
+namespace detail {
+/**
+ * @brief Striped device atomic counter storage class.
+ *
+ * Maintains `NumStripes` privatized counters so that concurrent updates from different thread
+ * blocks are spread across multiple cache lines instead of contending on a single atomic. The
+ * aggregate value is reduced lazily on the host when queried.
+ *
+ * @tparam SizeType Type of storage size
+ * @tparam Scope The scope in which the counters will be used by individual threads
+ * @tparam Allocator Type of allocator used for device storage
+ * @tparam NumStripes Number of privatized counters
+ */
+template <typename SizeType, cuda::thread_scope Scope, typename Allocator, int32_t NumStripes>
+class striped_counter_storage : public storage_base<cuco::extent<SizeType, NumStripes>> {
+  static_assert(NumStripes > 0, "Number of stripes must be greater than zero");
+
+ public:
+  using storage_base<cuco::extent<SizeType, NumStripes>>::capacity;  ///< Storage size
+
+  static constexpr int32_t num_stripes = NumStripes;  ///< Number of privatized counters
+
+  using size_type      = SizeType;                        ///< Size type
+  using value_type     = cuda::atomic<size_type, Scope>;  ///< Type of the counters
+  using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<
+    value_type>;  ///< Type of the allocator to (de)allocate counters
+  using counter_deleter_type =
+    custom_deleter<size_type, allocator_type>;  ///< Type of counter deleter
+
+  /**
+   * @brief Constructor of striped counter storage.
+   *
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr striped_counter_storage(Allocator const& allocator)
+    : storage_base<cuco::extent<SizeType, NumStripes>>{cuco::extent<size_type, NumStripes>{}},
+      allocator_{allocator},
+      counter_deleter_{this->capacity(), allocator_},
+      counters_{allocator_.allocate(this->capacity()), counter_deleter_}
+  {
+  }
+
+  /**
+   * @brief Asynchronously resets all counters to zero.
+   *
+   * @param stream CUDA stream used to reset
+   */
+  void reset(cuda::stream_ref stream)
+  {
+    static_assert(sizeof(size_type) == sizeof(value_type));
+    CUCO_CUDA_TRY(
+      cudaMemsetAsync(this->data(), 0, sizeof(value_type) * this->capacity(), stream.get()));
+  }
+
+  /**
+   * @brief Asynchronously sets the aggregate value of the counters.
+   *
+   * @note Stripe zero is set to `value` while all other stripes are reset to zero.
+   *
+   * @param value The new aggregate value
+   * @param stream CUDA stream used for this operation
+   */
+  void set(size_type value, cuda::stream_ref stream)
+  {
+    this->reset(stream);
+    CUCO_CUDA_TRY(cudaMemcpyAsync(
+      this->data(), &value, sizeof(size_type), cudaMemcpyHostToDevice, stream.get()));
+  }
+
+  /**
+   * @brief Gets the device atomic counters pointer.
+   *
+   * @return Pointer to the first device atomic counter
+   */
+  [[nodiscard]] constexpr value_type* data() noexcept { return counters_.get(); }
+
+  /**
+   * @brief Gets the device atomic counters pointer.
+   *
+   * @return Pointer to the first device atomic counter
+   */
+  [[nodiscard]] constexpr value_type* data() const noexcept { return counters_.get(); }
+
+  /**
+   * @brief Copies all stripes to the host and reduces them to the aggregate value.
+   *
+   * @note This API synchronizes the given `stream`.
+   *
+   * @param stream CUDA stream used to copy device values to the host
+   * @return Aggregate value of the striped counters
+   */
+  [[nodiscard]] constexpr size_type load_to_host(cuda::stream_ref stream) const
+  {
+    size_type h_counts[NumStripes];
+    CUCO_CUDA_TRY(cudaMemcpyAsync(h_counts,
+                                  this->data(),
+                                  sizeof(size_type) * NumStripes,
+                                  cudaMemcpyDeviceToHost,
+                                  stream.get()));
+    stream.wait();
+    return std::accumulate(h_counts, h_counts + NumStripes, size_type{0});
+  }
+
+ private:
+  allocator_type allocator_;              ///< Allocator used to (de)allocate counters
+  counter_deleter_type counter_deleter_;  ///< Custom counter deleter
+  std::unique_ptr<value_type, counter_deleter_type> counters_;  ///< Pointer to counter storage
+};
+
+}  // namespace detail
+}  // namespace cuco
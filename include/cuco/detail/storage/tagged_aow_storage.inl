@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/storage/storage_base.cuh>
+#include <cuco/extent.cuh>
+
+#include <cuda/std/limits>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+
+template <typename T, int32_t WindowSize, typename Extent, typename Allocator>
+constexpr tagged_aow_storage<T, WindowSize, Extent, Allocator>::tagged_aow_storage(
+  Extent size, Allocator const& allocator)
+  : base_type{size, allocator},
+    tag_allocator_{allocator},
+    tag_deleter_{capacity(), tag_allocator_},
+    tags_{tag_allocator_.allocate(capacity()), tag_deleter_}
+{
+}
+
+template <typename T, int32_t WindowSize, typename Extent, typename Allocator>
+constexpr tagged_aow_storage<T, WindowSize, Extent, Allocator>::tag_type*
+tagged_aow_storage<T, WindowSize, Extent, Allocator>::tags() const noexcept
+{
+  return tags_.get();
+}
+
+template <typename T, int32_t WindowSize, typename Extent, typename Allocator>
+constexpr tagged_aow_storage<T, WindowSize, Extent, Allocator>::ref_type
+tagged_aow_storage<T, WindowSize, Extent, Allocator>::ref() const noexcept
+{
+  return ref_type{this->window_extent(), this->data(), this->tags()};
+}
+
+template <typename T, int32_t WindowSize, typename Extent, typename Allocator>
+void tagged_aow_storage<T, WindowSize, Extent, Allocator>::initialize(value_type key,
+                                                                      cuda::stream_ref stream)
+{
+  this->initialize_async(key, stream);
+  stream.wait();
+}
+
+template <typename T, int32_t WindowSize, typename Extent, typename Allocator>
+void tagged_aow_storage<T, WindowSize, Extent, Allocator>::initialize_async(
+  value_type key, cuda::stream_ref stream) noexcept
+{
+  base_type::initialize_async(key, stream);
+  cudaMemsetAsync(this->tags(), ref_type::empty_tag, sizeof(tag_type) * capacity(), stream.get());
+}
+
+template <typename T, int32_t WindowSize, typename Extent>
+__host__ __device__ constexpr tagged_aow_storage_ref<T, WindowSize, Extent>::tagged_aow_storage_ref(
+  Extent size, window_type* windows, tag_type* tags) noexcept
+  : base_type{size, windows}, tags_{tags}
+{
+}
+
+template <typename T, int32_t WindowSize, typename Extent>
+template <typename HashValue>
+__host__ __device__ constexpr tagged_aow_storage_ref<T, WindowSize, Extent>::tag_type
+tagged_aow_storage_ref<T, WindowSize, Extent>::make_tag(HashValue hash_value) noexcept
+{
+  auto constexpr num_tag_bits = 7;
+  auto constexpr shift        = cuda::std::numeric_limits<HashValue>::digits - num_tag_bits;
+  // set the top bit so that a valid fingerprint can never collide with `empty_tag`
+  return static_cast<tag_type>(hash_value >> shift) | tag_type{0x80};
+}
+
+template <typename T, int32_t WindowSize, typename Extent>
+__device__ constexpr tagged_aow_storage_ref<T, WindowSize, Extent>::tag_type*
+tagged_aow_storage_ref<T, WindowSize, Extent>::tags() const noexcept
+{
+  return tags_;
+}
+
+template <typename T, int32_t WindowSize, typename Extent>
+__device__ constexpr tagged_aow_storage_ref<T, WindowSize, Extent>::tag_window_type
+tagged_aow_storage_ref<T, WindowSize, Extent>::tag_window(size_type index) const noexcept
+{
+  return *reinterpret_cast<tag_window_type*>(
+    __builtin_assume_aligned(this->tags() + index * window_size, sizeof(tag_type) * window_size));
+}
+
+}  // namespace cuco
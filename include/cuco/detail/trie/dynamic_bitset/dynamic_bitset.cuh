@@ -69,7 +69,9 @@ struct rank {
  *
  * In addition to standard bitset set/test operations, this class provides
  * rank and select operation API. It maintains index structures to make both these
- * new operations close to constant time.
+ * new operations close to constant time. For sparse bit patterns (see
+ * `sparse_selects_factor`) the exact positions of the minority polarity are additionally
+ * materialized during `build`, which turns `select` into a single memory load.
  *
  * Current limitations:
  * - Stream controls are partially supported due to the use of `thrust::device_vector` as storage
@@ -92,6 +94,10 @@ class dynamic_bitset {
   static constexpr size_type bits_per_word = sizeof(word_type) * CHAR_BIT;
   /// Number of bits in a block
   static constexpr size_type bits_per_block = words_per_block * bits_per_word;
+  /// When at most one bit in `sparse_selects_factor` has a given polarity, `build` materializes
+  /// the exact positions of those bits so `select` becomes a single memory load. The factor bounds
+  /// the extra storage to at most one bit per bit of the original bitset.
+  static constexpr size_type sparse_selects_factor = 64;
 
   /**
    * @brief Constructs an empty bitset
@@ -198,6 +204,11 @@ class dynamic_bitset {
 
     const rank_type* ranks_false_ref_;    ///< Ranks ref for 0 bits
     const size_type* selects_false_ref_;  ///< Selects ref 0 bits
+
+    /// Exact positions of all 1 bits; non-null only if the bitset is sparse
+    const size_type* sparse_selects_true_ref_;
+    /// Exact positions of all 0 bits; non-null only if the bitset is mostly set
+    const size_type* sparse_selects_false_ref_;
   };
 
   /**
@@ -323,6 +334,17 @@ class dynamic_bitset {
    */
   [[nodiscard]] constexpr size_type size() const noexcept;
 
+  /**
+   * @brief Builds indexes for rank and select
+   *
+   * This function is a no-op if the indexes are already up-to-date. It is called implicitly by the
+   * bulk `test`, `rank` and `select` APIs but must be invoked explicitly before acquiring a device
+   * `ref` of the bitset.
+   *
+   * @param stream Stream to execute kernels
+   */
+  constexpr void build(cuda::stream_ref stream = {}) noexcept;
+
  private:
   /// Type of the allocator to (de)allocate ranks
   using rank_allocator_type = typename std::allocator_traits<Allocator>::rebind_alloc<rank_type>;
@@ -343,25 +365,25 @@ class dynamic_bitset {
   thrust::device_vector<size_type, size_allocator_type> selects_true_;
   /// Same as selects_, but for `0` bits
   thrust::device_vector<size_type, size_allocator_type> selects_false_;
-
-  /**
-   * @brief Builds indexes for rank and select
-   *
-   * @param stream Stream to execute kernels
-   */
-  constexpr void build(cuda::stream_ref stream = {}) noexcept;
+  /// Exact positions of all `1` bits; populated only if the bitset is sparse
+  thrust::device_vector<size_type, size_allocator_type> sparse_selects_true_;
+  /// Same as sparse_selects_true_, but for `0` bits
+  thrust::device_vector<size_type, size_allocator_type> sparse_selects_false_;
 
   /**
    * @brief Populates rank and select indexes for true or false bits
    *
    * @param ranks Output array of ranks
    * @param selects Output array of selects
+   * @param sparse_selects Output array of exact bit positions, populated only if at most one bit
+   * in `sparse_selects_factor` has the requested polarity
    * @param flip_bits If true, negate bits to construct indexes for false bits
    * @param stream Stream to execute kernels
    */
   constexpr void build_ranks_and_selects(
     thrust::device_vector<rank_type, rank_allocator_type>& ranks,
     thrust::device_vector<size_type, size_allocator_type>& selects,
+    thrust::device_vector<size_type, size_allocator_type>& sparse_selects,
     bool flip_bits,
     cuda::stream_ref stream = {});
 };
@@ -38,7 +38,9 @@ constexpr dynamic_bitset<Allocator>::dynamic_bitset(Allocator const& allocator)
     ranks_true_{allocator},
     ranks_false_{allocator},
     selects_true_{allocator},
-    selects_false_{allocator}
+    selects_false_{allocator},
+    sparse_selects_true_{allocator},
+    sparse_selects_false_{allocator}
 {
 }
 
@@ -128,6 +130,7 @@ template <class Allocator>
 constexpr void dynamic_bitset<Allocator>::build_ranks_and_selects(
   thrust::device_vector<rank_type, rank_allocator_type>& ranks,
   thrust::device_vector<size_type, size_allocator_type>& selects,
+  thrust::device_vector<size_type, size_allocator_type>& sparse_selects,
   bool flip_bits,
   cuda::stream_ref stream)
 {
@@ -169,6 +172,14 @@ constexpr void dynamic_bitset<Allocator>::build_ranks_and_selects(
 
   temp_allocator.deallocate(d_temp_storage, temp_storage_bytes);
 
+  // Total bit count of the requested polarity, fetched once the stream is synchronized below
+  size_type total_count{};
+  CUCO_CUDA_TRY(cudaMemcpyAsync(&total_count,
+                                bit_counts_begin + num_words,
+                                sizeof(size_type),
+                                cudaMemcpyDeviceToHost,
+                                stream.get()));
+
   // Step 2. Compute ranks
   auto const num_blocks = (num_words - 1) / words_per_block + 2;
   ranks.resize(num_blocks);
@@ -241,14 +252,30 @@ constexpr void dynamic_bitset<Allocator>::build_ranks_and_selects(
                                            stream.get()));
 
   temp_allocator.deallocate(d_temp_storage, temp_storage_bytes);
+
+  // Step 4. Materialize exact select positions if the requested polarity is sparse enough
+  if (total_count * sparse_selects_factor <= num_words * bits_per_word) {
+    sparse_selects.resize(total_count);
+
+    grid_size = cuco::detail::grid_size(num_words);
+    gather_bit_positions_kernel<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+      thrust::raw_pointer_cast(words_.data()),
+      bit_counts_begin,
+      thrust::raw_pointer_cast(sparse_selects.data()),
+      num_words,
+      flip_bits);
+  } else {
+    sparse_selects.clear();
+    sparse_selects.shrink_to_fit();
+  }
 }
 
 template <class Allocator>
 constexpr void dynamic_bitset<Allocator>::build(cuda::stream_ref stream) noexcept
 {
   if (not is_built_) {
-    build_ranks_and_selects(ranks_true_, selects_true_, false, stream);   // 1 bits
-    build_ranks_and_selects(ranks_false_, selects_false_, true, stream);  // 0 bits
+    build_ranks_and_selects(ranks_true_, selects_true_, sparse_selects_true_, false, stream);
+    build_ranks_and_selects(ranks_false_, selects_false_, sparse_selects_false_, true, stream);
     is_built_ = true;
   }
 }
@@ -256,11 +283,15 @@ constexpr void dynamic_bitset<Allocator>::build(cuda::stream_ref stream) noexcep
 template <class Allocator>
 constexpr dynamic_bitset<Allocator>::ref_type dynamic_bitset<Allocator>::ref() const noexcept
 {
-  return ref_type{storage_ref_type{thrust::raw_pointer_cast(words_.data()),
-                                   thrust::raw_pointer_cast(ranks_true_.data()),
-                                   thrust::raw_pointer_cast(selects_true_.data()),
-                                   thrust::raw_pointer_cast(ranks_false_.data()),
-                                   thrust::raw_pointer_cast(selects_false_.data())}};
+  return ref_type{storage_ref_type{
+    thrust::raw_pointer_cast(words_.data()),
+    thrust::raw_pointer_cast(ranks_true_.data()),
+    thrust::raw_pointer_cast(selects_true_.data()),
+    thrust::raw_pointer_cast(ranks_false_.data()),
+    thrust::raw_pointer_cast(selects_false_.data()),
+    sparse_selects_true_.empty() ? nullptr : thrust::raw_pointer_cast(sparse_selects_true_.data()),
+    sparse_selects_false_.empty() ? nullptr
+                                  : thrust::raw_pointer_cast(sparse_selects_false_.data())}};
 }
 
 template <class Allocator>
@@ -328,6 +359,10 @@ template <class Allocator>
 __device__ constexpr typename dynamic_bitset<Allocator>::size_type
 dynamic_bitset<Allocator>::reference::select(size_type count) const noexcept
 {
+  if (storage_.sparse_selects_true_ref_ != nullptr) {
+    return storage_.sparse_selects_true_ref_[count];
+  }
+
   auto rank_id = initial_rank_estimate(count, storage_.selects_true_ref_, storage_.ranks_true_ref_);
   auto rank    = storage_.ranks_true_ref_[rank_id];
 
@@ -341,6 +376,10 @@ template <class Allocator>
 __device__ constexpr typename dynamic_bitset<Allocator>::size_type
 dynamic_bitset<Allocator>::reference::select_false(size_type count) const noexcept
 {
+  if (storage_.sparse_selects_false_ref_ != nullptr) {
+    return storage_.sparse_selects_false_ref_[count];
+  }
+
   auto rank_id =
     initial_rank_estimate(count, storage_.selects_false_ref_, storage_.ranks_false_ref_);
   auto rank = storage_.ranks_false_ref_[rank_id];
@@ -401,10 +440,15 @@ template <class Allocator>
 __device__ typename dynamic_bitset<Allocator>::size_type
 dynamic_bitset<Allocator>::reference::select_bit_in_word(size_type N, word_type word) const noexcept
 {
-  for (size_type pos = 0; pos < N; pos++) {
-    word &= word - 1;
-  }
-  return __ffsll(word & -word) - 1;  // cuda intrinsic
+  // `__fns` locates the Nth set bit of a 32-bit mask in a single intrinsic, replacing the
+  // bit-by-bit clearing loop
+  auto const low       = static_cast<uint32_t>(word);
+  auto const low_count = static_cast<size_type>(cuda::std::popcount(low));
+
+  if (N < low_count) { return __fns(low, 0, static_cast<int>(N) + 1); }  // cuda intrinsic
+  constexpr size_type half_word = bits_per_word / 2;
+  return half_word +
+         __fns(static_cast<uint32_t>(word >> half_word), 0, static_cast<int>(N - low_count) + 1);
 }
 }  // namespace detail
 }  // namespace experimental
@@ -22,6 +22,8 @@
 
 #include <cuda/std/bit>
 
+#include <climits>
+
 namespace cuco {
 namespace experimental {
 namespace detail {
@@ -236,6 +238,46 @@ CUCO_KERNEL void mark_blocks_with_select_entries(SizeType const* prefix_bit_coun
   }
 }
 
+/*
+ * @brief Gathers the exact positions of all set (or not-set) bits
+ *
+ * Each word's bit positions are written to the output slice starting at the word's prefix bit
+ * count, so the output lists all positions in ascending order.
+ *
+ * @tparam WordType Word type
+ * @tparam SizeType Size type
+ *
+ * @param words Input array of words
+ * @param prefix_bit_counts Prefix sum array of per-word bit counts
+ * @param positions Output array of bit positions
+ * @param num_words Number of words
+ * @param flip_bits Boolean to request negation of words before gathering positions
+ */
+template <typename WordType, typename SizeType>
+CUCO_KERNEL void gather_bit_positions_kernel(WordType const* words,
+                                             SizeType const* prefix_bit_counts,
+                                             SizeType* positions,
+                                             cuco::detail::index_type num_words,
+                                             bool flip_bits)
+{
+  auto word_id      = cuco::detail::global_thread_id();
+  auto const stride = cuco::detail::grid_stride();
+
+  constexpr SizeType bits_per_word = sizeof(WordType) * CHAR_BIT;
+
+  while (word_id < num_words) {
+    auto word = words[word_id];
+    if (flip_bits) { word = ~word; }
+
+    auto output = positions + prefix_bit_counts[word_id];
+    while (word != 0) {
+      *output++ = word_id * bits_per_word + cuda::std::countr_zero(word);
+      word &= word - 1;  // Clear lowest set bit
+    }
+    word_id += stride;
+  }
+}
+
 }  // namespace detail
 }  // namespace experimental
 }  // namespace cuco
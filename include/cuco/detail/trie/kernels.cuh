@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/utility/cuda.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+
+namespace cuco {
+namespace experimental {
+namespace detail {
+
+CUCO_SUPPRESS_KERNEL_WARNINGS
+/*
+ * @brief Looks up a batch of variable-length keys in the trie
+ *
+ * @tparam TrieRef Trie reference type
+ * @tparam LabelIt Device-accessible iterator to the concatenated labels of all keys
+ * @tparam OffsetIt Device-accessible iterator to the exclusive key offsets
+ * @tparam OutputIt Device-accessible iterator whose `value_type` can be constructed from trie's
+ * `size_type`
+ *
+ * @param ref Trie ref
+ * @param labels Begin iterator to the concatenated labels
+ * @param offsets Begin iterator to the key offsets
+ * @param outputs Begin iterator to the lookup results
+ * @param num_keys Number of input keys
+ */
+template <typename TrieRef, typename LabelIt, typename OffsetIt, typename OutputIt>
+CUCO_KERNEL void trie_lookup_kernel(
+  TrieRef ref, LabelIt labels, OffsetIt offsets, OutputIt outputs, cuco::detail::index_type num_keys)
+{
+  auto key_id       = cuco::detail::global_thread_id();
+  auto const stride = cuco::detail::grid_stride();
+
+  while (key_id < num_keys) {
+    outputs[key_id] = ref.lookup(labels + offsets[key_id], labels + offsets[key_id + 1]);
+    key_id += stride;
+  }
+}
+
+/*
+ * @brief Counts the stored keys matching a batch of variable-length prefixes
+ *
+ * @tparam TrieRef Trie reference type
+ * @tparam LabelIt Device-accessible iterator to the concatenated labels of all prefixes
+ * @tparam OffsetIt Device-accessible iterator to the exclusive prefix offsets
+ * @tparam OutputIt Device-accessible iterator whose `value_type` can be constructed from trie's
+ * `size_type`
+ *
+ * @param ref Trie ref
+ * @param labels Begin iterator to the concatenated labels
+ * @param offsets Begin iterator to the prefix offsets
+ * @param outputs Begin iterator to the prefix counts
+ * @param num_keys Number of input prefixes
+ */
+template <typename TrieRef, typename LabelIt, typename OffsetIt, typename OutputIt>
+CUCO_KERNEL void trie_prefix_count_kernel(
+  TrieRef ref, LabelIt labels, OffsetIt offsets, OutputIt outputs, cuco::detail::index_type num_keys)
+{
+  auto key_id       = cuco::detail::global_thread_id();
+  auto const stride = cuco::detail::grid_stride();
+
+  while (key_id < num_keys) {
+    outputs[key_id] = ref.prefix_count(labels + offsets[key_id], labels + offsets[key_id + 1]);
+    key_id += stride;
+  }
+}
+
+}  // namespace detail
+}  // namespace experimental
+}  // namespace cuco
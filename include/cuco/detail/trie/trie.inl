@@ -0,0 +1,154 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/trie/kernels.cuh>
+#include <cuco/detail/utility/cuda.hpp>
+#include <cuco/detail/utils.hpp>
+
+#include <thrust/raw_pointer_cast.h>
+
+#include <algorithm>
+
+namespace cuco {
+namespace experimental {
+
+template <typename LabelType>
+trie<LabelType>::trie() : n_keys_{0}, is_built_{false}, last_key_{}, levels_(2)
+{
+  levels_[0].outs_.push_back(false);   // root node, not terminal yet
+  levels_[1].louds_.push_back(true);   // root node's children group, empty so far
+}
+
+template <typename LabelType>
+template <typename LabelIt>
+void trie<LabelType>::insert(LabelIt labels_begin, LabelIt labels_end)
+{
+  CUCO_EXPECTS(not is_built_, "Cannot insert into a trie that has already been built");
+
+  auto const key_size = static_cast<size_type>(cuco::detail::distance(labels_begin, labels_end));
+  if (n_keys_ > 0) {
+    CUCO_EXPECTS(
+      std::lexicographical_compare(last_key_.begin(), last_key_.end(), labels_begin, labels_end),
+      "Keys must be inserted in lexicographically sorted order and must be unique");
+  }
+
+  while (levels_.size() < key_size + 2) {
+    levels_.emplace_back();
+  }
+
+  // skip the prefix shared with the previously inserted key; its nodes already exist and are the
+  // most recently created ones of their levels
+  size_type lcp = 0;
+  auto label_it = labels_begin;
+  while (lcp < last_key_.size() and label_it != labels_end and *label_it == last_key_[lcp]) {
+    ++lcp;
+    ++label_it;
+  }
+
+  for (auto depth = lcp + 1; depth <= key_size; ++depth, ++label_it) {
+    auto& level = levels_[depth];
+    // append a child to the unary group of the last node of the previous level
+    level.louds_.set_last(false);
+    level.louds_.push_back(true);
+    level.labels_.push_back(static_cast<label_type>(*label_it));
+    level.outs_.push_back(false);
+    // open an empty children group for the new node
+    levels_[depth + 1].louds_.push_back(true);
+  }
+
+  levels_[key_size].outs_.set_last(true);
+  ++levels_[key_size].num_outputs_;
+  last_key_.assign(labels_begin, labels_end);
+  ++n_keys_;
+}
+
+template <typename LabelType>
+void trie<LabelType>::build(cuda::stream_ref stream)
+{
+  if (is_built_) { return; }
+
+  std::vector<level_ref_type> level_refs;
+  level_refs.reserve(levels_.size());
+
+  size_type offset = 0;
+  for (auto& level : levels_) {
+    level.louds_.build(stream);
+    level.outs_.build(stream);
+    level.d_labels_ = level.labels_;
+    level_refs.push_back(level_ref_type{level.louds_.ref(),
+                                        level.outs_.ref(),
+                                        thrust::raw_pointer_cast(level.d_labels_.data()),
+                                        offset});
+    offset += level.num_outputs_;
+  }
+
+  level_refs_ = level_refs;
+  is_built_   = true;
+}
+
+template <typename LabelType>
+template <typename LabelIt, typename OffsetIt, typename OutputIt>
+void trie<LabelType>::lookup(LabelIt labels_begin,
+                             OffsetIt offsets_begin,
+                             OffsetIt offsets_end,
+                             OutputIt outputs_begin,
+                             cuda::stream_ref stream) const
+{
+  auto const num_keys = cuco::detail::distance(offsets_begin, offsets_end) - 1;
+  if (num_keys <= 0) { return; }
+
+  auto const grid_size = cuco::detail::grid_size(num_keys);
+
+  detail::trie_lookup_kernel<<<grid_size, cuco::detail::default_block_size(), 0, stream.get()>>>(
+    this->ref(), labels_begin, offsets_begin, outputs_begin, num_keys);
+}
+
+template <typename LabelType>
+template <typename LabelIt, typename OffsetIt, typename OutputIt>
+void trie<LabelType>::prefix_count(LabelIt labels_begin,
+                                   OffsetIt offsets_begin,
+                                   OffsetIt offsets_end,
+                                   OutputIt outputs_begin,
+                                   cuda::stream_ref stream) const
+{
+  auto const num_keys = cuco::detail::distance(offsets_begin, offsets_end) - 1;
+  if (num_keys <= 0) { return; }
+
+  auto const grid_size = cuco::detail::grid_size(num_keys);
+
+  detail::trie_prefix_count_kernel<<<grid_size,
+                                     cuco::detail::default_block_size(),
+                                     0,
+                                     stream.get()>>>(
+    this->ref(), labels_begin, offsets_begin, outputs_begin, num_keys);
+}
+
+template <typename LabelType>
+typename trie<LabelType>::size_type trie<LabelType>::size() const noexcept
+{
+  return n_keys_;
+}
+
+template <typename LabelType>
+typename trie<LabelType>::ref_type trie<LabelType>::ref() const
+{
+  CUCO_EXPECTS(is_built_, "The trie must be built before accessing its device ref");
+  return ref_type{thrust::raw_pointer_cast(level_refs_.data()), levels_.size(), n_keys_};
+}
+
+}  // namespace experimental
+}  // namespace cuco
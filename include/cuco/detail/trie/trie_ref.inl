@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+namespace cuco {
+namespace experimental {
+
+template <typename LabelType>
+__host__ __device__ constexpr trie_ref<LabelType>::trie_ref(level_ref const* levels,
+                                                            size_type num_levels,
+                                                            size_type n_keys) noexcept
+  : levels_{levels}, num_levels_{num_levels}, n_keys_{n_keys}
+{
+}
+
+template <typename LabelType>
+template <typename LabelIt>
+__device__ typename trie_ref<LabelType>::size_type trie_ref<LabelType>::lookup(
+  LabelIt begin, LabelIt end) const noexcept
+{
+  size_type node_id  = 0;  // root node at level 0
+  size_type level_id = 0;
+
+  for (auto it = begin; it != end; ++it) {
+    if (++level_id >= num_levels_) { return not_found; }
+    if (not find_child(static_cast<label_type>(*it), node_id, levels_[level_id])) {
+      return not_found;
+    }
+  }
+
+  auto const& level = levels_[level_id];
+  if (not level.outs_.test(node_id)) { return not_found; }
+  return level.offset_ + level.outs_.rank(node_id);
+}
+
+template <typename LabelType>
+template <typename LabelIt>
+__device__ typename trie_ref<LabelType>::size_type trie_ref<LabelType>::prefix_count(
+  LabelIt begin, LabelIt end) const noexcept
+{
+  size_type node_id  = 0;  // root node at level 0
+  size_type level_id = 0;
+
+  for (auto it = begin; it != end; ++it) {
+    if (++level_id >= num_levels_) { return 0; }
+    if (not find_child(static_cast<label_type>(*it), node_id, levels_[level_id])) { return 0; }
+  }
+
+  // The descendants of the matched node form a contiguous node range on every deeper level, so
+  // the keys in its subtree can be counted with two rank queries per level.
+  size_type count = 0;
+  size_type lo    = node_id;
+  size_type hi    = node_id + 1;
+  for (auto depth = level_id; depth < num_levels_; ++depth) {
+    auto const& level = levels_[depth];
+    count += level.outs_.rank(hi) - level.outs_.rank(lo);
+    if (depth + 1 == num_levels_) { break; }
+
+    // descend to the children of the nodes in [lo, hi)
+    auto const& next     = levels_[depth + 1];
+    auto const begin_pos = (lo == 0) ? 0 : next.louds_.select(lo - 1) + 1;
+    auto const end_pos   = next.louds_.select(hi - 1);
+    lo                   = begin_pos - lo;
+    hi                   = end_pos - (hi - 1);
+    if (lo >= hi) { break; }
+  }
+  return count;
+}
+
+template <typename LabelType>
+__device__ bool trie_ref<LabelType>::find_child(label_type label,
+                                                size_type& node_id,
+                                                level_ref const& level) const noexcept
+{
+  // The children of node `node_id` are encoded as the `0` bits of its unary group, which is
+  // terminated by the `node_id`-th `1` bit of the level's louds bitset.
+  auto const end_pos   = level.louds_.select(node_id);
+  auto const begin_pos = (node_id == 0) ? 0 : level.louds_.select(node_id - 1) + 1;
+
+  // child node ids equal the number of `0` bits preceding their group position
+  size_type lo = begin_pos - node_id;
+  size_type hi = end_pos - node_id;
+
+  // labels of sibling nodes are sorted, so binary search for the queried label
+  while (lo < hi) {
+    auto const mid       = lo + (hi - lo) / 2;
+    auto const mid_label = level.labels_[mid];
+    if (mid_label == label) {
+      node_id = mid;
+      return true;
+    }
+    if (mid_label < label) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return false;
+}
+
+}  // namespace experimental
+}  // namespace cuco
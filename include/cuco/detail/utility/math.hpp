@@ -42,5 +42,27 @@ constexpr T int_div_ceil(T dividend, U divisor) noexcept
   return (dividend + divisor - 1) / divisor;
 }
 
+/**
+ * @brief Rounds the given value up to the next power of two
+ *
+ * @tparam T Value type
+ *
+ * @throw If `T` is not an integral type
+ *
+ * @param value The value to round up
+ *
+ * @return The smallest power of two that is no smaller than `value`
+ */
+template <typename T>
+constexpr T next_power_of_two(T value) noexcept
+{
+  static_assert(std::is_integral_v<T>);
+  T result = 1;
+  while (result < value) {
+    result *= 2;
+  }
+  return result;
+}
+
 }  // namespace detail
 }  // namespace cuco
@@ -22,6 +22,7 @@
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/cuda_thread_scope.cuh>
 
+#include <cuda/std/span>
 #include <cuda/stream_ref>
 
 #include <cstddef>
@@ -213,6 +214,36 @@ class distinct_count_estimator {
   template <cuda::thread_scope OtherScope>
   constexpr void merge(ref_type<OtherScope> const& other_ref, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Asynchronously merges a batch of contiguous sketches into `*this` estimator.
+   *
+   * @note Registers are max-reduced over all given sketches by a single tree-structured kernel,
+   * i.e., merging N sketches costs one launch instead of N. This serves roll-ups over many
+   * per-batch sketches, e.g., the storage of a `cuco::distinct_count_estimator_array`.
+   *
+   * @throw If `sketches.size()` is not a multiple of `this->sketch_bytes()`
+   *
+   * @param sketches Contiguous storage holding the to-be-merged sketches; each sketch must have
+   * the same size as `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void merge_many_async(cuda::std::span<std::byte const> sketches,
+                                  cuda::stream_ref stream = {});
+
+  /**
+   * @brief Merges a batch of contiguous sketches into `*this` estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `merge_many_async`.
+   *
+   * @throw If `sketches.size()` is not a multiple of `this->sketch_bytes()`
+   *
+   * @param sketches Contiguous storage holding the to-be-merged sketches; each sketch must have
+   * the same size as `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void merge_many(cuda::std::span<std::byte const> sketches, cuda::stream_ref stream = {});
+
   /**
    * @brief Compute the estimated distinct items count.
    *
@@ -0,0 +1,225 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/detail/hyperloglog/hyperloglog_array.cuh>
+#include <cuco/distinct_count_estimator_ref.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/types.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <cuda/std/span>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace cuco {
+/**
+ * @brief A GPU-accelerated utility for approximating per-group distinct counts in a single pass.
+ *
+ * @note This class maintains one HLL sketch per group in a single contiguous allocation and
+ * updates all of them with a single kernel launch taking (group id, item) pairs, serving
+ * `COUNT(DISTINCT x) GROUP BY k` workloads without one kernel launch per group. Likewise, all
+ * sketches are finalized by a single batched `estimate`. If the whole sketch array fits into
+ * shared memory, updates are staged in block-local sketches and merged into global memory once per
+ * block.
+ *
+ * @tparam T Type of items to count
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam Hash Hash function used to hash items
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class T,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class Hash               = cuco::xxhash_64<T>,
+          class Allocator          = cuco::cuda_allocator<std::byte>>
+class distinct_count_estimator_array {
+  using impl_type = detail::hyperloglog_array<T, Scope, Hash, Allocator>;
+
+ public:
+  static constexpr auto thread_scope = impl_type::thread_scope;  ///< CUDA thread scope
+
+  template <cuda::thread_scope NewScope = thread_scope>
+  using ref_type = cuco::distinct_count_estimator_ref<T, NewScope, Hash>;  ///< Non-owning reference
+                                                                           ///< type
+
+  using value_type     = typename impl_type::value_type;      ///< Type of items to count
+  using hasher         = typename impl_type::hasher;          ///< Type of hash function
+  using allocator_type = typename impl_type::allocator_type;  ///< Allocator type
+
+  /**
+   * @brief Constructs a `distinct_count_estimator_array` host object.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param num_sketches Number of sketches, i.e., distinct groups
+   * @param sketch_size_kb Maximum sketch size in KB (per sketch)
+   * @param hash The hash function used to hash items
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the object
+   */
+  constexpr distinct_count_estimator_array(std::size_t num_sketches,
+                                           cuco::sketch_size_kb sketch_size_kb = 32_KB,
+                                           Hash const& hash                    = {},
+                                           Allocator const& alloc              = {},
+                                           cuda::stream_ref stream             = {});
+
+  ~distinct_count_estimator_array() = default;
+
+  distinct_count_estimator_array(distinct_count_estimator_array const&) = delete;
+  distinct_count_estimator_array& operator=(distinct_count_estimator_array const&) = delete;
+  distinct_count_estimator_array(distinct_count_estimator_array&&) =
+    default;  ///< Move constructor
+
+  /**
+   * @brief Copy-assignment operator.
+   *
+   * @return Copy of `*this`
+   */
+  distinct_count_estimator_array& operator=(distinct_count_estimator_array&&) = default;
+
+  /**
+   * @brief Asynchronously resets all estimators, i.e., clears the current count estimates.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear_async(cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Resets all estimators, i.e., clears the current count estimates.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `clear_async`.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously adds to be counted (group id, item) pairs to the estimators.
+   *
+   * @note Behavior is undefined if a group id is `>= num_sketches()`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   * @tparam GroupIt Device accessible random access input iterator whose `value_type` is
+   * convertible to `std::size_t`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param group_first Beginning of the sequence of group ids
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt, class GroupIt>
+  constexpr void add_async(InputIt first,
+                           InputIt last,
+                           GroupIt group_first,
+                           cuda::stream_ref stream = {});
+
+  /**
+   * @brief Adds to be counted (group id, item) pairs to the estimators.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `add_async`.
+   *
+   * @note Behavior is undefined if a group id is `>= num_sketches()`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   * @tparam GroupIt Device accessible random access input iterator whose `value_type` is
+   * convertible to `std::size_t`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param group_first Beginning of the sequence of group ids
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt, class GroupIt>
+  constexpr void add(InputIt first, InputIt last, GroupIt group_first, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously computes the estimated distinct items counts of all sketches.
+   *
+   * @param cardinalities Device-accessible pointer to an array of `num_sketches()` elements the
+   * estimates are written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void estimate_async(std::size_t* cardinalities,
+                                cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Computes the estimated distinct items counts of all sketches.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `estimate_async`.
+   *
+   * @param cardinalities Device-accessible pointer to an array of `num_sketches()` elements the
+   * estimates are written to
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void estimate(std::size_t* cardinalities, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Get device ref of the sketch at position `i`.
+   *
+   * @param i Sketch index
+   *
+   * @return Device ref object of the `i`-th sketch
+   */
+  [[nodiscard]] constexpr ref_type<> ref(std::size_t i) const noexcept;
+
+  /**
+   * @brief Get hash function.
+   *
+   * @return The hash function
+   */
+  [[nodiscard]] constexpr auto hash_function() const noexcept;
+
+  /**
+   * @brief Gets the number of sketches.
+   *
+   * @return The number of sketches
+   */
+  [[nodiscard]] constexpr std::size_t num_sketches() const noexcept;
+
+  /**
+   * @brief Gets the number of bytes required for a single sketch.
+   *
+   * @return The number of bytes required for a single sketch
+   */
+  [[nodiscard]] constexpr std::size_t sketch_bytes() const noexcept;
+
+  /**
+   * @brief Gets the span of the contiguous sketch storage.
+   *
+   * @note The result can be passed to `distinct_count_estimator::merge_many` to roll up all
+   * sketches in a single launch.
+   *
+   * @return The cuda::std::span over all sketches
+   */
+  [[nodiscard]] constexpr cuda::std::span<std::byte> sketches() const noexcept;
+
+ private:
+  std::unique_ptr<impl_type> impl_;  ///< Implementation object
+};
+}  // namespace cuco
+
+#include <cuco/detail/distinct_count_estimator/distinct_count_estimator_array.inl>
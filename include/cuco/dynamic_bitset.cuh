@@ -0,0 +1,44 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/trie/dynamic_bitset/dynamic_bitset.cuh>
+
+#include <thrust/device_malloc_allocator.h>
+
+#include <cstddef>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief A growable GPU bitset with rank and select support.
+ *
+ * Bits are appended on the host via `push_back` while `build` constructs the device-side rank and
+ * select acceleration structures. Afterwards the bulk `test`, `rank` and `select` host APIs — or
+ * the device `ref` — answer queries in close to constant time. Beyond its use inside the trie,
+ * the bitset is useful as a standalone container for validity masks and other bitmap indexes;
+ * sparse bitmaps additionally get a materialized select index that answers `select` with a single
+ * memory load (see `dynamic_bitset::sparse_selects_factor`).
+ *
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class Allocator = thrust::device_malloc_allocator<std::byte>>
+using dynamic_bitset = detail::dynamic_bitset<Allocator>;
+
+}  // namespace experimental
+}  // namespace cuco
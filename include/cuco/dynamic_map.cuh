@@ -20,12 +20,22 @@
 #include <cuco/hash_functions.cuh>
 #include <cuco/static_map.cuh>
 #include <cuco/types.cuh>
+#include <cuco/utility/allocator.hpp>
 
 #include <cuda/std/atomic>
+#include <thrust/copy.h>
 #include <thrust/device_vector.h>
+#include <thrust/distance.h>
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/remove.h>
+#include <thrust/tuple.h>
 
 #include <cstddef>
+#include <limits>
 #include <memory>
 #include <type_traits>
 #include <vector>
@@ -173,7 +183,13 @@ class dynamic_map {
  * @brief A GPU-accelerated, unordered, associative container of key-value
  * pairs with unique keys
  *
- * Automatically grows capacity as necessary until device memory runs out.
+ * Automatically grows capacity as necessary. Once device memory is exhausted, or once the
+ * device capacity limit set via `set_device_capacity_limit` is reached, further growth spills
+ * into an overflow tier of submaps whose storage is allocated through `OverflowAllocator`
+ * (managed memory by default), so the map keeps accepting insertions instead of failing with an
+ * out-of-memory error. Lookups probe the device-resident submaps first and only the keys missing
+ * from the device tier are batched against the overflow tier; `promote` migrates hot entries from
+ * the overflow tier back into device submaps.
  *
  * Allows constant time concurrent inserts or concurrent find operations (not
  * concurrent insert and find) from threads in device code.
@@ -228,11 +244,14 @@ class dynamic_map {
  * @tparam Scope The scope in which insert/find/contains will be performed by
  * individual threads.
  * @tparam Allocator Type of allocator used to allocate submap device storage
+ * @tparam OverflowAllocator Type of allocator used to allocate overflow-tier submap storage; the
+ * allocated memory must be device accessible (e.g. managed or pinned host memory)
  */
 template <typename Key,
           typename Value,
-          cuda::thread_scope Scope = cuda::thread_scope_device,
-          typename Allocator       = cuco::cuda_allocator<char>>
+          cuda::thread_scope Scope   = cuda::thread_scope_device,
+          typename Allocator         = cuco::cuda_allocator<char>,
+          typename OverflowAllocator = cuco::managed_allocator<char>>
 class dynamic_map {
   static_assert(std::is_arithmetic<Key>::value, "Unsupported, non-arithmetic key type.");
 
@@ -248,6 +267,12 @@ class dynamic_map {
     typename cuco::legacy::static_map<Key, Value, Scope>::device_mutable_view;  ///< Type for submap
                                                                                 ///< mutable device
                                                                                 ///< view
+  using overflow_view_type =
+    typename cuco::legacy::static_map<Key, Value, Scope, OverflowAllocator>::
+      device_view;  ///< Type for overflow-tier submap device view
+  using overflow_mutable_view_type =
+    typename cuco::legacy::static_map<Key, Value, Scope, OverflowAllocator>::
+      device_mutable_view;  ///< Type for overflow-tier submap mutable device view
 
   dynamic_map(dynamic_map const&) = delete;
   dynamic_map(dynamic_map&&)      = delete;
@@ -454,6 +479,135 @@ class dynamic_map {
                 KeyEqual key_equal  = KeyEqual{},
                 cudaStream_t stream = nullptr);
 
+  /**
+   * @brief Migrates the keys in the range `[first, last)` from the overflow tier back into
+   * device submaps.
+   *
+   * For each key `k` in `[first, last)` that currently resides in an overflow-tier submap, removes
+   * `k` and its associated value from the overflow tier and reinserts the pair through the regular
+   * bulk-insert path, which fills device submaps first. Keys absent from the overflow tier are
+   * ignored. This is intended for hot entries that were spilled to the (slower) overflow tier while
+   * the device tier was full and whose device capacity has since been freed, e.g. by `erase`.
+   *
+   * Has no effect if the overflow tier is empty or if the device tier has no spare capacity left
+   * to receive promoted entries.
+   *
+   * This function synchronizes `stream`.
+   *
+   * @tparam InputIt Device accessible input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   * @tparam Hash Unary callable type
+   * @tparam KeyEqual Binary callable type
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param hash The unary function to apply to hash each key
+   * @param key_equal The binary function to compare two keys for equality
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename InputIt,
+            typename Hash     = cuco::default_hash_function<key_type>,
+            typename KeyEqual = thrust::equal_to<key_type>>
+  void promote(InputIt first,
+               InputIt last,
+               Hash hash           = Hash{},
+               KeyEqual key_equal  = KeyEqual{},
+               cudaStream_t stream = nullptr);
+
+  /**
+   * @brief Merges the contents of all submaps into a single right-sized submap.
+   *
+   * Every submap added by capacity growth increases the number of tables `find` and `contains`
+   * have to probe, so lookup performance degrades as the map grows. Consolidation restores
+   * single-table lookup cost. The consolidated submap is sized such that all elements fit below
+   * the maximum load factor; the previous submap storage is released.
+   *
+   * This function synchronizes `stream`. Has no effect if the map consists of a single submap.
+   *
+   * @tparam Hash Unary callable type
+   * @tparam KeyEqual Binary callable type
+   *
+   * @param hash The unary function to apply to hash each key
+   * @param key_equal The binary function to compare two keys for equality
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename Hash     = cuco::default_hash_function<key_type>,
+            typename KeyEqual = thrust::equal_to<key_type>>
+  void consolidate(Hash hash = Hash{}, KeyEqual key_equal = KeyEqual{}, cudaStream_t stream = nullptr);
+
+  /**
+   * @brief Sets the number of submaps at which the map consolidates itself automatically.
+   *
+   * If the number of submaps is greater than or equal to `num_submaps` after a bulk `insert`, the
+   * map invokes `consolidate` before returning. A threshold of `0` (the default) disables
+   * automatic consolidation.
+   *
+   * @param num_submaps The number of submaps that triggers consolidation
+   */
+  void set_consolidation_threshold(std::size_t num_submaps) noexcept
+  {
+    consolidation_threshold_ = num_submaps;
+  }
+
+  /**
+   * @brief Gets the number of submaps at which the map consolidates itself automatically.
+   *
+   * @return The automatic consolidation threshold; `0` if disabled
+   */
+  std::size_t get_consolidation_threshold() const noexcept { return consolidation_threshold_; }
+
+  /**
+   * @brief Sets the maximum number of slots the map may allocate in device memory.
+   *
+   * Once the combined capacity of the device-resident submaps has reached `num_slots`, capacity
+   * growth creates submaps in the overflow tier instead. The default is unlimited, i.e. the map
+   * only spills to the overflow tier once a device memory allocation fails.
+   *
+   * @param num_slots The maximum combined capacity of the device-resident submaps
+   */
+  void set_device_capacity_limit(std::size_t num_slots) noexcept
+  {
+    device_capacity_limit_ = num_slots;
+  }
+
+  /**
+   * @brief Gets the maximum number of slots the map may allocate in device memory.
+   *
+   * @return The maximum combined capacity of the device-resident submaps
+   */
+  std::size_t get_device_capacity_limit() const noexcept { return device_capacity_limit_; }
+
+  /**
+   * @brief Gets the current number of device-resident submaps backing the map.
+   *
+   * @return The current number of device-resident submaps
+   */
+  std::size_t get_num_submaps() const noexcept { return submaps_.size(); }
+
+  /**
+   * @brief Gets the current number of overflow-tier submaps backing the map.
+   *
+   * @return The current number of overflow-tier submaps
+   */
+  std::size_t get_num_overflow_submaps() const noexcept { return overflow_submaps_.size(); }
+
+  /**
+   * @brief Gets the current number of elements residing in the overflow tier.
+   *
+   * @return The current number of elements residing in the overflow tier
+   */
+  std::size_t get_overflow_size() const noexcept
+  {
+    std::size_t size = 0;
+    for (auto const& submap : overflow_submaps_) {
+      size += submap->get_size();
+    }
+    return size;
+  }
+
   /**
    * @brief Gets the current number of elements in the map
    *
@@ -476,6 +630,41 @@ class dynamic_map {
   float get_load_factor() const noexcept { return static_cast<float>(size_) / capacity_; }
 
  private:
+  /**
+   * @brief Gets the combined capacity of the device-resident submaps.
+   *
+   * @return The combined capacity of the device-resident submaps
+   */
+  std::size_t get_device_capacity() const noexcept
+  {
+    std::size_t capacity = 0;
+    for (auto const& submap : submaps_) {
+      capacity += submap->get_capacity();
+    }
+    return capacity;
+  }
+
+  /**
+   * @brief Attempts to add a device-resident submap with `submap_capacity` slots.
+   *
+   * Fails if the device capacity limit would be exceeded or if the device memory allocation
+   * fails; an allocation failure permanently routes future growth to the overflow tier.
+   *
+   * @param submap_capacity The number of slots of the new submap
+   * @param stream Stream used for executing the kernels
+   *
+   * @return `true` iff the submap was added
+   */
+  bool try_add_device_submap(std::size_t submap_capacity, cudaStream_t stream);
+
+  /**
+   * @brief Adds an overflow-tier submap with `submap_capacity` slots.
+   *
+   * @param submap_capacity The number of slots of the new submap
+   * @param stream Stream used for executing the kernels
+   */
+  void add_overflow_submap(std::size_t submap_capacity, cudaStream_t stream);
+
   key_type empty_key_sentinel_{};       ///< Key value that represents an empty slot
   mapped_type empty_value_sentinel_{};  ///< Initial value of empty slot
   key_type erased_key_sentinel_{};      ///< Key value that represents an erased slot
@@ -491,9 +680,31 @@ class dynamic_map {
   thrust::device_vector<mutable_view_type>
     submap_mutable_views_;         ///< vector of mutable device views for each submap
   std::size_t min_insert_size_{};  ///< min remaining capacity of submap for insert
+  std::size_t consolidation_threshold_{};  ///< Number of submaps triggering automatic
+                                           ///< consolidation; 0 if disabled
   thrust::device_vector<atomic_ctr_type*>
     submap_num_successes_;  ///< Number of successfully erased keys for each submap
   Allocator alloc_{};       ///< Allocator passed to submaps to allocate their device storage
+
+  std::vector<
+    std::unique_ptr<cuco::legacy::static_map<key_type, mapped_type, Scope, OverflowAllocator>>>
+    overflow_submaps_;  ///< vector of pointers to each overflow-tier submap
+  thrust::device_vector<overflow_view_type>
+    overflow_submap_views_;  ///< vector of device views for each overflow-tier submap
+  thrust::device_vector<overflow_mutable_view_type>
+    overflow_submap_mutable_views_;  ///< vector of mutable device views for each overflow-tier
+                                     ///< submap
+  thrust::device_vector<atomic_ctr_type*>
+    overflow_submap_num_successes_;  ///< Number of successfully erased keys for each overflow-tier
+                                     ///< submap
+  std::size_t device_capacity_limit_{
+    std::numeric_limits<std::size_t>::max()};  ///< Max combined capacity of the device-resident
+                                               ///< submaps before growth spills to the overflow
+                                               ///< tier
+  bool device_exhausted_{false};   ///< True once a device memory allocation has failed; all
+                                   ///< subsequent growth goes to the overflow tier
+  OverflowAllocator overflow_alloc_{};  ///< Allocator passed to overflow-tier submaps to allocate
+                                        ///< their storage
 };
 }  // namespace cuco
 
@@ -72,6 +72,61 @@ struct extent<SizeType, dynamic_extent> {
   value_type value_;  ///< Extent value
 };
 
+/**
+ * @brief Static power-of-two extent class.
+ *
+ * @note Passing this type as a container's `Extent` template parameter requests capacities that are
+ * rounded up to the next power of two instead of the next prime. Probing schemes then reduce slot
+ * indices with a bitwise AND instead of a modulo operation, which saves several instructions per
+ * probe step at the cost of coarser capacity granularity.
+ *
+ * @tparam SizeType Size type
+ * @tparam N Extent
+ */
+template <typename SizeType, std::size_t N = dynamic_extent>
+struct power_of_two_extent {
+  using value_type = SizeType;  ///< Extent value type
+
+  constexpr power_of_two_extent() = default;
+
+  /// Constructs from `SizeType`
+  __host__ __device__ constexpr power_of_two_extent(SizeType) noexcept {}
+
+  /**
+   * @brief Conversion to value_type.
+   *
+   * @return Extent size
+   */
+  __host__ __device__ constexpr operator value_type() const noexcept { return N; }
+};
+
+/**
+ * @brief Dynamic power-of-two extent class.
+ *
+ * @tparam SizeType Size type
+ */
+template <typename SizeType>
+struct power_of_two_extent<SizeType, dynamic_extent> {
+  using value_type = SizeType;  ///< Extent value type
+
+  /**
+   * @brief Constructs extent from a given `size`.
+   *
+   * @param size The extent size
+   */
+  __host__ __device__ constexpr power_of_two_extent(SizeType size) noexcept : value_{size} {}
+
+  /**
+   * @brief Conversion to value_type.
+   *
+   * @return Extent size
+   */
+  __host__ __device__ constexpr operator value_type() const noexcept { return value_; }
+
+ private:
+  value_type value_;  ///< Extent value
+};
+
 /**
  * @brief Window extent strong type.
  *
@@ -85,6 +140,19 @@ struct extent<SizeType, dynamic_extent> {
 template <typename SizeType, std::size_t N = dynamic_extent>
 struct window_extent;
 
+/**
+ * @brief Power-of-two window extent strong type.
+ *
+ * @note This type is used internally and can only be constructed using the `make_window_extent'
+ * factory method. Index reduction is performed with a bitwise AND instead of a modulo operation.
+ *
+ * @tparam SizeType Size type
+ * @tparam N Extent
+ *
+ */
+template <typename SizeType, std::size_t N = dynamic_extent>
+struct power_of_two_window_extent;
+
 /**
  * @brief Computes a valid window extent/capacity for a given container type.
  *
@@ -107,6 +175,28 @@ struct window_extent;
 template <typename Container, typename SizeType, std::size_t N>
 [[nodiscard]] auto constexpr make_window_extent(extent<SizeType, N> ext);
 
+/**
+ * @brief Computes a valid power-of-two window extent/capacity for a given container type.
+ *
+ * @note The actual capacity of a container (map/set) should be exclusively determined by the return
+ * value of this utility since the output depends on the requested low-bound size, the probing
+ * scheme, and the storage. This utility is used internally during container constructions while for
+ * container ref constructions, it would be users' responsibility to use this function to determine
+ * the capacity ctor argument for the container.
+ *
+ * @tparam Container Container type to compute the extent for
+ * @tparam SizeType Size type
+ * @tparam N Extent
+ *
+ * @param ext The input extent
+ *
+ * @throw If the input extent is invalid
+ *
+ * @return Resulting valid `power-of-two window extent`
+ */
+template <typename Container, typename SizeType, std::size_t N>
+[[nodiscard]] auto constexpr make_window_extent(power_of_two_extent<SizeType, N> ext);
+
 /**
  * @brief Computes a valid capacity for a given container type.
  *
@@ -151,6 +241,29 @@ template <typename Container, typename SizeType>
 template <int32_t CGSize, int32_t WindowSize, typename SizeType, std::size_t N>
 [[nodiscard]] auto constexpr make_window_extent(extent<SizeType, N> ext);
 
+/**
+ * @brief Computes valid power-of-two window extent based on given parameters.
+ *
+ * @note The actual capacity of a container (map/set) should be exclusively determined by the return
+ * value of this utility since the output depends on the requested low-bound size, the probing
+ * scheme, and the storage. This utility is used internally during container constructions while for
+ * container ref constructions, it would be users' responsibility to use this function to determine
+ * the input size of the ref.
+ *
+ * @tparam CGSize Number of elements handled per CG
+ * @tparam WindowSize Number of elements handled per Window
+ * @tparam SizeType Size type
+ * @tparam N Extent
+ *
+ * @param ext The input extent
+ *
+ * @throw If the input extent is invalid
+ *
+ * @return Resulting valid power-of-two extent
+ */
+template <int32_t CGSize, int32_t WindowSize, typename SizeType, std::size_t N>
+[[nodiscard]] auto constexpr make_window_extent(power_of_two_extent<SizeType, N> ext);
+
 /**
  * @brief Computes valid window extent/capacity based on given parameters.
  *
@@ -96,6 +96,18 @@ using xxhash_32 = detail::XXHash_32<Key>;
 template <typename Key>
 using xxhash_64 = detail::XXHash_64<Key>;
 
+/**
+ * @brief A 64-bit `XXH3` hash function to hash the given argument on host and device.
+ *
+ * Compared to `xxhash_64`, this function is significantly faster on medium-sized and large keys.
+ * It additionally provides a cooperative overload that lets the threads of a probing group hash
+ * one wide key jointly.
+ *
+ * @tparam Key The type of the values to hash
+ */
+template <typename Key>
+using xxhash3_64 = detail::XXH3_64<Key>;
+
 /**
  * @brief Default hash function.
  *
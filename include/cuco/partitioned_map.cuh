@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/hash_functions.cuh>
+#include <cuco/probing_scheme.cuh>
+#include <cuco/static_map.cuh>
+#include <cuco/storage.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/cuda_thread_scope.cuh>
+#include <cuco/utility/traits.hpp>
+
+#include <cuda/std/atomic>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace cuco {
+
+/**
+ * @brief A GPU-accelerated, key-value store hash-partitioned across multiple GPUs.
+ *
+ * Keys are assigned to one of the participating devices by a dedicated partitioner hash and stored
+ * in a per-device `cuco::static_map`. Bulk operations partition their input on the calling device,
+ * exchange the per-partition chunks via peer-to-peer copies, and execute the local kernels on one
+ * stream per device so that the exchange and the local probes of different partitions overlap.
+ *
+ * @note Peer access between all participating devices is enabled on a best-effort basis at
+ * construction; if a device pair lacks NVLink/PCIe peer capability the exchange transparently
+ * falls back to staging through host memory.
+ * @note Bulk operations are synchronous: they complete all cross-device work before returning.
+ * The given stream is used for the partitioning and scatter work on the calling device and is
+ * synchronized along with the internal per-device streams.
+ * @note Input and output ranges of bulk operations must be accessible on the calling device.
+ *
+ * @tparam Key Type used for keys. Requires `cuco::is_bitwise_comparable_v<Key>`
+ * @tparam T Type of the mapped values
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam KeyEqual Binary callable type used to compare two keys for equality
+ * @tparam ProbingScheme Probing scheme (see `include/cuco/probing_scheme.cuh` for choices)
+ * @tparam Allocator Type of allocator used for device storage
+ * @tparam Storage Slot window storage type
+ */
+template <class Key,
+          class T,
+          cuda::thread_scope Scope  = cuda::thread_scope_device,
+          class KeyEqual            = thrust::equal_to<Key>,
+          class ProbingScheme       = cuco::double_hashing<4,  // CG size
+                                                     cuco::default_hash_function<Key>>,
+          class Allocator           = cuco::cuda_allocator<cuco::pair<Key, T>>,
+          class Storage             = cuco::storage<1>>
+class partitioned_map {
+ public:
+  /// Per-device map type
+  using map_type = static_map<Key,
+                              T,
+                              cuco::extent<std::size_t>,
+                              Scope,
+                              KeyEqual,
+                              ProbingScheme,
+                              Allocator,
+                              Storage>;
+
+  using key_type    = typename map_type::key_type;     ///< Key type
+  using mapped_type = typename map_type::mapped_type;  ///< Payload type
+  using value_type  = typename map_type::value_type;   ///< Key-value pair type
+  using size_type   = typename map_type::size_type;    ///< Size type
+  /// Partitioner hash type; seeded differently from the probing hash to avoid correlating the
+  /// partition index with the probe sequence
+  using partitioner_hash_type = cuco::default_hash_function<Key>;
+
+  /**
+   * @brief Constructs a partitioned map over the given devices.
+   *
+   * Each device holds a `static_map` with a capacity of at least `capacity / devices.size()`
+   * slots; an internal stream and event are created per device.
+   *
+   * @throw If `devices` is empty
+   *
+   * @param devices Ordinals of the participating CUDA devices
+   * @param capacity The requested lower-bound total map size
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param empty_value_sentinel The reserved mapped value for empty slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param scope The scope in which operations will be performed
+   * @param storage Kind of storage to use
+   * @param alloc Allocator used for allocating device storage
+   */
+  partitioned_map(std::vector<int> devices,
+                  size_type capacity,
+                  empty_key<Key> empty_key_sentinel,
+                  empty_value<T> empty_value_sentinel,
+                  KeyEqual const& pred                = {},
+                  ProbingScheme const& probing_scheme = {},
+                  cuda_thread_scope<Scope> scope      = {},
+                  Storage storage                     = {},
+                  Allocator const& alloc              = {});
+
+  ~partitioned_map();
+
+  partitioned_map(partitioned_map const&)            = delete;
+  partitioned_map(partitioned_map&&)                 = delete;
+  partitioned_map& operator=(partitioned_map const&) = delete;
+  partitioned_map& operator=(partitioned_map&&)      = delete;
+
+  /**
+   * @brief Inserts all elements in the range `[first, last)`.
+   *
+   * Elements are bucketed by their partition on the calling device, exchanged to their owning
+   * devices via peer-to-peer copies, and inserted by the per-device streams concurrently.
+   *
+   * @note This function synchronizes the given stream and the internal per-device streams.
+   *
+   * @tparam InputIt Device accessible random access input iterator whose `value_type` is
+   * convertible to the map's `value_type`
+   *
+   * @param first Beginning of the sequence of elements
+   * @param last End of the sequence of elements
+   * @param stream CUDA stream used for the partitioning work on the calling device
+   */
+  template <typename InputIt>
+  void insert(InputIt first, InputIt last, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the map.
+   *
+   * @note This function synchronizes the given stream and the internal per-device streams.
+   *
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream CUDA stream used for the partitioning and scatter work on the calling device
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains(InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream = {});
+
+  /**
+   * @brief For all keys in the range `[first, last)`, finds a payload with its key equivalent to
+   * the query key.
+   *
+   * @note If the key `*(first + i)` has a match in its partition, copies the payload of the match
+   * to `(output_begin + i)`. Else, copies the empty value sentinel.
+   * @note This function synchronizes the given stream and the internal per-device streams.
+   *
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from the map's
+   * `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param stream CUDA stream used for the partitioning and scatter work on the calling device
+   */
+  template <typename InputIt, typename OutputIt>
+  void find(InputIt first, InputIt last, OutputIt output_begin, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Gets the total number of elements across all partitions.
+   *
+   * @note This function synchronizes the internal per-device streams.
+   *
+   * @return The number of elements in the map
+   */
+  [[nodiscard]] size_type size() const;
+
+  /**
+   * @brief Gets the total slot capacity across all partitions.
+   *
+   * @return The maximum number of elements the map can hold
+   */
+  [[nodiscard]] size_type capacity() const noexcept;
+
+  /**
+   * @brief Gets the number of partitions, i.e., participating devices.
+   *
+   * @return The number of partitions
+   */
+  [[nodiscard]] size_type num_partitions() const noexcept;
+
+  /**
+   * @brief Erases all elements from all partitions.
+   *
+   * @note This function synchronizes the internal per-device streams.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the sentinel value used to represent an empty value slot.
+   *
+   * @return The sentinel value used to represent an empty value slot
+   */
+  [[nodiscard]] mapped_type empty_value_sentinel() const noexcept;
+
+ private:
+  /**
+   * @brief Partitions the host-visible key range, exchanges the chunks, applies `issue_op` per
+   * partition, and scatters the gathered results back to `output_begin`.
+   *
+   * @tparam OutT Result element type staged per partition
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam OutputIt Device accessible random access output iterator
+   * @tparam IssueOp Callable issuing the local lookup for one partition, invoked as
+   * `issue_op(partition, device_keys, num_keys, device_results, stream)`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the output sequence
+   * @param issue_op Callable issuing the per-partition lookup
+   * @param stream CUDA stream used on the calling device
+   */
+  template <typename OutT, typename InputIt, typename OutputIt, typename IssueOp>
+  void partitioned_lookup(
+    InputIt first, InputIt last, OutputIt output_begin, IssueOp&& issue_op, cuda::stream_ref stream);
+
+  std::vector<int> devices_;                        ///< Participating device ordinals
+  std::vector<cudaStream_t> streams_;               ///< One stream per device
+  std::vector<cudaEvent_t> events_;                 ///< One synchronization event per device
+  std::vector<std::unique_ptr<map_type>> submaps_;  ///< One local map per device
+};
+
+}  // namespace cuco
+
+#include <cuco/detail/partitioned_map/partitioned_map.inl>
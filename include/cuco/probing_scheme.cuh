@@ -93,6 +93,13 @@ class linear_probing : private detail::probing_scheme_base<CGSize> {
     ProbeKey const& probe_key,
     Extent upper_bound) const noexcept;
 
+  /**
+   * @brief Gets the function used to hash keys.
+   *
+   * @return The function used to hash keys
+   */
+  [[nodiscard]] __host__ __device__ constexpr Hash hash_function() const noexcept;
+
  private:
   Hash hash_;
 };
@@ -195,6 +202,13 @@ class double_hashing : private detail::probing_scheme_base<CGSize> {
     ProbeKey const& probe_key,
     Extent upper_bound) const noexcept;
 
+  /**
+   * @brief Gets the function used to hash keys, i.e., the first hasher.
+   *
+   * @return The function used to hash keys
+   */
+  [[nodiscard]] __host__ __device__ constexpr Hash1 hash_function() const noexcept;
+
  private:
   Hash1 hash1_;
   Hash2 hash2_;
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cuco/detail/hyperloglog/sparse_hyperloglog.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/types.cuh>
+#include <cuco/utility/allocator.hpp>
+#include <cuco/utility/cuda_thread_scope.cuh>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+
+namespace cuco {
+/**
+ * @brief A memory-frugal variant of `cuco::distinct_count_estimator` for small cardinalities.
+ *
+ * @note Instead of eagerly materializing the dense HLL register array, this estimator records the
+ * raw item hashes in a small append buffer (akin to the HyperLogLog++ sparse encoding) and
+ * promotes itself to the dense representation once the buffer overflows. For estimators that stay
+ * below the sparse capacity -- e.g., the vast majority of groups in a group-by-distinct workload
+ * -- device storage stays at `sparse_capacity` hash values instead of the full dense sketch size,
+ * so many more sketches can be kept resident.
+ * @note While in sparse mode, estimates are bit-identical to the ones the promoted dense
+ * estimator would produce.
+ *
+ * @tparam T Type of items to count
+ * @tparam Scope The scope in which operations will be performed by individual threads
+ * @tparam Hash Hash function used to hash items
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <class T,
+          cuda::thread_scope Scope = cuda::thread_scope_device,
+          class Hash               = cuco::xxhash_64<T>,
+          class Allocator          = cuco::cuda_allocator<std::byte>>
+class sparse_distinct_count_estimator {
+  using impl_type = detail::sparse_hyperloglog<T, Scope, Hash, Allocator>;
+
+ public:
+  static constexpr auto thread_scope = impl_type::thread_scope;  ///< CUDA thread scope
+
+  using value_type     = typename impl_type::value_type;      ///< Type of items to count
+  using hasher         = typename impl_type::hasher;          ///< Type of hash function
+  using allocator_type = typename impl_type::allocator_type;  ///< Allocator type
+
+  static constexpr std::size_t default_sparse_capacity = 128;  ///< Default sparse buffer capacity
+
+  /**
+   * @brief Constructs a `sparse_distinct_count_estimator` host object.
+   *
+   * @param sketch_size_kb Maximum dense sketch size in KB; used once the estimator is promoted
+   * @param sparse_capacity Maximum number of items held in the sparse buffer before promotion
+   * @param hash The hash function used to hash items
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to initialize the object
+   */
+  constexpr sparse_distinct_count_estimator(
+    cuco::sketch_size_kb sketch_size_kb = 32_KB,
+    std::size_t sparse_capacity         = default_sparse_capacity,
+    Hash const& hash                    = {},
+    Allocator const& alloc              = {},
+    cuda::stream_ref stream             = {});
+
+  ~sparse_distinct_count_estimator() = default;
+
+  sparse_distinct_count_estimator(sparse_distinct_count_estimator const&) = delete;
+  sparse_distinct_count_estimator& operator=(sparse_distinct_count_estimator const&) = delete;
+  sparse_distinct_count_estimator(sparse_distinct_count_estimator&&) =
+    default;  ///< Move constructor
+
+  /**
+   * @brief Copy-assignment operator.
+   *
+   * @return Copy of `*this`
+   */
+  sparse_distinct_count_estimator& operator=(sparse_distinct_count_estimator&&) = default;
+
+  /**
+   * @brief Asynchronously resets the estimator, i.e., clears the current count estimate.
+   *
+   * @note This function also releases the dense sketch storage if the estimator has previously
+   * been promoted, i.e., the estimator returns to sparse mode.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear_async(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Resets the estimator, i.e., clears the current count estimate.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `clear_async`.
+   *
+   * @param stream CUDA stream this operation is executed in
+   */
+  constexpr void clear(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously adds to be counted items to the estimator.
+   *
+   * @note If adding the given items would overflow the sparse buffer, the estimator is promoted
+   * to its dense representation first.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt>
+  constexpr void add_async(InputIt first, InputIt last, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Adds to be counted items to the estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `add_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * T></tt> is `true`
+   *
+   * @param first Beginning of the sequence of items
+   * @param last End of the sequence of items
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <class InputIt>
+  constexpr void add(InputIt first, InputIt last, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously merges the result of `other` estimator into `*this` estimator.
+   *
+   * @note If the merged content would overflow the sparse buffer, the estimator is promoted to
+   * its dense representation first.
+   *
+   * @throw If the dense sketch sizes of `*this` and `other` are different
+   *
+   * @tparam OtherScope Thread scope of `other` estimator
+   * @tparam OtherAllocator Allocator type of `other` estimator
+   *
+   * @param other Other estimator to be merged into `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <cuda::thread_scope OtherScope, class OtherAllocator>
+  constexpr void merge_async(
+    sparse_distinct_count_estimator<T, OtherScope, Hash, OtherAllocator> const& other,
+    cuda::stream_ref stream = {});
+
+  /**
+   * @brief Merges the result of `other` estimator into `*this` estimator.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `merge_async`.
+   *
+   * @throw If the dense sketch sizes of `*this` and `other` are different
+   *
+   * @tparam OtherScope Thread scope of `other` estimator
+   * @tparam OtherAllocator Allocator type of `other` estimator
+   *
+   * @param other Other estimator to be merged into `*this`
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <cuda::thread_scope OtherScope, class OtherAllocator>
+  constexpr void merge(
+    sparse_distinct_count_estimator<T, OtherScope, Hash, OtherAllocator> const& other,
+    cuda::stream_ref stream = {});
+
+  /**
+   * @brief Compute the estimated distinct items count.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream this operation is executed in
+   *
+   * @return Approximate distinct items count
+   */
+  [[nodiscard]] constexpr std::size_t estimate(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Get hash function.
+   *
+   * @return The hash function
+   */
+  [[nodiscard]] constexpr auto hash_function() const noexcept;
+
+  /**
+   * @brief Indicates whether the estimator is still in its sparse representation.
+   *
+   * @return `true` iff the estimator has not yet been promoted to its dense representation
+   */
+  [[nodiscard]] constexpr bool is_sparse() const noexcept;
+
+  /**
+   * @brief Gets the maximum number of items held in the sparse buffer before promotion.
+   *
+   * @return The sparse buffer capacity
+   */
+  [[nodiscard]] constexpr std::size_t sparse_capacity() const noexcept;
+
+  /**
+   * @brief Gets the number of bytes currently occupied by the sketch storage.
+   *
+   * @return The number of bytes occupied by the sketch
+   */
+  [[nodiscard]] constexpr std::size_t sketch_bytes() const noexcept;
+
+  /**
+   * @brief Gets the number of bytes required for the dense sketch storage after promotion.
+   *
+   * @return The number of bytes required for the dense sketch
+   */
+  [[nodiscard]] constexpr std::size_t dense_sketch_bytes() const noexcept;
+
+ private:
+  std::unique_ptr<impl_type> impl_;  ///< Implementation object
+
+  template <class T_, cuda::thread_scope Scope_, class Hash_, class Allocator_>
+  friend class sparse_distinct_count_estimator;
+};
+}  // namespace cuco
+
+#include <cuco/detail/distinct_count_estimator/sparse_distinct_count_estimator.inl>
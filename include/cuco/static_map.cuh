@@ -25,6 +25,7 @@
 #include <cuco/types.cuh>
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/cuda_thread_scope.cuh>
+#include <cuco/utility/probing_statistics.hpp>
 #include <cuco/utility/traits.hpp>
 
 #include <cuda/std/atomic>
@@ -264,6 +265,82 @@ class static_map {
                        Allocator const& alloc              = {},
                        cuda::stream_ref stream             = {});
 
+  /**
+   * @brief Constructs a map by restoring previously serialized slot storage, skipping slot
+   * initialization and rehashing.
+   *
+   * The construction parameters must match the ones the map was constructed with at serialization
+   * time; in particular, `capacity` must be the same value and the sentinels, key equality
+   * predicate, and probing scheme must be equivalent. Mismatches in the slot layout are detected
+   * via the serialized header and rejected; semantic mismatches (e.g., a different hasher) result
+   * in undefined behavior.
+   *
+   * @note `serialized` may point to host or device memory. The slot storage is restored with a
+   * single `cudaMemcpyAsync`, so reading the bytes from disk into a device buffer via
+   * cuFile/GPUDirect Storage and passing that buffer avoids staging through host memory entirely.
+   * @note If a non-default CUDA stream is provided, the caller is responsible for synchronizing the
+   * stream before the object is first used.
+   *
+   * @throw If the serialized header does not match the map's slot layout
+   *
+   * @param serialized Pointer to a buffer previously filled via `serialize`
+   * @param capacity The requested lower-bound map size used at serialization time
+   * @param empty_key_sentinel The reserved key value for empty slots
+   * @param empty_value_sentinel The reserved mapped value for empty slots
+   * @param erased_key_sentinel The reserved key to denote erased slots
+   * @param pred Key equality binary predicate
+   * @param probing_scheme Probing scheme
+   * @param scope The scope in which operations will be performed
+   * @param storage Kind of storage to use
+   * @param alloc Allocator used for allocating device storage
+   * @param stream CUDA stream used to restore the map
+   */
+  constexpr static_map(std::byte const* serialized,
+                       Extent capacity,
+                       empty_key<Key> empty_key_sentinel,
+                       empty_value<T> empty_value_sentinel,
+                       erased_key<Key> erased_key_sentinel,
+                       KeyEqual const& pred                = {},
+                       ProbingScheme const& probing_scheme = {},
+                       cuda_thread_scope<Scope> scope      = {},
+                       Storage storage                     = {},
+                       Allocator const& alloc              = {},
+                       cuda::stream_ref stream             = {});
+
+  /**
+   * @brief Gets the number of bytes required to serialize the map.
+   *
+   * @return The serialized size in bytes
+   */
+  [[nodiscard]] constexpr std::size_t serialized_size() const noexcept;
+
+  /**
+   * @brief Serializes the map's slot storage and layout metadata into `buffer`.
+   *
+   * The buffer can later be passed to the restoring constructor to recreate the map without
+   * rehashing its contents.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `serialize_async`.
+   * @note `buffer` may point to host or device memory and must provide at least
+   * `serialized_size()` bytes.
+   *
+   * @param buffer Pointer to the output buffer
+   * @param stream CUDA stream this operation is executed in
+   */
+  void serialize(std::byte* buffer, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously serializes the map's slot storage and layout metadata into `buffer`.
+   *
+   * @note `buffer` may point to host or device memory and must provide at least
+   * `serialized_size()` bytes.
+   *
+   * @param buffer Pointer to the output buffer
+   * @param stream CUDA stream this operation is executed in
+   */
+  void serialize_async(std::byte* buffer, cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Erases all elements from the container. After this call, `size()` returns zero.
    * Invalidates any references, pointers, or iterators referring to contained elements.
@@ -314,6 +391,53 @@ class static_map {
   template <typename InputIt>
   void insert_async(InputIt first, InputIt last, cuda::stream_ref stream = {}) noexcept;
 
+  /**
+   * @brief Asynchronously inserts all elements in the range `[first, first + *num_items)`.
+   *
+   * @note The actual number of input elements is read from device memory at kernel execution time
+   * while the launch configuration is derived from `max_num_items`, making this function safe to
+   * record into a CUDA graph (e.g. via `cuco::utility::graph_pipeline`) and replay with varying
+   * batch sizes.
+   *
+   * @tparam InputIt Device accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * static_map<K, V>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of elements
+   * @param num_items Pointer to the device memory holding the actual number of elements
+   * @param max_num_items Maximum number of elements
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt>
+  void insert_bounded_async(InputIt first,
+                            size_type const* num_items,
+                            size_type max_num_items,
+                            cuda::stream_ref stream = {}) noexcept;
+
+  /**
+   * @brief Inserts all elements in the host range `[first, last)`, overlapping H2D staging copies
+   * with the insert kernels.
+   *
+   * @note Unlike `insert`, the input range lives in (pageable) host memory. Elements are staged
+   * chunk-wise through internal pinned buffers and copied to the device on a second stream so that
+   * the copy of one chunk is hidden behind the insertion of the previous one.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator where
+   * <tt>std::is_convertible<std::iterator_traits<InputIt>::value_type,
+   * static_map<K, V>::value_type></tt> is `true`
+   *
+   * @param first Beginning of the sequence of elements
+   * @param last End of the sequence of elements
+   * @param chunk_size Number of elements staged per copy/compute pipeline step
+   * @param stream CUDA stream used for insert
+   */
+  template <typename InputIt>
+  void insert_staged(InputIt first,
+                     InputIt last,
+                     size_type chunk_size,
+                     cuda::stream_ref stream = {});
+
   /**
    * @brief Asynchronously inserts all elements in the range `[first, last)`.
    *
@@ -624,6 +748,65 @@ class static_map {
   template <typename InputIt>
   void erase_async(InputIt first, InputIt last, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Erases all key-value pairs satisfying `pred` from the map.
+   *
+   * @note This function is intended for time-windowed workloads like streaming deduplication:
+   * store an ingest epoch alongside the user data in the mapped value and evict with a predicate
+   * comparing that epoch against the current one. Evicted slots are reclaimed via the regular
+   * erase path, i.e. they stop matching lookups and become reusable by subsequent insertions.
+   * @note This function synchronizes the given stream and returns the number of evicted pairs. For
+   * asynchronous execution use `evict_if_async`.
+   *
+   * @tparam Predicate Unary device predicate invocable with a copy of a key-value pair
+   *
+   * @param pred Predicate selecting the key-value pairs to evict
+   * @param stream Stream used for executing the kernels
+   *
+   * @return Number of evicted key-value pairs
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate>
+  size_type evict_if(Predicate pred, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously erases all key-value pairs satisfying `pred` from the map.
+   *
+   * @tparam Predicate Unary device predicate invocable with a copy of a key-value pair
+   *
+   * @param pred Predicate selecting the key-value pairs to evict
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate>
+  void evict_if_async(Predicate pred, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously sweeps the next `num_windows` windows of the slot storage, erasing all
+   * key-value pairs satisfying `pred`.
+   *
+   * @note The sweep resumes where the previous call left off and wraps around at the end of the
+   * slot storage, so that periodic calls with a small `num_windows` incrementally reclaim expired
+   * pairs without a stop-the-world scan. Slots are evicted with the same CAS-based path as
+   * `erase`, making the sweep safe to overlap with concurrent lookups and insertions on other
+   * streams.
+   *
+   * @tparam Predicate Unary device predicate invocable with a copy of a key-value pair
+   *
+   * @param pred Predicate selecting the key-value pairs to evict
+   * @param num_windows Maximum number of windows to sweep
+   * @param stream Stream used for executing the kernels
+   *
+   * @throw std::runtime_error if a unique erased key sentinel value was not
+   * provided at construction
+   */
+  template <typename Predicate>
+  void sweep_evict_async(Predicate pred, size_type num_windows, cuda::stream_ref stream = {});
+
   /**
    * @brief Indicates whether the keys in the range `[first, last)` are contained in the map.
    *
@@ -662,6 +845,56 @@ class static_map {
                       OutputIt output_begin,
                       cuda::stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, first + *num_keys)` are
+   * contained in the map.
+   *
+   * @note The actual number of input keys is read from device memory at kernel execution time
+   * while the launch configuration is derived from `max_num_keys`, making this function safe to
+   * record into a CUDA graph (e.g. via `cuco::utility::graph_pipeline`) and replay with varying
+   * batch sizes.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param num_keys Pointer to the device memory holding the actual number of keys
+   * @param max_num_keys Maximum number of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_bounded_async(InputIt first,
+                              size_type const* num_keys,
+                              size_type max_num_keys,
+                              OutputIt output_begin,
+                              cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Indicates for all keys in the host range `[first, last)` whether they are contained in
+   * the map, writing the results to the host range starting at `output_begin`.
+   *
+   * @note Unlike `contains`, both the input and the output range live in (pageable) host memory.
+   * Chunks are staged through internal pinned buffers on a second stream so that the H2D and D2H
+   * copies of one chunk overlap with the probe kernel of another.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator
+   * @tparam OutputIt Host accessible random access output iterator assignable from `bool`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of booleans for the presence of each key
+   * @param chunk_size Number of keys staged per copy/compute pipeline step
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_staged(InputIt first,
+                       InputIt last,
+                       OutputIt output_begin,
+                       size_type chunk_size,
+                       cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Indicates whether the keys in the range `[first, last)` are contained in the map if
    * `pred` of the corresponding stencil returns true.
@@ -726,6 +959,120 @@ class static_map {
                          OutputIt output_begin,
                          cuda::stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the map,
+   * writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff the key `*(first + i)` is
+   * present in the map. Compared to `contains` this writes one bit instead of one `bool` per key,
+   * cutting the output bandwidth of large probe batches by 8x. The output range must hold
+   * `(std::distance(first, last) + 31) / 32` words; trailing bits of the last word are zero.
+   * @note The bitmask can be consumed by the stencil overloads, e.g. by passing a counting
+   * iterator as stencil together with a predicate testing the corresponding bit.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_bitmask_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_bitmask(InputIt first,
+                        InputIt last,
+                        OutputIt output_begin,
+                        cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * the map, writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff the key `*(first + i)` is
+   * present in the map. The output range must hold `(std::distance(first, last) + 31) / 32` words;
+   * trailing bits of the last word are zero.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_bitmask_async(InputIt first,
+                              InputIt last,
+                              OutputIt output_begin,
+                              cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the map if
+   * `pred` of the corresponding stencil returns true, writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff `pred( *(stencil + i) )`
+   * is true and the key `*(first + i)` is present in the map. The output range must hold
+   * `(std::distance(first, last) + 31) / 32` words; trailing bits of the last word are zero.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_bitmask_if_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam StencilIt Device accessible random access iterator whose value_type is
+   * convertible to Predicate's argument type
+   * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+   * argument type is convertible from <tt>std::iterator_traits<StencilIt>::value_type</tt>
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stencil Beginning of the stencil sequence
+   * @param pred Predicate to test on every element in the range `[stencil, stencil +
+   * std::distance(first, last))`
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+  void contains_bitmask_if(InputIt first,
+                           InputIt last,
+                           StencilIt stencil,
+                           Predicate pred,
+                           OutputIt output_begin,
+                           cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * the map if `pred` of the corresponding stencil returns true, writing the results as a packed
+   * bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff `pred( *(stencil + i) )`
+   * is true and the key `*(first + i)` is present in the map. The output range must hold
+   * `(std::distance(first, last) + 31) / 32` words; trailing bits of the last word are zero.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam StencilIt Device accessible random access iterator whose value_type is
+   * convertible to Predicate's argument type
+   * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+   * argument type is convertible from <tt>std::iterator_traits<StencilIt>::value_type</tt>
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stencil Beginning of the stencil sequence
+   * @param pred Predicate to test on every element in the range `[stencil, stencil +
+   * std::distance(first, last))`
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+  void contains_bitmask_if_async(InputIt first,
+                                 InputIt last,
+                                 StencilIt stencil,
+                                 Predicate pred,
+                                 OutputIt output_begin,
+                                 cuda::stream_ref stream = {}) const noexcept;
+
   /**
    * @brief For all keys in the range `[first, last)`, finds a payload with its key equivalent to
    * the query key.
@@ -766,6 +1113,92 @@ class static_map {
                   OutputIt output_begin,
                   cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief For all keys in the range `[first, last)`, finds the matching payloads and partitions
+   * the results into compacted found and missing outputs in a single pass.
+   *
+   * @note For each key `*(first + i)` with a matched `element` in the map, writes the pair
+   * `{i, element's payload}` to the found output; for each key without a match, writes the index
+   * `i` to the missing output. Both outputs are compacted but not ordered by key index, which
+   * avoids the find-then-partition round trip over a sentinel-filled result array.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam FoundIt Device accessible output iterator assignable from
+   * `cuco::pair<size_type, mapped_type>`
+   * @tparam MissingIt Device accessible output iterator assignable from `size_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param found_begin Beginning of the compacted sequence of (key index, payload) pairs
+   * @param missing_begin Beginning of the compacted sequence of key indices without a match
+   * @param stream Stream used for executing the kernels
+   *
+   * @return Number of keys with a match; the missing output holds the remaining
+   * `std::distance(first, last) - return value` indices
+   */
+  template <typename InputIt, typename FoundIt, typename MissingIt>
+  size_type find_partitioned(InputIt first,
+                             InputIt last,
+                             FoundIt found_begin,
+                             MissingIt missing_begin,
+                             cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief For all keys in the range `[first, first + *num_keys)`, asynchronously finds a payload
+   * with its key equivalent to the query key.
+   *
+   * @note The actual number of input keys is read from device memory at kernel execution time
+   * while the launch configuration is derived from `max_num_keys`, making this function safe to
+   * record into a CUDA graph (e.g. via `cuco::utility::graph_pipeline`) and replay with varying
+   * batch sizes.
+   * @note If the key `*(first + i)` has a matched `element` in the map, copies the payload of
+   * `element` to `(output_begin + i)`. Else, copies the empty value sentinel.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible output iterator assignable from the map's `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param num_keys Pointer to the device memory holding the actual number of keys
+   * @param max_num_keys Maximum number of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find_bounded_async(InputIt first,
+                          size_type const* num_keys,
+                          size_type max_num_keys,
+                          OutputIt output_begin,
+                          cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief For all keys in the host range `[first, last)`, finds a payload with its key equivalent
+   * to the query key, writing the results to the host range starting at `output_begin`.
+   *
+   * @note Unlike `find`, both the input and the output range live in (pageable) host memory.
+   * Chunks are staged through internal pinned buffers on a second stream so that the H2D and D2H
+   * copies of one chunk overlap with the probe kernel of another.
+   * @note If the key `*(first + i)` has a matched `element` in the map, copies the payload of
+   * `element` to `(output_begin + i)`. Else, copies the empty value sentinel.
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam InputIt Host accessible random access input iterator
+   * @tparam OutputIt Host accessible random access output iterator assignable from the map's
+   * `mapped_type`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of payloads retrieved for each key
+   * @param chunk_size Number of keys staged per copy/compute pipeline step
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void find_staged(InputIt first,
+                   InputIt last,
+                   OutputIt output_begin,
+                   size_type chunk_size,
+                   cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Applies the given function object `callback_op` to the copy of every filled slot in the
    * container
@@ -794,6 +1227,33 @@ class static_map {
   template <typename CallbackOp>
   void for_each_async(CallbackOp&& callback_op, cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Asynchronously applies `transform_op` to the copy of every filled slot in the container
+   * and reduces the transformed values to a single value using `reduce_op`.
+   *
+   * @note `reduce_op` must be commutative and associative, and `init` must be its identity
+   * element, since empty and erased slots contribute `init` to the reduction.
+   * @note The result is written to `output` in stream order, i.e. its content is undefined until
+   * all previously submitted work on `stream` has completed.
+   *
+   * @tparam ResultT Type of the reduction result
+   * @tparam TransformOp Type of unary device function object transforming a key-value pair into a
+   * `ResultT`
+   * @tparam ReduceOp Type of commutative binary device function object combining two `ResultT`s
+   *
+   * @param output Pointer to the device accessible result
+   * @param transform_op Function to apply to the copy of every filled slot
+   * @param init Identity element of `reduce_op` seeding the reduction
+   * @param reduce_op Function used to combine the transformed slot contents
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename ResultT, typename TransformOp, typename ReduceOp>
+  void transform_reduce_async(ResultT* output,
+                              TransformOp transform_op,
+                              ResultT init,
+                              ReduceOp reduce_op,
+                              cuda::stream_ref stream = {}) const;
+
   /**
    * @brief For each key in the range [first, last), applies the function object `callback_op` to
    * the copy of all corresponding matches found in the container.
@@ -859,6 +1319,43 @@ class static_map {
                                            ValueOut values_out,
                                            cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Retrieves the next chunk of keys and their associated values into caller-provided
+   * buffers of bounded size.
+   *
+   * Starting at window index `window_offset`, as many consecutive windows are retrieved as are
+   * guaranteed to fit into `buffer_capacity` output slots, and `window_offset` is advanced past
+   * them. Repeated calls with a cursor initialized to zero stream the whole map through fixed
+   * buffers, so export pipelines can overlap the D2H copy of one chunk with the extraction of the
+   * next under a bounded memory budget; the export is complete once `window_offset` has reached
+   * `capacity() / window_size`.
+   *
+   * @note This API synchronizes the given stream.
+   * @note The order in which keys are retrieved is implementation defined.
+   *
+   * @tparam KeyOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `key_type`.
+   * @tparam ValueOut Device accessible random access output iterator whose `value_type` is
+   * convertible from `mapped_type`.
+   *
+   * @param keys_out Beginning output iterator of the key chunk buffer
+   * @param values_out Beginning output iterator of the value chunk buffer
+   * @param buffer_capacity Number of key-value pairs the chunk buffers can hold
+   * @param window_offset Window index at which the chunk starts; advanced past the retrieved
+   * windows
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Number of retrieved key-value pairs
+   *
+   * @throw std::invalid_argument if `buffer_capacity` is smaller than `window_size`
+   */
+  template <typename KeyOut, typename ValueOut>
+  size_type retrieve_chunk(KeyOut keys_out,
+                           ValueOut values_out,
+                           size_type buffer_capacity,
+                           size_type& window_offset,
+                           cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Regenerates the container.
    *
@@ -914,6 +1411,27 @@ class static_map {
    */
   void rehash_async(size_type capacity, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Regenerates the container in place, reusing the existing allocation.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_in_place_async`.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_in_place(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously regenerates the container in place, reusing the existing allocation.
+   *
+   * @note Unlike `rehash_async`, no new slot storage is allocated: the capacity is unchanged and
+   * peak memory usage stays near the container's footprint instead of twice the footprint. The
+   * primary use case is reclaiming erased-key tombstones after heavy `erase` traffic.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_in_place_async(cuda::stream_ref stream = {});
+
   /**
    * @brief Gets the number of elements in the container.
    *
@@ -924,6 +1442,48 @@ class static_map {
    */
   [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Enables counted mode, i.e., maintains the number of elements during bulk modify
+   * operations so that `size()` becomes a near-free read.
+   *
+   * @note This function synchronizes the given stream to capture the current size.
+   * @note Device-side modify operations performed through a container ref do not update the
+   * maintained count. Behavior of `size()` is undefined if such operations were performed after
+   * counted mode was enabled.
+   *
+   * @param stream CUDA stream used to initialize the maintained count
+   */
+  void enable_counted_size(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Disables counted mode. `size()` falls back to scanning the slot storage.
+   */
+  void disable_counted_size() noexcept;
+
+  /**
+   * @brief Indicates whether counted mode is enabled.
+   *
+   * @return `true` iff the container maintains its size during bulk modify operations
+   */
+  [[nodiscard]] bool counted_size_enabled() const noexcept;
+
+  /**
+   * @brief Takes a probing diagnostics snapshot of the container.
+   *
+   * Replays the probe sequence of every key resident in the container and reports the probe
+   * length histogram, the maximum probe length, and the fraction of slots occupied by erased
+   * sentinels. Intended for offline tuning of capacity and probing scheme choices; the regular
+   * operation paths are not instrumented and pay no cost for this facility.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Behavior is undefined if the container is modified concurrently with this operation.
+   *
+   * @param stream CUDA stream this operation is executed in
+   *
+   * @return The probing diagnostics snapshot
+   */
+  [[nodiscard]] probing_statistics probe_statistics(cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Gets the maximum number of elements the hash map can hold.
    *
@@ -981,7 +1541,11 @@ template <class Key,
 class dynamic_map;
 }
 
-template <typename Key, typename Value, cuda::thread_scope Scope, typename Allocator>
+template <typename Key,
+          typename Value,
+          cuda::thread_scope Scope,
+          typename Allocator,
+          typename OverflowAllocator>
 class dynamic_map;
 
 namespace legacy {
@@ -1076,7 +1640,10 @@ class static_map {
                 "declared as safe for bitwise comparison via specialization of "
                 "cuco::is_bitwise_comparable_v<Value>.");
 
-  friend class dynamic_map<Key, Value, Scope, Allocator>;  ///< Dynamic map as friend class
+  template <typename K, typename V, cuda::thread_scope S, typename A, typename OA>
+  friend class cuco::dynamic_map;  ///< Dynamic map as friend class; the hybrid `dynamic_map` manages
+                             ///< submaps of different allocator types, so all of its
+                             ///< specializations are befriended
 
  public:
   using value_type         = cuco::pair<Key, Value>;            ///< Type of key/value pairs
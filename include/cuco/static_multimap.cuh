@@ -419,6 +419,177 @@ class static_multimap {
                          OutputIt output_begin,
                          cuda::stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Counts the occurrences of keys in `[first, last)` contained in the multimap
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @tparam Input Device accessible input iterator
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param stream CUDA stream used for count
+   *
+   * @return The sum of total occurrences of all keys in `[first, last)`
+   */
+  template <typename InputIt>
+  size_type count(InputIt first, InputIt last, cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Counts the occurrences of keys in `[first, last)` contained in the multimap
+   *
+   * @note This function synchronizes the given stream.
+   * @note If a given key has no matches, its occurrence is 1.
+   *
+   * @tparam Input Device accessible input iterator
+   *
+   * @param first Beginning of the sequence of keys to count
+   * @param last End of the sequence of keys to count
+   * @param stream CUDA stream used for count
+   *
+   * @return The sum of total occurrences of all keys in `[first, last)` where keys with no matches
+   * are considered to have a single occurrence.
+   */
+  template <typename InputIt>
+  size_type count_outer(InputIt first, InputIt last, cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Applies the given function object `callback_op` to the copy of every filled slot in the
+   * container
+   *
+   * @note The return value of `callback_op`, if any, is ignored.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `for_each_async`.
+   *
+   * @tparam CallbackOp Type of unary callback function object
+   *
+   * @param callback_op Function to call on every filled slot in the container
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename CallbackOp>
+  void for_each(CallbackOp&& callback_op, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously applies the given function object `callback_op` to the copy of every
+   * filled slot in the container
+   *
+   * @note The return value of `callback_op`, if any, is ignored.
+   *
+   * @tparam CallbackOp Type of unary callback function object
+   *
+   * @param callback_op Function to call on every filled slot in the container
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename CallbackOp>
+  void for_each_async(CallbackOp&& callback_op, cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief For each key in the range [first, last), applies the function object `callback_op` to
+   * the copy of all corresponding matches found in the container.
+   *
+   * @note The return value of `callback_op`, if any, is ignored.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `for_each_async`.
+   *
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam CallbackOp Type of unary callback function object
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param callback_op Function to call on every match found in the container
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename InputIt, typename CallbackOp>
+  void for_each(InputIt first,
+                InputIt last,
+                CallbackOp&& callback_op,
+                cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief For each key in the range [first, last), asynchronously applies the function object
+   * `callback_op` to the copy of all corresponding matches found in the container.
+   *
+   * @note The return value of `callback_op`, if any, is ignored.
+   *
+   * @tparam InputIt Device accessible random access input iterator
+   * @tparam CallbackOp Type of unary callback function object
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param callback_op Function to call on every match found in the container
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename InputIt, typename CallbackOp>
+  void for_each_async(InputIt first,
+                      InputIt last,
+                      CallbackOp&& callback_op,
+                      cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Gets the number of elements in the container.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param stream CUDA stream used to get the number of inserted elements
+   * @return The number of elements in the container
+   */
+  [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Regenerates the container.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_async`.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Reserves at least the specified number of slots and regenerates the container
+   *
+   * @note Changes the number of slots to a value that is not less than `capacity`, then
+   * rehashes the container, i.e. puts the elements into appropriate slots considering
+   * that the total number of slots has changed.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_async`.
+   *
+   * @note Behavior is undefined if the desired `capacity` is insufficient to store all of the
+   * contained elements.
+   *
+   * @note This function is not available if the conatiner's `extent_type` is static.
+   *
+   * @param capacity New capacity of the container
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash(size_type capacity, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously regenerates the container.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_async(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously reserves at least the specified number of slots and regenerates the
+   * container
+   *
+   * @note Changes the number of slots to a value that is not less than `capacity`, then
+   * rehashes the container, i.e. puts the elements into appropriate slots considering
+   * that the total number of slots has changed.
+   *
+   * @note Behavior is undefined if the desired `capacity` is insufficient to store all of the
+   * contained elements.
+   *
+   * @note This function is not available if the conatiner's `extent_type` is static.
+   *
+   * @param capacity New capacity of the container
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_async(size_type capacity, cuda::stream_ref stream = {});
+
   /**
    * @brief Gets the maximum number of elements the hash map can hold.
    *
@@ -887,6 +1058,41 @@ class static_multimap {
                           cudaStream_t stream = 0,
                           KeyEqual key_equal  = KeyEqual{}) const;
 
+  /**
+   * @brief Performs a single-pass inner join of the probe keys in the range `[first, last)`
+   * against the map.
+   *
+   * For every match of key `k = *(first + i)`, writes a `cuco::pair` of the probe index `i` and
+   * the matched payload to an unspecified location in `[output_begin, output_begin +
+   * output_capacity)`. Unlike the two-pass `count()` + `retrieve()` idiom, the output is sized by
+   * the caller-provided capacity hint and the matches are written in the same pass that probes
+   * the map, through warp-aggregated shared memory buffers.
+   *
+   * The returned value is the total number of matches. If it exceeds `output_capacity`, the
+   * output was truncated: the excess matches were dropped and the caller should re-run with an
+   * output range of at least the returned size.
+   *
+   * @tparam InputIt Device accessible input iterator whose `value_type` is
+   * convertible to the map's `key_type`
+   * @tparam OutputIt Device accessible output iterator whose `value_type` is
+   * constructible from `cuco::pair<size_type, mapped_type>`
+   * @tparam KeyEqual Binary callable type
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_begin Beginning of the output sequence of joined probe-index/payload pairs
+   * @param output_capacity Maximum number of joined pairs the output sequence can hold
+   * @param stream CUDA stream used for inner_join
+   * @param key_equal The binary function to compare two keys for equality
+   * @return The total number of matches, which may exceed `output_capacity` on truncation
+   */
+  template <typename InputIt, typename OutputIt, typename KeyEqual = thrust::equal_to<key_type>>
+  size_type inner_join(InputIt first,
+                       InputIt last,
+                       OutputIt output_begin,
+                       size_type output_capacity,
+                       cudaStream_t stream = 0,
+                       KeyEqual key_equal  = KeyEqual{}) const;
+
   /**
    * @brief Retrieves all pairs matching the input probe pair in the range `[first, last)`.
    *
@@ -1160,6 +1366,8 @@ class static_multimap {
     using const_iterator =
       typename view_base_type::const_iterator;  ///< Type of the forward iterator to `const
                                                 ///< value_type`
+    using joined_type =
+      cuco::pair<std::size_t, mapped_type>;  ///< Type of joined probe-index/payload pairs
 
     /**
      * @brief Construct a view of the first `capacity` slots of the
@@ -1254,6 +1462,33 @@ class static_multimap {
                                                         OutputIt1 probe_output_begin,
                                                         OutputIt2 contained_output_begin) noexcept;
 
+    /**
+     * @brief Flushes per-CG buffer of joined results into the output sequence, honoring the
+     * caller-provided output capacity.
+     *
+     * Works like `flush_output_buffer` but clamps the writes so that no element is stored past
+     * `output_capacity`. The global match counter is still advanced by the full `num_outputs` so
+     * that the host can detect truncation and report the required output size.
+     *
+     * @tparam CG Cooperative Group type
+     * @tparam atomicT Type of atomic storage
+     * @tparam OutputIt Device accessible output iterator whose `value_type` is
+     * constructible from `joined_type`
+     * @param g The Cooperative Group used to flush output buffer
+     * @param num_outputs Number of valid output in the buffer
+     * @param output_buffer Buffer of the probe-index/payload pair sequence
+     * @param num_matches Size of the output sequence
+     * @param output_capacity Maximum number of joined pairs the output sequence can hold
+     * @param output_begin Beginning of the output sequence of joined pairs
+     */
+    template <typename CG, typename atomicT, typename OutputIt>
+    __device__ __forceinline__ void flush_join_buffer(CG const& g,
+                                                      uint32_t const num_outputs,
+                                                      joined_type* output_buffer,
+                                                      atomicT* num_matches,
+                                                      std::size_t output_capacity,
+                                                      OutputIt output_begin) noexcept;
+
     /**
      * @brief Indicates whether the key `k` exists in the map.
      *
@@ -1431,6 +1666,49 @@ class static_multimap {
       OutputIt output_begin,
       KeyEqual key_equal = KeyEqual{}) noexcept;
 
+    /**
+     * @brief Retrieves all joined probe-index/payload pairs of a given key with per-flushing-CG
+     * shared memory buffer, writing at most `output_capacity` pairs.
+     *
+     * For key `k` existing in the map, stores a pair of `probe_idx` and each associated payload
+     * to unspecified locations in the output. Unlike `retrieve`, the writes are bounded by
+     * `output_capacity`: matches beyond it are dropped but still counted in `num_matches` so
+     * that the caller can detect truncation.
+     *
+     * @tparam buffer_size Size of the output buffer
+     * @tparam FlushingCG Type of Cooperative Group used to flush output buffer
+     * @tparam atomicT Type of atomic storage
+     * @tparam OutputIt Device accessible output iterator whose `value_type` is
+     * constructible from `joined_type`
+     * @tparam KeyEqual Binary callable type
+     * @param flushing_cg The Cooperative Group used to flush output buffer
+     * @param probing_cg The Cooperative Group used to retrieve
+     * @param probe_idx Index of the probe key in the input sequence
+     * @param k The key to search for
+     * @param flushing_cg_counter Pointer to the flushing CG counter
+     * @param output_buffer Shared memory buffer of the probe-index/payload pair sequence
+     * @param num_matches Size of the output sequence
+     * @param output_capacity Maximum number of joined pairs the output sequence can hold
+     * @param output_begin Beginning of the output sequence of joined pairs
+     * @param key_equal The binary callable used to compare two keys for equality
+     */
+    template <uint32_t buffer_size,
+              typename FlushingCG,
+              typename atomicT,
+              typename OutputIt,
+              typename KeyEqual = thrust::equal_to<key_type>>
+    __device__ __forceinline__ void join_retrieve(
+      FlushingCG const& flushing_cg,
+      cooperative_groups::thread_block_tile<ProbeSequence::cg_size> const& probing_cg,
+      std::size_t probe_idx,
+      Key const& k,
+      uint32_t* flushing_cg_counter,
+      joined_type* output_buffer,
+      atomicT* num_matches,
+      std::size_t output_capacity,
+      OutputIt output_begin,
+      KeyEqual key_equal = KeyEqual{}) noexcept;
+
     /**
      * @brief Retrieves all the matches of a given key contained in multimap with per-flushing-CG
      * shared memory buffer.
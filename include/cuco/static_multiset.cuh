@@ -28,6 +28,7 @@
 #include <cuco/utility/traits.hpp>
 
 #include <cuda/atomic>
+#include <cuda/std/utility>
 #include <cuda/stream_ref>
 #include <thrust/functional.h>
 
@@ -539,6 +540,70 @@ class static_multiset {
                         ProbeHash const& probe_hash,
                         cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Retrieves all the matches of the probe keys in the range `[first, last)`
+   *
+   * For each key `k = *(first + i)`, copies a pair `{k, m}` for every match `m` of `k` in the
+   * multiset to unspecified locations in the output ranges.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Behavior is undefined if the size of the output ranges is smaller than the total number
+   * of matches, i.e., the return value of `count(first, last)`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt1 Device accessible output iterator whose `value_type` can be constructed from
+   * the probe key type
+   * @tparam OutputIt2 Device accessible output iterator whose `value_type` can be constructed from
+   * `Key`
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the sequence of the probe keys of each match
+   * @param output_match Beginning of the sequence of the matched keys
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return A pair of iterators indicating the ends of the output sequences
+   */
+  template <typename InputIt, typename OutputIt1, typename OutputIt2>
+  cuda::std::pair<OutputIt1, OutputIt2> retrieve(InputIt first,
+                                                 InputIt last,
+                                                 OutputIt1 output_probe,
+                                                 OutputIt2 output_match,
+                                                 cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Retrieves all the matches of the probe keys in the range `[first, last)` where probe
+   * keys without a match emit a sentinel pair
+   *
+   * For each key `k = *(first + i)`, copies a pair `{k, m}` for every match `m` of `k` in the
+   * multiset to unspecified locations in the output ranges. If `k` has no matches, copies the
+   * single pair `{k, empty_key_sentinel()}` instead.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Behavior is undefined if the size of the output ranges is smaller than the total number
+   * of matches where keys without a match are counted as a single occurrence.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt1 Device accessible output iterator whose `value_type` can be constructed from
+   * the probe key type
+   * @tparam OutputIt2 Device accessible output iterator whose `value_type` can be constructed from
+   * `Key`
+   *
+   * @param first Beginning of the sequence of probe keys
+   * @param last End of the sequence of probe keys
+   * @param output_probe Beginning of the sequence of the probe keys of each match
+   * @param output_match Beginning of the sequence of the matched keys
+   * @param stream CUDA stream used for retrieve
+   *
+   * @return A pair of iterators indicating the ends of the output sequences
+   */
+  template <typename InputIt, typename OutputIt1, typename OutputIt2>
+  cuda::std::pair<OutputIt1, OutputIt2> retrieve_outer(InputIt first,
+                                                       InputIt last,
+                                                       OutputIt1 output_probe,
+                                                       OutputIt2 output_match,
+                                                       cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Gets the number of elements in the container.
    *
@@ -25,6 +25,7 @@
 #include <cuco/types.cuh>
 #include <cuco/utility/allocator.hpp>
 #include <cuco/utility/cuda_thread_scope.cuh>
+#include <cuco/utility/probing_statistics.hpp>
 #include <cuco/utility/traits.hpp>
 
 #include <cuda/atomic>
@@ -549,6 +550,120 @@ class static_set {
                          OutputIt output_begin,
                          cuda::stream_ref stream = {}) const noexcept;
 
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the set,
+   * writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff the key `*(first + i)` is
+   * present in the set. Compared to `contains` this writes one bit instead of one `bool` per key,
+   * cutting the output bandwidth of large probe batches by 8x. The output range must hold
+   * `(std::distance(first, last) + 31) / 32` words; trailing bits of the last word are zero.
+   * @note The bitmask can be consumed by the stencil overloads, e.g. by passing a counting
+   * iterator as stencil together with a predicate testing the corresponding bit.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_bitmask_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_bitmask(InputIt first,
+                        InputIt last,
+                        OutputIt output_begin,
+                        cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * the set, writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff the key `*(first + i)` is
+   * present in the set. The output range must hold `(std::distance(first, last) + 31) / 32` words;
+   * trailing bits of the last word are zero.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename OutputIt>
+  void contains_bitmask_async(InputIt first,
+                              InputIt last,
+                              OutputIt output_begin,
+                              cuda::stream_ref stream = {}) const noexcept;
+
+  /**
+   * @brief Indicates whether the keys in the range `[first, last)` are contained in the set if
+   * `pred` of the corresponding stencil returns true, writing the results as a packed bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff `pred( *(stencil + i) )`
+   * is true and the key `*(first + i)` is present in the set. The output range must hold
+   * `(std::distance(first, last) + 31) / 32` words; trailing bits of the last word are zero.
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `contains_bitmask_if_async`.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam StencilIt Device accessible random access iterator whose value_type is
+   * convertible to Predicate's argument type
+   * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+   * argument type is convertible from <tt>std::iterator_traits<StencilIt>::value_type</tt>
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stencil Beginning of the stencil sequence
+   * @param pred Predicate to test on every element in the range `[stencil, stencil +
+   * std::distance(first, last))`
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+  void contains_bitmask_if(InputIt first,
+                           InputIt last,
+                           StencilIt stencil,
+                           Predicate pred,
+                           OutputIt output_begin,
+                           cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously indicates whether the keys in the range `[first, last)` are contained in
+   * the set if `pred` of the corresponding stencil returns true, writing the results as a packed
+   * bitmask.
+   *
+   * @note Bit `i % 32` of the word `*(output_begin + i / 32)` is set iff `pred( *(stencil + i) )`
+   * is true and the key `*(first + i)` is present in the set. The output range must hold
+   * `(std::distance(first, last) + 31) / 32` words; trailing bits of the last word are zero.
+   *
+   * @tparam InputIt Device accessible input iterator
+   * @tparam StencilIt Device accessible random access iterator whose value_type is
+   * convertible to Predicate's argument type
+   * @tparam Predicate Unary predicate callable whose return type must be convertible to `bool` and
+   * argument type is convertible from <tt>std::iterator_traits<StencilIt>::value_type</tt>
+   * @tparam OutputIt Device accessible random access output iterator assignable from `uint32_t`
+   *
+   * @param first Beginning of the sequence of keys
+   * @param last End of the sequence of keys
+   * @param stencil Beginning of the stencil sequence
+   * @param pred Predicate to test on every element in the range `[stencil, stencil +
+   * std::distance(first, last))`
+   * @param output_begin Beginning of the sequence of bitmask words
+   * @param stream Stream used for executing the kernels
+   */
+  template <typename InputIt, typename StencilIt, typename Predicate, typename OutputIt>
+  void contains_bitmask_if_async(InputIt first,
+                                 InputIt last,
+                                 StencilIt stencil,
+                                 Predicate pred,
+                                 OutputIt output_begin,
+                                 cuda::stream_ref stream = {}) const noexcept;
+
   /**
    * @brief For all keys in the range `[first, last)`, finds an element with key equivalent to the
    * query key.
@@ -680,6 +795,64 @@ class static_set {
   template <typename OutputIt>
   OutputIt retrieve_all(OutputIt output_begin, cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Retrieves the next chunk of keys into a caller-provided buffer of bounded size.
+   *
+   * Starting at window index `window_offset`, as many consecutive windows are retrieved as are
+   * guaranteed to fit into `buffer_capacity` output slots, and `window_offset` is advanced past
+   * them. Repeated calls with a cursor initialized to zero stream the whole set through a fixed
+   * buffer, so export pipelines can overlap the D2H copy of one chunk with the extraction of the
+   * next under a bounded memory budget; the export is complete once `window_offset` has reached
+   * `capacity() / window_size`.
+   *
+   * @note This API synchronizes the given stream.
+   * @note The order in which keys are retrieved is implementation defined.
+   *
+   * @tparam OutputIt Device accessible random access output iterator whose `value_type` is
+   * convertible from the container's `key_type`.
+   *
+   * @param output_begin Beginning output iterator of the chunk buffer
+   * @param buffer_capacity Number of keys the chunk buffer can hold
+   * @param window_offset Window index at which the chunk starts; advanced past the retrieved
+   * windows
+   * @param stream CUDA stream used for this operation
+   *
+   * @return Number of retrieved keys
+   *
+   * @throw std::invalid_argument if `buffer_capacity` is smaller than `window_size`
+   */
+  template <typename OutputIt>
+  size_type retrieve_chunk(OutputIt output_begin,
+                           size_type buffer_capacity,
+                           size_type& window_offset,
+                           cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Asynchronously applies `transform_op` to the copy of every filled slot in the container
+   * and reduces the transformed values to a single value using `reduce_op`.
+   *
+   * @note `reduce_op` must be commutative and associative, and `init` must be its identity
+   * element, since empty and erased slots contribute `init` to the reduction.
+   * @note The result is written to `output` in stream order, i.e. its content is undefined until
+   * all previously submitted work on `stream` has completed.
+   *
+   * @tparam ResultT Type of the reduction result
+   * @tparam TransformOp Type of unary device function object transforming a key into a `ResultT`
+   * @tparam ReduceOp Type of commutative binary device function object combining two `ResultT`s
+   *
+   * @param output Pointer to the device accessible result
+   * @param transform_op Function to apply to the copy of every filled slot
+   * @param init Identity element of `reduce_op` seeding the reduction
+   * @param reduce_op Function used to combine the transformed slot contents
+   * @param stream CUDA stream used for this operation
+   */
+  template <typename ResultT, typename TransformOp, typename ReduceOp>
+  void transform_reduce_async(ResultT* output,
+                              TransformOp transform_op,
+                              ResultT init,
+                              ReduceOp reduce_op,
+                              cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Regenerates the container.
    *
@@ -735,6 +908,27 @@ class static_set {
    */
   void rehash_async(size_type capacity, cuda::stream_ref stream = {});
 
+  /**
+   * @brief Regenerates the container in place, reusing the existing allocation.
+   *
+   * @note This function synchronizes the given stream. For asynchronous execution use
+   * `rehash_in_place_async`.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_in_place(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously regenerates the container in place, reusing the existing allocation.
+   *
+   * @note Unlike `rehash_async`, no new slot storage is allocated: the capacity is unchanged and
+   * peak memory usage stays near the container's footprint instead of twice the footprint. The
+   * primary use case is reclaiming erased-key tombstones after heavy `erase` traffic.
+   *
+   * @param stream CUDA stream used for this operation
+   */
+  void rehash_in_place_async(cuda::stream_ref stream = {});
+
   /**
    * @brief Gets the number of elements in the container.
    *
@@ -745,6 +939,48 @@ class static_set {
    */
   [[nodiscard]] size_type size(cuda::stream_ref stream = {}) const;
 
+  /**
+   * @brief Enables counted mode, i.e., maintains the number of elements during bulk modify
+   * operations so that `size()` becomes a near-free read.
+   *
+   * @note This function synchronizes the given stream to capture the current size.
+   * @note Device-side modify operations performed through a container ref do not update the
+   * maintained count. Behavior of `size()` is undefined if such operations were performed after
+   * counted mode was enabled.
+   *
+   * @param stream CUDA stream used to initialize the maintained count
+   */
+  void enable_counted_size(cuda::stream_ref stream = {});
+
+  /**
+   * @brief Disables counted mode. `size()` falls back to scanning the slot storage.
+   */
+  void disable_counted_size() noexcept;
+
+  /**
+   * @brief Indicates whether counted mode is enabled.
+   *
+   * @return `true` iff the container maintains its size during bulk modify operations
+   */
+  [[nodiscard]] bool counted_size_enabled() const noexcept;
+
+  /**
+   * @brief Takes a probing diagnostics snapshot of the container.
+   *
+   * Replays the probe sequence of every key resident in the container and reports the probe
+   * length histogram, the maximum probe length, and the fraction of slots occupied by erased
+   * sentinels. Intended for offline tuning of capacity and probing scheme choices; the regular
+   * operation paths are not instrumented and pay no cost for this facility.
+   *
+   * @note This function synchronizes the given stream.
+   * @note Behavior is undefined if the container is modified concurrently with this operation.
+   *
+   * @param stream CUDA stream this operation is executed in
+   *
+   * @return The probing diagnostics snapshot
+   */
+  [[nodiscard]] probing_statistics probe_statistics(cuda::stream_ref stream = {}) const;
+
   /**
    * @brief Gets the maximum number of elements the hash set can hold.
    *
@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cuco/detail/storage/storage.cuh>
+#include <cuco/tagged_aow_storage.cuh>
 
 namespace cuco {
 
@@ -45,4 +46,30 @@ class storage {
   using impl = aow_storage<T, window_size, Extent, Allocator>;
 };
 
+/**
+ * @brief Public tagged storage class.
+ *
+ * @note This storage augments the AoW storage with one byte of fingerprint tag per slot. Lookup
+ * operations inspect the compact tag array first and only load the full slot window when a
+ * fingerprint matches, which reduces memory traffic for probing sequences that mostly miss, at the
+ * cost of one extra byte of memory per slot.
+ *
+ * @note Tags are maintained non-atomically. Containers using tagged storage do NOT support
+ * concurrent modify and lookup operations, and all insertions must go through the `insert` or
+ * `insert_and_find` device operations (or the bulk host APIs built on top of them), i.e.,
+ * `insert_or_assign` and `insert_or_apply` are not supported.
+ *
+ * @tparam WindowSize Number of elements per window storage
+ */
+template <int32_t WindowSize>
+class tagged_storage {
+ public:
+  /// Number of slots per window storage
+  static constexpr int32_t window_size = WindowSize;
+
+  /// Type of implementation details
+  template <class T, class Extent, class Allocator>
+  using impl = tagged_aow_storage<T, window_size, Extent, Allocator>;
+};
+
 }  // namespace cuco
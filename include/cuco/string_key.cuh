@@ -0,0 +1,500 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/extent.cuh>
+#include <cuco/hash_functions.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/stream_ref>
+
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/transform.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+
+/**
+ * @brief Fixed-size, bitwise-comparable handle denoting a variable-length key stored out-of-line
+ * in a `cuco::string_arena`.
+ *
+ * The handle packs a 16-bit hash fingerprint, the 16-bit key length, and the 32-bit arena byte
+ * offset into a single 64-bit word, so it satisfies the containers' fixed-size and
+ * bitwise-comparability requirements while probing can reject mismatches on the fingerprint alone
+ * without touching the arena.
+ */
+class string_key_handle {
+ public:
+  /// Maximum key length in bytes representable by the 16-bit size field
+  static constexpr std::uint32_t max_size = 0xffffu;
+
+  string_key_handle() = default;
+
+  /**
+   * @brief Constructs a handle from its components.
+   *
+   * @param fingerprint Hash fingerprint of the key bytes
+   * @param offset Byte offset of the key in the arena
+   * @param size Length of the key in bytes
+   */
+  __host__ __device__ constexpr string_key_handle(std::uint16_t fingerprint,
+                                                  std::uint32_t offset,
+                                                  std::uint16_t size) noexcept
+    : packed_{(static_cast<std::uint64_t>(fingerprint) << 48) |
+              (static_cast<std::uint64_t>(size) << 32) | static_cast<std::uint64_t>(offset)}
+  {
+  }
+
+  /**
+   * @brief Gets a handle value that denotes no key, usable as empty key sentinel.
+   *
+   * @return The invalid handle
+   */
+  __host__ __device__ static constexpr string_key_handle invalid() noexcept
+  {
+    string_key_handle handle{};
+    handle.packed_ = ~std::uint64_t{0};
+    return handle;
+  }
+
+  /**
+   * @brief Gets the hash fingerprint of the key bytes.
+   *
+   * @return The fingerprint
+   */
+  [[nodiscard]] __host__ __device__ constexpr std::uint16_t fingerprint() const noexcept
+  {
+    return static_cast<std::uint16_t>(packed_ >> 48);
+  }
+
+  /**
+   * @brief Gets the length of the key in bytes.
+   *
+   * @return The key length
+   */
+  [[nodiscard]] __host__ __device__ constexpr std::uint32_t size() const noexcept
+  {
+    return static_cast<std::uint32_t>((packed_ >> 32) & 0xffffu);
+  }
+
+  /**
+   * @brief Gets the byte offset of the key in the arena.
+   *
+   * @return The arena offset
+   */
+  [[nodiscard]] __host__ __device__ constexpr std::uint32_t offset() const noexcept
+  {
+    return static_cast<std::uint32_t>(packed_);
+  }
+
+  /**
+   * @brief Compares two handles for bitwise equality.
+   *
+   * @param lhs Left-hand side handle
+   * @param rhs Right-hand side handle
+   *
+   * @return `true` iff both handles are bit-identical
+   */
+  __host__ __device__ friend constexpr bool operator==(string_key_handle lhs,
+                                                       string_key_handle rhs) noexcept
+  {
+    return lhs.packed_ == rhs.packed_;
+  }
+
+ private:
+  std::uint64_t packed_;  ///< Packed fingerprint, length, and offset
+};
+
+/**
+ * @brief Non-owning view of a variable-length probe key with a precomputed fingerprint.
+ *
+ * Used as the probe key type for heterogeneous lookups against containers storing
+ * `cuco::string_key_handle`s.
+ */
+struct string_key_view {
+  char const* data;           ///< Pointer to the key bytes
+  std::uint32_t size;         ///< Length of the key in bytes
+  std::uint16_t fingerprint;  ///< Hash fingerprint of the key bytes
+};
+
+/**
+ * @brief Hasher for out-of-line string keys.
+ *
+ * Hashes `cuco::string_key_handle`s by dereferencing the arena and `cuco::string_key_view`s by
+ * hashing the viewed bytes, so handles and views of the same string hash identically.
+ *
+ * @tparam Hash Byte-range hasher providing `compute_hash`
+ */
+template <typename Hash = cuco::xxhash_32<char>>
+class string_key_hash {
+ public:
+  using result_type = typename Hash::result_type;  ///< The type of the hash values produced
+
+  string_key_hash() = default;
+
+  /**
+   * @brief Constructs a string key hasher over the given arena storage.
+   *
+   * @param arena Pointer to the arena's key bytes
+   * @param hash Byte-range hasher
+   */
+  __host__ __device__ constexpr string_key_hash(char const* arena, Hash const& hash = {}) noexcept
+    : arena_{arena}, hash_{hash}
+  {
+  }
+
+  /**
+   * @brief Hashes the bytes denoted by the given handle.
+   *
+   * @param handle The key handle
+   *
+   * @return The hash value of the key bytes
+   */
+  __host__ __device__ constexpr result_type operator()(string_key_handle handle) const noexcept
+  {
+    return hash_.compute_hash(reinterpret_cast<std::byte const*>(arena_ + handle.offset()),
+                              cuco::extent<std::size_t>{handle.size()});
+  }
+
+  /**
+   * @brief Hashes the bytes of the given view.
+   *
+   * @param view The probe key view
+   *
+   * @return The hash value of the key bytes
+   */
+  __host__ __device__ constexpr result_type operator()(string_key_view view) const noexcept
+  {
+    return hash_.compute_hash(reinterpret_cast<std::byte const*>(view.data),
+                              cuco::extent<std::size_t>{view.size});
+  }
+
+ private:
+  char const* arena_{nullptr};  ///< Arena key bytes
+  Hash hash_{};                 ///< Byte-range hasher
+};
+
+/**
+ * @brief Key equality for out-of-line string keys.
+ *
+ * Compares the cheap in-handle fingerprint and length first and dereferences the arena for a byte
+ * comparison only if both match.
+ */
+class string_key_equal {
+ public:
+  string_key_equal() = default;
+
+  /**
+   * @brief Constructs a string key comparator over the given arena storage.
+   *
+   * @param arena Pointer to the arena's key bytes
+   */
+  __host__ __device__ constexpr string_key_equal(char const* arena) noexcept : arena_{arena} {}
+
+  /**
+   * @brief Compares two stored key handles.
+   *
+   * @param lhs Left-hand side handle
+   * @param rhs Right-hand side handle
+   *
+   * @return `true` iff both handles denote equal key bytes
+   */
+  __device__ constexpr bool operator()(string_key_handle lhs, string_key_handle rhs) const noexcept
+  {
+    if (lhs == rhs) { return true; }
+    if (lhs.fingerprint() != rhs.fingerprint() or lhs.size() != rhs.size()) { return false; }
+    return this->equal_bytes(arena_ + lhs.offset(), arena_ + rhs.offset(), lhs.size());
+  }
+
+  /**
+   * @brief Compares a probe key view against a stored key handle.
+   *
+   * @param lhs The probe key view
+   * @param rhs The stored key handle
+   *
+   * @return `true` iff the view and the handle denote equal key bytes
+   */
+  __device__ constexpr bool operator()(string_key_view lhs, string_key_handle rhs) const noexcept
+  {
+    if (lhs.fingerprint != rhs.fingerprint() or lhs.size != rhs.size()) { return false; }
+    return this->equal_bytes(lhs.data, arena_ + rhs.offset(), lhs.size);
+  }
+
+  /**
+   * @brief Compares a stored key handle against a probe key view.
+   *
+   * @param lhs The stored key handle
+   * @param rhs The probe key view
+   *
+   * @return `true` iff the handle and the view denote equal key bytes
+   */
+  __device__ constexpr bool operator()(string_key_handle lhs, string_key_view rhs) const noexcept
+  {
+    return (*this)(rhs, lhs);
+  }
+
+ private:
+  /**
+   * @brief Compares two byte ranges of equal length.
+   *
+   * @param lhs Left-hand side bytes
+   * @param rhs Right-hand side bytes
+   * @param size Number of bytes to compare
+   *
+   * @return `true` iff the ranges are equal
+   */
+  __device__ constexpr bool equal_bytes(char const* lhs,
+                                        char const* rhs,
+                                        std::uint32_t size) const noexcept
+  {
+    for (std::uint32_t i = 0; i < size; ++i) {
+      if (lhs[i] != rhs[i]) { return false; }
+    }
+    return true;
+  }
+
+  char const* arena_{nullptr};  ///< Arena key bytes
+};
+
+/**
+ * @brief Creates a probe key view with its fingerprint precomputed by the given hasher.
+ *
+ * @tparam Hash Byte-range hasher providing `compute_hash`
+ *
+ * @param data Pointer to the key bytes
+ * @param size Length of the key in bytes
+ * @param hash Byte-range hasher; must match the fingerprint hasher of the arena
+ *
+ * @return The probe key view
+ */
+template <typename Hash = cuco::xxhash_32<char>>
+__host__ __device__ constexpr string_key_view make_string_key_view(char const* data,
+                                                                   std::uint32_t size,
+                                                                   Hash const& hash = {}) noexcept
+{
+  auto const hash_value =
+    hash.compute_hash(reinterpret_cast<std::byte const*>(data), cuco::extent<std::size_t>{size});
+  return string_key_view{data, size, static_cast<std::uint16_t>(hash_value >> 16)};
+}
+
+namespace detail {
+
+/**
+ * @brief Functor building a `string_key_handle` for one appended string.
+ *
+ * @tparam SizeType Offset type of the input offsets array
+ * @tparam Hash Byte-range hasher providing `compute_hash`
+ */
+template <typename SizeType, typename Hash>
+struct make_string_key_handle_fn {
+  char const* arena;            ///< Arena key bytes
+  std::size_t base;             ///< Arena byte offset the batch was appended at
+  SizeType const* offsets;      ///< Exclusive byte offsets of the strings within the batch
+  Hash hash;                    ///< Byte-range hasher
+
+  /**
+   * @brief Builds the handle for the `i`-th appended string.
+   *
+   * @param i Index of the string within the batch
+   *
+   * @return The handle denoting the string in the arena
+   */
+  __device__ string_key_handle operator()(SizeType i) const
+  {
+    auto const offset = base + offsets[i];
+    auto const size   = static_cast<std::uint32_t>(offsets[i + 1] - offsets[i]);
+    auto const hash_value =
+      hash.compute_hash(reinterpret_cast<std::byte const*>(arena + offset),
+                        cuco::extent<std::size_t>{static_cast<std::size_t>(size)});
+    return string_key_handle{static_cast<std::uint16_t>(hash_value >> 16),
+                             static_cast<std::uint32_t>(offset),
+                             static_cast<std::uint16_t>(size)};
+  }
+};
+
+/**
+ * @brief Predicate checking whether the `i`-th string of a batch exceeds the handle size limit.
+ *
+ * @tparam SizeType Offset type of the input offsets array
+ */
+template <typename SizeType>
+struct string_size_exceeds_limit_fn {
+  SizeType const* offsets;  ///< Exclusive byte offsets of the strings within the batch
+
+  /**
+   * @brief Checks the length of the `i`-th string.
+   *
+   * @param i Index of the string within the batch
+   *
+   * @return `true` iff the string is too long to be represented by a handle
+   */
+  __device__ constexpr bool operator()(SizeType i) const noexcept
+  {
+    return static_cast<std::size_t>(offsets[i + 1] - offsets[i]) >
+           static_cast<std::size_t>(string_key_handle::max_size);
+  }
+};
+
+}  // namespace detail
+
+/**
+ * @brief Bump-allocated device arena storing the bytes of variable-length keys out-of-line.
+ *
+ * The arena owns a fixed-capacity device character buffer. Batches of strings are appended via
+ * `append_async`, which copies the bytes and produces the fixed-size `string_key_handle`s that are
+ * inserted into a container in their stead. The matching `hash_function` and `key_equal` factories
+ * return functors bound to the arena storage for use as the container's probing hash and key
+ * equality predicate.
+ *
+ * @note The arena never relocates its storage, so handles remain valid for its lifetime.
+ * @note Individual keys are limited to 65535 bytes and the arena to 4 GiB by the handle layout.
+ *
+ * @tparam Hash Byte-range hasher used for fingerprints and probing
+ * @tparam Allocator Type of allocator used for device storage
+ */
+template <typename Hash = cuco::xxhash_32<char>, typename Allocator = cuco::cuda_allocator<char>>
+class string_arena {
+ public:
+  using size_type = std::size_t;  ///< Size type
+  using hasher    = string_key_hash<Hash>;  ///< Hash type bound to the arena storage
+  using key_equal = string_key_equal;       ///< Key equality type bound to the arena storage
+  /// Allocator type
+  using allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<char>;
+
+  /**
+   * @brief Constructs an arena with the given byte capacity.
+   *
+   * @throw If `capacity` exceeds the 4 GiB handle addressing limit
+   *
+   * @param capacity Maximum number of key bytes the arena can hold
+   * @param hash Byte-range hasher used for fingerprints
+   * @param alloc Allocator used for allocating the device storage
+   */
+  string_arena(size_type capacity, Hash const& hash = {}, Allocator const& alloc = {})
+    : capacity_{capacity}, hash_{hash}, allocator_{alloc}
+  {
+    CUCO_EXPECTS(capacity_ <= (size_type{1} << 32), "Arena capacity exceeds handle addressing");
+    data_ = allocator_.allocate(capacity_);
+  }
+
+  ~string_arena() { allocator_.deallocate(data_, capacity_); }
+
+  string_arena(string_arena const&)            = delete;
+  string_arena(string_arena&&)                 = delete;
+  string_arena& operator=(string_arena const&) = delete;
+  string_arena& operator=(string_arena&&)      = delete;
+
+  /**
+   * @brief Asynchronously appends a batch of strings and produces their handles.
+   *
+   * @note Validating the string lengths synchronizes the given stream before the batch is copied;
+   * the copy and handle construction remain asynchronous.
+   *
+   * @throw If the batch does not fit into the remaining arena capacity
+   * @throw If any string in the batch is longer than 65535 bytes
+   *
+   * @tparam SizeType Offset type of the input offsets array
+   *
+   * @param chars Device pointer to the concatenated string bytes
+   * @param num_chars Total number of bytes in the batch
+   * @param offsets Device pointer to `num_strings + 1` exclusive byte offsets within `chars`
+   * @param num_strings Number of strings in the batch
+   * @param handles_out Device pointer receiving one handle per string
+   * @param stream CUDA stream this operation is executed in
+   */
+  template <typename SizeType>
+  void append_async(char const* chars,
+                    size_type num_chars,
+                    SizeType const* offsets,
+                    size_type num_strings,
+                    string_key_handle* handles_out,
+                    cuda::stream_ref stream)
+  {
+    CUCO_EXPECTS(size_ + num_chars <= capacity_, "Arena capacity exceeded");
+    if (num_strings == 0) { return; }
+
+    // oversized strings would silently truncate in the handle's 16-bit size field, corrupting
+    // every lookup of the affected keys, so the whole batch is rejected up front
+    auto const has_oversized =
+      thrust::any_of(thrust::cuda::par.on(stream.get()),
+                     thrust::counting_iterator<SizeType>{0},
+                     thrust::counting_iterator<SizeType>{static_cast<SizeType>(num_strings)},
+                     detail::string_size_exceeds_limit_fn<SizeType>{offsets});
+    CUCO_EXPECTS(not has_oversized, "String length exceeds the handle's 65535-byte limit");
+
+    CUCO_CUDA_TRY(
+      cudaMemcpyAsync(data_ + size_, chars, num_chars, cudaMemcpyDefault, stream.get()));
+    thrust::transform(
+      thrust::cuda::par.on(stream.get()),
+      thrust::counting_iterator<SizeType>{0},
+      thrust::counting_iterator<SizeType>{static_cast<SizeType>(num_strings)},
+      handles_out,
+      detail::make_string_key_handle_fn<SizeType, Hash>{data_, size_, offsets, hash_});
+    size_ += num_chars;
+  }
+
+  /**
+   * @brief Gets the pointer to the arena's key bytes.
+   *
+   * @return Device pointer to the key bytes
+   */
+  [[nodiscard]] char const* data() const noexcept { return data_; }
+
+  /**
+   * @brief Gets the number of key bytes currently stored.
+   *
+   * @return The number of stored bytes
+   */
+  [[nodiscard]] size_type size() const noexcept { return size_; }
+
+  /**
+   * @brief Gets the maximum number of key bytes the arena can hold.
+   *
+   * @return The arena capacity in bytes
+   */
+  [[nodiscard]] size_type capacity() const noexcept { return capacity_; }
+
+  /**
+   * @brief Gets a hasher bound to the arena storage, for use as the container's probing hash.
+   *
+   * @return The arena-bound hasher
+   */
+  [[nodiscard]] hasher hash_function() const noexcept { return hasher{data_, hash_}; }
+
+  /**
+   * @brief Gets a key comparator bound to the arena storage, for use as the container's key
+   * equality predicate.
+   *
+   * @return The arena-bound key comparator
+   */
+  [[nodiscard]] key_equal key_eq() const noexcept { return key_equal{data_}; }
+
+ private:
+  size_type capacity_;        ///< Arena byte capacity
+  size_type size_{0};         ///< Number of bytes appended so far
+  Hash hash_;                 ///< Byte-range hasher
+  allocator_type allocator_;  ///< Device storage allocator
+  char* data_{nullptr};       ///< Device key byte storage
+};
+
+}  // namespace cuco
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/aow_storage.cuh>
+#include <cuco/extent.cuh>
+#include <cuco/utility/allocator.hpp>
+
+#include <cuda/std/array>
+#include <cuda/std/limits>
+#include <cuda/std/type_traits>
+#include <cuda/std/utility>
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace cuco {
+namespace detail {
+
+/**
+ * @brief Trait indicating whether the given storage ref provides per-slot fingerprint tags.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef, typename = void>
+struct has_window_tags : cuda::std::false_type {};
+
+/**
+ * @brief Trait indicating whether the given storage ref provides per-slot fingerprint tags.
+ *
+ * @tparam StorageRef Storage ref type
+ */
+template <typename StorageRef>
+struct has_window_tags<StorageRef,
+                       cuda::std::void_t<decltype(cuda::std::declval<StorageRef>().tags())>>
+  : cuda::std::true_type {};
+
+/// Shortcut definition of `has_window_tags`
+template <typename StorageRef>
+inline constexpr bool has_window_tags_v = has_window_tags<StorageRef>::value;
+
+}  // namespace detail
+
+/// forward declaration
+template <typename T, int32_t WindowSize, typename Extent>
+class tagged_aow_storage_ref;
+
+/**
+ * @brief Array of Window storage class augmented with per-slot fingerprint tags.
+ *
+ * @note In addition to the slot windows, this storage maintains one byte per slot holding a short
+ * fingerprint of the key's hash value. Lookup operations can load the tag window first and skip
+ * loading the full slot window unless a fingerprint matches, which greatly reduces memory traffic
+ * for probes that miss.
+ *
+ * @note Tags are written non-atomically after the corresponding slot has been claimed. Therefore,
+ * containers using tagged storage do NOT support concurrent modify and lookup operations, and all
+ * insertions must go through the `insert` or `insert_and_find` device operations (or the bulk host
+ * APIs built on top of them).
+ *
+ * @tparam T Slot type
+ * @tparam WindowSize Number of slots in each window
+ * @tparam Extent Type of extent denoting number of windows
+ * @tparam Allocator Type of allocator used for device storage (de)allocation
+ */
+template <typename T,
+          int32_t WindowSize,
+          typename Extent    = cuco::extent<std::size_t>,
+          typename Allocator = cuco::cuda_allocator<cuco::window<T, WindowSize>>>
+class tagged_aow_storage : public aow_storage<T, WindowSize, Extent, Allocator> {
+ public:
+  using base_type = aow_storage<T, WindowSize, Extent, Allocator>;  ///< AoW storage base class type
+
+  using base_type::window_size;  ///< Number of elements processed per window
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using window_type = typename base_type::window_type;  ///< Slot window type
+  using tag_type    = std::uint8_t;                     ///< Fingerprint tag type
+
+  using base_type::capacity;
+  using base_type::num_windows;
+
+  using allocator_type = typename base_type::allocator_type;  ///< Window allocator type
+  /// Type of the allocator to (de)allocate tags
+  using tag_allocator_type = typename std::allocator_traits<Allocator>::template rebind_alloc<tag_type>;
+  using tag_deleter_type =
+    detail::custom_deleter<size_type, tag_allocator_type>;  ///< Type of tag deleter
+  using ref_type =
+    tagged_aow_storage_ref<value_type, window_size, extent_type>;  ///< Storage ref type
+
+  /**
+   * @brief Constructor of tagged AoW storage.
+   *
+   * @note The input `size` should be exclusively determined by the return value of
+   * `make_window_extent` since it depends on the requested low-bound value, the probing scheme, and
+   * the storage.
+   *
+   * @param size Number of windows to (de)allocate
+   * @param allocator Allocator used for (de)allocating device storage
+   */
+  explicit constexpr tagged_aow_storage(Extent size, Allocator const& allocator = {});
+
+  tagged_aow_storage(tagged_aow_storage&&) = default;  ///< Move constructor
+  /**
+   * @brief Replaces the contents of the storage with another storage.
+   *
+   * @return Reference of the current storage object
+   */
+  tagged_aow_storage& operator=(tagged_aow_storage&&) = default;
+  ~tagged_aow_storage()                               = default;  ///< Destructor
+
+  tagged_aow_storage(tagged_aow_storage const&)            = delete;
+  tagged_aow_storage& operator=(tagged_aow_storage const&) = delete;
+
+  /**
+   * @brief Gets tags array.
+   *
+   * @return Pointer to the first tag
+   */
+  [[nodiscard]] constexpr tag_type* tags() const noexcept;
+
+  /**
+   * @brief Gets window storage reference.
+   *
+   * @return Reference of window storage
+   */
+  [[nodiscard]] constexpr ref_type ref() const noexcept;
+
+  /**
+   * @brief Initializes each slot in the AoW storage to contain `key` and resets all tags.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize(value_type key, cuda::stream_ref stream = {});
+
+  /**
+   * @brief Asynchronously initializes each slot in the AoW storage to contain `key` and resets all
+   * tags.
+   *
+   * @param key Key to which all keys in `slots` are initialized
+   * @param stream Stream used for executing the kernel
+   */
+  void initialize_async(value_type key, cuda::stream_ref stream = {}) noexcept;
+
+ private:
+  tag_allocator_type tag_allocator_;                     ///< Allocator used to (de)allocate tags
+  tag_deleter_type tag_deleter_;                         ///< Custom tags deleter
+  std::unique_ptr<tag_type, tag_deleter_type> tags_;     ///< Pointer to tag storage
+};
+
+/**
+ * @brief Non-owning tagged AoW storage reference type.
+ *
+ * @tparam T Storage element type
+ * @tparam WindowSize Number of slots in each window
+ * @tparam Extent Type of extent denoting storage capacity
+ */
+template <typename T, int32_t WindowSize, typename Extent = cuco::extent<std::size_t>>
+class tagged_aow_storage_ref : public aow_storage_ref<T, WindowSize, Extent> {
+ public:
+  using base_type = aow_storage_ref<T, WindowSize, Extent>;  ///< AoW storage ref base class type
+
+  using base_type::window_size;  ///< Number of elements processed per window
+
+  using extent_type = typename base_type::extent_type;  ///< Storage extent type
+  using size_type   = typename base_type::size_type;    ///< Storage size type
+  using value_type  = typename base_type::value_type;   ///< Slot type
+  using window_type = typename base_type::window_type;  ///< Slot window type
+  using tag_type    = std::uint8_t;                     ///< Fingerprint tag type
+  /// Tag window type
+  using tag_window_type = cuda::std::array<tag_type, window_size>;
+
+  using base_type::capacity;
+  using base_type::num_windows;
+
+  /// Tag value denoting an empty slot
+  static constexpr tag_type empty_tag = 0;
+
+  /**
+   * @brief Constructor of tagged AoW storage ref.
+   *
+   * @param size Number of windows
+   * @param windows Pointer to the windows array
+   * @param tags Pointer to the tags array
+   */
+  __host__ __device__ explicit constexpr tagged_aow_storage_ref(Extent size,
+                                                                window_type* windows,
+                                                                tag_type* tags) noexcept;
+
+  /**
+   * @brief Computes the fingerprint tag for a given hash value.
+   *
+   * @note The tag is derived from the most-significant bits of the hash value since the probing
+   * position consumes the hash value modulo the table extent. The top bit is always set so that a
+   * valid fingerprint can never collide with `empty_tag`.
+   *
+   * @tparam HashValue Hash value type
+   *
+   * @param hash_value Hash value of the key
+   *
+   * @return The fingerprint tag of the given hash value
+   */
+  template <typename HashValue>
+  [[nodiscard]] static __host__ __device__ constexpr tag_type make_tag(
+    HashValue hash_value) noexcept;
+
+  /**
+   * @brief Gets tags array.
+   *
+   * @return Pointer to the first tag
+   */
+  [[nodiscard]] __device__ constexpr tag_type* tags() const noexcept;
+
+  /**
+   * @brief Returns the array of tags corresponding to the window at a given index.
+   *
+   * @param index Index of the window
+   * @return An array of tags
+   */
+  [[nodiscard]] __device__ constexpr tag_window_type tag_window(size_type index) const noexcept;
+
+ private:
+  tag_type* tags_;  ///< Pointer to the tags array
+};
+
+}  // namespace cuco
+
+#include <cuco/detail/storage/tagged_aow_storage.inl>
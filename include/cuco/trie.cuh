@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/trie/dynamic_bitset/dynamic_bitset.cuh>
+#include <cuco/trie_ref.cuh>
+
+#include <cuda/stream_ref>
+#include <thrust/device_vector.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief A succinct LOUDS (level-order unary degree sequence) trie over variable-length keys.
+ *
+ * The trie topology is stored in per-level rank/select bitsets (`dynamic_bitset`): one bitset
+ * encodes the children of the previous level's nodes as unary groups, a second one flags the
+ * nodes where a key terminates, and a plain array holds the node labels. This representation
+ * takes only a few bits per node while still allowing constant-time child navigation via the
+ * bitsets' rank/select acceleration structures, which makes it suitable for prefix matching
+ * over tens of millions of keys entirely on the GPU.
+ *
+ * Keys are inserted on the host in lexicographically sorted order (the level-order layout is
+ * constructed incrementally from the shared prefixes of consecutive keys), then `build`
+ * finalizes the device-side rank/select indexes. Afterwards the bulk `lookup` and `prefix_count`
+ * APIs — or the device `ref` — can be used to query the trie. Keys for the bulk APIs are passed
+ * as a flat array of labels plus exclusive offsets, matching the layout used for string keys in
+ * the hashing-based containers.
+ *
+ * Example usage:
+ * @code{.cpp}
+ * cuco::experimental::trie<char> trie;
+ * for (auto const& key : sorted_keys) {
+ *   trie.insert(key.begin(), key.end());
+ * }
+ * trie.build();
+ *
+ * trie.lookup(d_labels.begin(), d_offsets.begin(), d_offsets.end(), d_results.begin());
+ * @endcode
+ *
+ * @tparam LabelType Type of the individual characters of the keys
+ */
+template <typename LabelType>
+class trie {
+ public:
+  using size_type  = std::size_t;             ///< Size type
+  using label_type = LabelType;               ///< Label type
+  using ref_type   = trie_ref<label_type>;    ///< Non-owning container ref type
+
+  /// Sentinel value returned by `lookup` for keys not present in the trie
+  static constexpr size_type not_found = ref_type::not_found;
+
+  /**
+   * @brief Constructs an empty trie
+   */
+  trie();
+
+  /**
+   * @brief Inserts a single key into the trie
+   *
+   * @note Keys must be inserted in lexicographically sorted order and must be unique.
+   *
+   * @throw If the key is not strictly greater than the previously inserted key
+   * @throw If the trie has already been built
+   *
+   * @tparam LabelIt Input iterator whose `value_type` is convertible to `label_type`
+   *
+   * @param labels_begin Begin iterator to the labels of the key
+   * @param labels_end End iterator to the labels of the key
+   */
+  template <typename LabelIt>
+  void insert(LabelIt labels_begin, LabelIt labels_end);
+
+  /**
+   * @brief Builds the device-side rank/select indexes of all levels
+   *
+   * Must be called once after the last `insert` and before any lookup operation. Calling `build`
+   * on an already built trie is a no-op.
+   *
+   * @param stream Stream to execute the index construction kernels
+   */
+  void build(cuda::stream_ref stream = {});
+
+  /**
+   * @brief For each key `i` in the range of offsets, stores the index of the key in the trie (or
+   * `not_found`) to `outputs_begin[i]`.
+   *
+   * Key indices enumerate the stored keys sorted by (length, lexicographic order).
+   *
+   * @throw If the trie has not been built
+   *
+   * @tparam LabelIt Device-accessible iterator to the concatenated labels of all keys
+   * @tparam OffsetIt Device-accessible iterator to the exclusive key offsets
+   * @tparam OutputIt Device-accessible iterator whose `value_type` can be constructed from
+   * `size_type`
+   *
+   * @param labels_begin Begin iterator to the concatenated labels
+   * @param offsets_begin Begin iterator to the key offsets
+   * @param offsets_end End iterator to the key offsets (`num_keys + 1` entries)
+   * @param outputs_begin Begin iterator to the lookup results
+   * @param stream Stream to execute the lookup kernel
+   */
+  template <typename LabelIt, typename OffsetIt, typename OutputIt>
+  void lookup(LabelIt labels_begin,
+              OffsetIt offsets_begin,
+              OffsetIt offsets_end,
+              OutputIt outputs_begin,
+              cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief For each prefix `i` in the range of offsets, stores the number of stored keys starting
+   * with the prefix to `outputs_begin[i]`.
+   *
+   * A key counts as a prefix of itself, i.e. the count of a stored key is at least one.
+   *
+   * @throw If the trie has not been built
+   *
+   * @tparam LabelIt Device-accessible iterator to the concatenated labels of all prefixes
+   * @tparam OffsetIt Device-accessible iterator to the exclusive prefix offsets
+   * @tparam OutputIt Device-accessible iterator whose `value_type` can be constructed from
+   * `size_type`
+   *
+   * @param labels_begin Begin iterator to the concatenated labels
+   * @param offsets_begin Begin iterator to the prefix offsets
+   * @param offsets_end End iterator to the prefix offsets (`num_prefixes + 1` entries)
+   * @param outputs_begin Begin iterator to the prefix counts
+   * @param stream Stream to execute the prefix count kernel
+   */
+  template <typename LabelIt, typename OffsetIt, typename OutputIt>
+  void prefix_count(LabelIt labels_begin,
+                    OffsetIt offsets_begin,
+                    OffsetIt offsets_end,
+                    OutputIt outputs_begin,
+                    cuda::stream_ref stream = {}) const;
+
+  /**
+   * @brief Gets the number of keys stored in the trie
+   *
+   * @return The number of keys
+   */
+  [[nodiscard]] size_type size() const noexcept;
+
+  /**
+   * @brief Gets non-owning device ref of the current object
+   *
+   * @throw If the trie has not been built
+   *
+   * @return Device ref of the current `trie` object
+   */
+  [[nodiscard]] ref_type ref() const;
+
+ private:
+  using bitset_type    = detail::dynamic_bitset<>;        ///< Rank/select bitset type
+  using level_ref_type = typename ref_type::level_ref;    ///< Per-level device view type
+
+  /**
+   * @brief Storage of one trie level
+   */
+  struct level {
+    bitset_type louds_;  ///< Children groups of the previous level's nodes, unary encoded
+    bitset_type outs_;   ///< One bit per node flagging whether a key terminates there
+    std::vector<label_type> labels_;              ///< Host-side node labels, in level order
+    thrust::device_vector<label_type> d_labels_;  ///< Device-side node labels, filled by `build`
+    size_type num_outputs_ = 0;                   ///< Number of keys terminating at this level
+  };
+
+  size_type n_keys_;                 ///< Number of keys stored in the trie
+  bool is_built_;                    ///< Flag indicating whether `build` has been called
+  std::vector<label_type> last_key_; ///< Most recently inserted key
+  std::vector<level> levels_;        ///< Host-side level storage
+  /// Device array of per-level views, populated by `build`
+  thrust::device_vector<level_ref_type> level_refs_;
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/trie/trie.inl>
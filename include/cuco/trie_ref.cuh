@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/trie/dynamic_bitset/dynamic_bitset.cuh>
+
+#include <cstddef>
+
+namespace cuco {
+namespace experimental {
+
+/**
+ * @brief Device non-owning "ref" type of `trie` that can be used in device code to perform
+ * single lookup and prefix count operations.
+ *
+ * @note Refs are only valid after the owning `trie` has been built and as long as it is neither
+ * modified nor destroyed.
+ *
+ * @tparam LabelType Type of the individual characters of the keys
+ */
+template <typename LabelType>
+class trie_ref {
+ public:
+  using size_type  = std::size_t;  ///< Size type
+  using label_type = LabelType;    ///< Label type
+
+  /// Non-owning device ref type of the per-level bitsets
+  using bitset_ref = typename detail::dynamic_bitset<>::ref_type;
+
+  /// Sentinel value returned by `lookup` for keys not present in the trie
+  static constexpr size_type not_found = static_cast<size_type>(-1);
+
+  /**
+   * @brief Non-owning view of the storage of one trie level
+   */
+  struct level_ref {
+    bitset_ref louds_;          ///< Children groups of the previous level's nodes, unary encoded
+    bitset_ref outs_;           ///< One bit per node flagging whether a key terminates there
+    label_type const* labels_;  ///< Node labels, in level order
+    size_type offset_;          ///< Number of keys terminating at shallower levels
+  };
+
+  /**
+   * @brief Constructs a trie ref
+   *
+   * @param levels Pointer to the device array of level views
+   * @param num_levels Number of levels
+   * @param n_keys Number of keys stored in the trie
+   */
+  __host__ __device__ explicit constexpr trie_ref(level_ref const* levels,
+                                                  size_type num_levels,
+                                                  size_type n_keys) noexcept;
+
+  /**
+   * @brief Looks up a single key in the trie
+   *
+   * @tparam LabelIt Device-accessible iterator whose `value_type` is convertible to `label_type`
+   *
+   * @param begin Begin iterator to the labels of the key
+   * @param end End iterator to the labels of the key
+   *
+   * @return Index of the key if present, `not_found` otherwise. Key indices enumerate the stored
+   * keys sorted by (length, lexicographic order).
+   */
+  template <typename LabelIt>
+  [[nodiscard]] __device__ size_type lookup(LabelIt begin, LabelIt end) const noexcept;
+
+  /**
+   * @brief Counts the number of stored keys that have the given key as a prefix
+   *
+   * A key counts as a prefix of itself, i.e. the count of a stored key is at least one.
+   *
+   * @tparam LabelIt Device-accessible iterator whose `value_type` is convertible to `label_type`
+   *
+   * @param begin Begin iterator to the labels of the prefix
+   * @param end End iterator to the labels of the prefix
+   *
+   * @return Number of stored keys starting with the given prefix
+   */
+  template <typename LabelIt>
+  [[nodiscard]] __device__ size_type prefix_count(LabelIt begin, LabelIt end) const noexcept;
+
+ private:
+  /**
+   * @brief Moves from a node to its child with the given label
+   *
+   * @param label Label of the child to search for
+   * @param node_id Index of the parent node at the previous level; set to the index of the
+   * matching child on success
+   * @param level View of the level holding the children
+   *
+   * @return `true` if the node has a child with the given label
+   */
+  [[nodiscard]] __device__ bool find_child(label_type label,
+                                           size_type& node_id,
+                                           level_ref const& level) const noexcept;
+
+  level_ref const* levels_;  ///< Device array of level views
+  size_type num_levels_;     ///< Number of levels
+  size_type n_keys_;         ///< Number of keys stored in the trie
+};
+
+}  // namespace experimental
+}  // namespace cuco
+
+#include <cuco/detail/trie/trie_ref.inl>
@@ -60,6 +60,51 @@ class cuda_allocator {
   void deallocate(value_type* p, std::size_t) { CUCO_CUDA_TRY(cudaFree(p)); }
 };
 
+/**
+ * @brief A managed-memory allocator using `cudaMallocManaged`/`cudaFree` to satisfy
+ * (de)allocations.
+ *
+ * Managed memory is accessible from both host and device code and is paged in on demand, so it
+ * allows allocations to exceed the device memory capacity at the cost of slower access.
+ *
+ * @tparam T The allocator's value type
+ */
+template <typename T>
+class managed_allocator {
+ public:
+  using value_type = T;  ///< Allocator's value type
+
+  managed_allocator() = default;
+
+  /**
+   * @brief Copy constructor.
+   */
+  template <class U>
+  managed_allocator(managed_allocator<U> const&) noexcept
+  {
+  }
+
+  /**
+   * @brief Allocates storage for `n` objects of type `T` using `cudaMallocManaged`.
+   *
+   * @param n The number of objects to allocate storage for
+   * @return Pointer to the allocated storage
+   */
+  value_type* allocate(std::size_t n)
+  {
+    value_type* p;
+    CUCO_CUDA_TRY(cudaMallocManaged(&p, sizeof(value_type) * n));
+    return p;
+  }
+
+  /**
+   * @brief Deallocates storage pointed to by `p`.
+   *
+   * @param p Pointer to memory to deallocate
+   */
+  void deallocate(value_type* p, std::size_t) { CUCO_CUDA_TRY(cudaFree(p)); }
+};
+
 /**
  * @brief Equality comparison operator.
  *
@@ -91,4 +136,35 @@ bool operator!=(cuda_allocator<T> const& lhs, cuda_allocator<U> const& rhs) noex
   return not(lhs == rhs);
 }
 
+/**
+ * @brief Equality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @return `true` iff given arguments are equal
+ */
+template <typename T, typename U>
+bool operator==(managed_allocator<T> const&, managed_allocator<U> const&) noexcept
+{
+  return true;
+}
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments are not equal
+ */
+template <typename T, typename U>
+bool operator!=(managed_allocator<T> const& lhs, managed_allocator<U> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
 }  // namespace cuco
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cuda_runtime_api.h>
+
+#include <utility>
+
+namespace cuco {
+namespace utility {
+
+/**
+ * @brief Utility that records a sequence of stream-ordered bulk operations into a CUDA graph once
+ * and replays it with a single graph launch afterwards.
+ *
+ * @note This utility targets workloads that issue many small bulk operations per second, where the
+ * per-kernel launch overhead dominates latency. Record the steady-state operation sequence once
+ * using the containers' `*_bounded_async` APIs (which size their launch configurations for a fixed
+ * maximum batch size and read the actual batch size from device memory), then update the device
+ * count and input buffers and `replay` the pipeline for each batch.
+ *
+ * @note All operations issued while recording must be capturable, i.e., they must not synchronize
+ * the stream or allocate/free memory through non-stream-ordered APIs.
+ */
+class graph_pipeline {
+ public:
+  graph_pipeline() = default;
+
+  /**
+   * @brief Move constructor.
+   *
+   * @param other The pipeline to move from
+   */
+  graph_pipeline(graph_pipeline&& other) noexcept
+    : graph_{std::exchange(other.graph_, nullptr)}, exec_{std::exchange(other.exec_, nullptr)}
+  {
+  }
+
+  /**
+   * @brief Replaces the contents of the pipeline with another pipeline.
+   *
+   * @param other The pipeline to move from
+   *
+   * @return Reference of the current pipeline object
+   */
+  graph_pipeline& operator=(graph_pipeline&& other) noexcept
+  {
+    this->destroy();
+    graph_ = std::exchange(other.graph_, nullptr);
+    exec_  = std::exchange(other.exec_, nullptr);
+    return *this;
+  }
+
+  graph_pipeline(graph_pipeline const&)            = delete;
+  graph_pipeline& operator=(graph_pipeline const&) = delete;
+
+  ~graph_pipeline() { this->destroy(); }
+
+  /**
+   * @brief Records the operation sequence issued by `op` into a CUDA graph.
+   *
+   * @note `op` is invoked exactly once with the capture stream and must issue all its work to that
+   * stream.
+   * @note Re-recording an already recorded pipeline replaces the previous graph.
+   *
+   * @throw If stream capture or graph instantiation fails
+   *
+   * @tparam RecordOp Unary callable invoked with `cuda::stream_ref`
+   *
+   * @param op Callable issuing the stream-ordered operations to record
+   * @param stream CUDA stream used for the capture
+   */
+  template <typename RecordOp>
+  void record(RecordOp&& op, cuda::stream_ref stream = {})
+  {
+    this->destroy();
+
+    CUCO_CUDA_TRY(cudaStreamBeginCapture(stream.get(), cudaStreamCaptureModeThreadLocal));
+    std::forward<RecordOp>(op)(stream);
+    CUCO_CUDA_TRY(cudaStreamEndCapture(stream.get(), &graph_));
+    CUCO_CUDA_TRY(cudaGraphInstantiate(&exec_, graph_, nullptr, nullptr, 0));
+  }
+
+  /**
+   * @brief Replays the recorded operation sequence with a single graph launch.
+   *
+   * @throw If the pipeline has not been recorded yet
+   * @throw If the graph launch fails
+   *
+   * @param stream CUDA stream used for the graph launch
+   */
+  void replay(cuda::stream_ref stream = {}) const
+  {
+    CUCO_EXPECTS(exec_ != nullptr, "Cannot replay a pipeline that has not been recorded");
+    CUCO_CUDA_TRY(cudaGraphLaunch(exec_, stream.get()));
+  }
+
+  /**
+   * @brief Indicates whether the pipeline holds a recorded operation sequence.
+   *
+   * @return `true` if the pipeline has been recorded
+   */
+  [[nodiscard]] bool recorded() const noexcept { return exec_ != nullptr; }
+
+ private:
+  /**
+   * @brief Destroys the graph and its executable instance, if any.
+   */
+  void destroy() noexcept
+  {
+    if (exec_ != nullptr) {
+      cudaGraphExecDestroy(exec_);
+      exec_ = nullptr;
+    }
+    if (graph_ != nullptr) {
+      cudaGraphDestroy(graph_);
+      graph_ = nullptr;
+    }
+  }
+
+  cudaGraph_t graph_{nullptr};     ///< Captured operation graph
+  cudaGraphExec_t exec_{nullptr};  ///< Executable graph instance
+};
+
+}  // namespace utility
+}  // namespace cuco
@@ -77,6 +77,29 @@ struct gaussian : public cuco::detail::strong_type<double> {
   }
 };
 
+/**
+ * @brief Tag struct representing a gaussian distribution whose skew drifts linearly over the
+ * generated sequence.
+ *
+ * Models workloads whose hot key set sharpens or widens over time: the first generated key is
+ * drawn with `skew_start`, the last one with `skew_end`, and keys in between use a linear
+ * interpolation of the two.
+ */
+struct drifting_gaussian {
+  /**
+   * @param skew_start Skew used at the beginning of the sequence
+   * @param skew_end Skew used at the end of the sequence
+   */
+  drifting_gaussian(double skew_start, double skew_end)
+    : skew_start{skew_start}, skew_end{skew_end}
+  {
+    CUCO_EXPECTS(skew_start > 0 and skew_end > 0, "Skew must be greater than 0");
+  }
+
+  double skew_start;  ///< Skew at the beginning of the sequence
+  double skew_end;    ///< Skew at the end of the sequence
+};
+
 }  // namespace distribution
 
 namespace detail {
@@ -165,6 +188,58 @@ struct generate_gaussian_fn {
   Dist dist_;        ///< Random number distribution
 };
 
+/**
+ * @brief Generate drifting gaussian functor
+ *
+ * @tparam T the output data type
+ * @tparam Dist Random number distribution type
+ * @tparam RNG Pseudo-random number generator type
+ */
+template <typename T, typename Dist, typename RNG>
+struct generate_drifting_gaussian_fn {
+  /**
+   * @brief Constructs the drifting gaussian distribution generator functor
+   *
+   * @param num Number of elements to generate
+   * @param dist Random number distribution
+   * @param seed Base random number generator seed
+   */
+  __host__ __device__ constexpr generate_drifting_gaussian_fn(std::size_t num,
+                                                              Dist dist,
+                                                              std::size_t seed)
+    : num_{num}, dist_{dist}, seed_{seed}
+  {
+  }
+
+  /**
+   * @brief Generates a random number of type `T` for the given sequence position `idx`
+   *
+   * @param idx Position within the generated sequence
+   *
+   * @return A resulting random number
+   */
+  __host__ __device__ constexpr T operator()(std::size_t idx) const noexcept
+  {
+    auto const progress =
+      num_ > 1 ? static_cast<double>(idx) / static_cast<double>(num_ - 1) : 0.0;
+    auto const skew = dist_.skew_start + progress * (dist_.skew_end - dist_.skew_start);
+
+    RNG rng;
+    thrust::normal_distribution<> normal_dist(static_cast<double>(num_ / 2), num_ * skew);
+    rng.seed(seed_ + idx);
+    auto val = normal_dist(rng);
+    while (val < 0 or val >= num_) {
+      // Re-sample if the value is outside the range [0, N)
+      val = normal_dist(rng);
+    }
+    return val;
+  }
+
+  std::size_t num_;   ///< Number of elements to generate
+  Dist dist_;         ///< Random number distribution
+  std::size_t seed_;  ///< Base random number generator seed
+};
+
 /**
  * @brief Dropout transform functor
  *
@@ -292,6 +367,17 @@ class key_generator {
                         seq + num_keys,
                         out_begin,
                         detail::generate_gaussian_fn<value_type, Dist, RNG>{num_keys, dist});
+    } else if constexpr (std::is_same_v<Dist, distribution::drifting_gaussian>) {
+      size_t num_keys = thrust::distance(out_begin, out_end);
+
+      thrust::counting_iterator<size_t> seq(0);
+
+      thrust::transform(
+        exec_policy,
+        seq,
+        seq + num_keys,
+        out_begin,
+        detail::generate_drifting_gaussian_fn<value_type, Dist, RNG>{num_keys, dist, this->rng_()});
     } else {
       CUCO_FAIL("Unexpected distribution type");
     }
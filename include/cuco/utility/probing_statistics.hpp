@@ -0,0 +1,45 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+
+namespace cuco {
+
+/**
+ * @brief Probing diagnostics snapshot of an open addressing container.
+ *
+ * Reports how far the keys currently resident in the container have drifted from their home
+ * position, i.e., how many window probes a `find` for each resident key takes with the container's
+ * probing scheme. Long probe chains and a high tombstone fraction indicate that the container
+ * would benefit from a larger capacity or an in-place `rehash`.
+ */
+struct probing_statistics {
+  /// Number of probe length histogram bins
+  static constexpr std::size_t num_bins = 32;
+
+  /// Probe length histogram: `histogram[i]` is the number of resident keys found after exactly
+  /// `i + 1` window probes; the last bin additionally aggregates all longer probe chains
+  std::array<std::size_t, num_bins> histogram{};
+  /// Longest probe chain of any resident key
+  std::size_t max_probe_length{};
+  /// Fraction of the container's slots occupied by erased sentinels
+  double tombstone_fraction{};
+};
+
+}  // namespace cuco
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <limits>
+
+namespace cuco {
+
+/**
+ * @brief A device allocator using `cudaMallocAsync`/`cudaFreeAsync` to satisfy (de)allocations in
+ * stream order.
+ *
+ * Unlike `cuco::cuda_allocator`, (de)allocations performed through this allocator do not
+ * synchronize the device. Using it as the `Allocator` of a container makes construction,
+ * `clear_async`, and `rehash_async` fully stream-ordered, which avoids serializing pipelines that
+ * build many short-lived containers.
+ *
+ * All (de)allocations are ordered with respect to the stream given at construction. The caller is
+ * responsible for ensuring the allocator's stream is ordered after any stream that accesses the
+ * allocated memory, e.g., via events or by using the same stream throughout.
+ *
+ * @tparam T The allocator's value type
+ */
+template <typename T>
+class stream_ordered_allocator {
+ public:
+  using value_type = T;  ///< Allocator's value type
+
+  /**
+   * @brief Constructs a stream-ordered allocator using the device's default memory pool.
+   *
+   * @param stream Stream on which (de)allocations are ordered
+   */
+  stream_ordered_allocator(cuda::stream_ref stream = {}) noexcept : stream_{stream}, pool_{nullptr}
+  {
+  }
+
+  /**
+   * @brief Constructs a stream-ordered allocator using an explicit memory pool.
+   *
+   * @param pool Memory pool used to satisfy allocations
+   * @param stream Stream on which (de)allocations are ordered
+   */
+  stream_ordered_allocator(cudaMemPool_t pool, cuda::stream_ref stream = {}) noexcept
+    : stream_{stream}, pool_{pool}
+  {
+  }
+
+  /**
+   * @brief Copy constructor.
+   */
+  template <class U>
+  stream_ordered_allocator(stream_ordered_allocator<U> const& other) noexcept
+    : stream_{other.stream()}, pool_{other.pool()}
+  {
+  }
+
+  /**
+   * @brief Allocates storage for `n` objects of type `T` in stream order.
+   *
+   * @param n The number of objects to allocate storage for
+   * @return Pointer to the allocated storage
+   */
+  value_type* allocate(std::size_t n)
+  {
+    value_type* p;
+    if (pool_ != nullptr) {
+      CUCO_CUDA_TRY(
+        cudaMallocFromPoolAsync(reinterpret_cast<void**>(&p), sizeof(value_type) * n, pool_, stream_.get()));
+    } else {
+      CUCO_CUDA_TRY(
+        cudaMallocAsync(reinterpret_cast<void**>(&p), sizeof(value_type) * n, stream_.get()));
+    }
+    return p;
+  }
+
+  /**
+   * @brief Deallocates storage pointed to by `p` in stream order.
+   *
+   * @param p Pointer to memory to deallocate
+   */
+  void deallocate(value_type* p, std::size_t) { CUCO_CUDA_TRY(cudaFreeAsync(p, stream_.get())); }
+
+  /**
+   * @brief Gets the stream on which (de)allocations are ordered.
+   *
+   * @return The allocator's stream
+   */
+  [[nodiscard]] cuda::stream_ref stream() const noexcept { return stream_; }
+
+  /**
+   * @brief Gets the memory pool used to satisfy allocations.
+   *
+   * @return The allocator's memory pool, or `nullptr` if the device's default pool is used
+   */
+  [[nodiscard]] cudaMemPool_t pool() const noexcept { return pool_; }
+
+  /**
+   * @brief Grows the underlying pool to hold at least `bytes` bytes.
+   *
+   * Warming up the pool avoids `cudaMalloc` calls into the driver on the critical path: subsequent
+   * stream-ordered allocations of up to `bytes` bytes are satisfied from already-mapped memory.
+   *
+   * @note This function synchronizes the given stream.
+   *
+   * @param bytes Number of bytes to reserve in the pool
+   */
+  void reserve_pool(std::size_t bytes)
+  {
+    void* p;
+    if (pool_ != nullptr) {
+      CUCO_CUDA_TRY(cudaMallocFromPoolAsync(&p, bytes, pool_, stream_.get()));
+    } else {
+      CUCO_CUDA_TRY(cudaMallocAsync(&p, bytes, stream_.get()));
+    }
+    CUCO_CUDA_TRY(cudaFreeAsync(p, stream_.get()));
+    stream_.wait();
+  }
+
+  /**
+   * @brief Sets the amount of memory the pool keeps cached after a stream synchronization.
+   *
+   * By default, CUDA releases all unused pool memory back to the OS at synchronization points,
+   * which defeats pooling for workloads that repeatedly construct and destroy containers. Setting
+   * a high threshold (e.g., `std::numeric_limits<std::size_t>::max()` to never release) keeps the
+   * memory cached.
+   *
+   * @param bytes Number of bytes the pool holds on to after synchronization
+   */
+  void set_release_threshold(std::size_t bytes)
+  {
+    auto pool = pool_;
+    if (pool == nullptr) {
+      int device;
+      CUCO_CUDA_TRY(cudaGetDevice(&device));
+      CUCO_CUDA_TRY(cudaDeviceGetDefaultMemPool(&pool, device));
+    }
+    std::uint64_t threshold = bytes;
+    CUCO_CUDA_TRY(cudaMemPoolSetAttribute(pool, cudaMemPoolAttrReleaseThreshold, &threshold));
+  }
+
+ private:
+  cuda::stream_ref stream_;  ///< Stream on which (de)allocations are ordered
+  cudaMemPool_t pool_;       ///< Memory pool used to satisfy allocations
+};
+
+/**
+ * @brief Equality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments use the same stream and pool
+ */
+template <typename T, typename U>
+bool operator==(stream_ordered_allocator<T> const& lhs,
+                stream_ordered_allocator<U> const& rhs) noexcept
+{
+  return lhs.stream() == rhs.stream() and lhs.pool() == rhs.pool();
+}
+
+/**
+ * @brief Inequality comparison operator.
+ *
+ * @tparam T Value type of LHS object
+ * @tparam U Value type of RHS object
+ *
+ * @param lhs Left-hand side object to compare
+ * @param rhs Right-hand side object to compare
+ *
+ * @return `true` iff given arguments are not equal
+ */
+template <typename T, typename U>
+bool operator!=(stream_ordered_allocator<T> const& lhs,
+                stream_ordered_allocator<U> const& rhs) noexcept
+{
+  return not(lhs == rhs);
+}
+
+}  // namespace cuco
@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+#include <cuco/detail/utility/cuda.cuh>
+
+#include <cuda/atomic>
+#include <cuda/stream_ref>
+
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace cuco {
+namespace utility {
+
+namespace detail {
+
+/**
+ * @brief Control block of a streaming insert queue, placed in host-mapped memory.
+ *
+ * All members use `cuda::thread_scope_system` atomics so that host producers and the persistent
+ * device consumer observe each other's updates.
+ */
+struct streaming_queue_control {
+  cuda::atomic<std::uint64_t, cuda::thread_scope_system> tail_reserve;  ///< Producer slot reserve
+  cuda::atomic<std::uint64_t, cuda::thread_scope_system> tail_commit;   ///< Producer publish index
+  cuda::atomic<std::uint64_t, cuda::thread_scope_system> head;          ///< Consumer read index
+  cuda::atomic<std::uint64_t, cuda::thread_scope_system> completed;     ///< Completed request count
+  cuda::atomic<std::uint32_t, cuda::thread_scope_system> stop;          ///< Shutdown flag
+};
+
+/**
+ * @brief Persistent kernel consuming insert requests from a ring buffer.
+ *
+ * A single thread block spins on the queue's commit index and cooperatively drains up to
+ * `BlockSize` requests per iteration, inserting them through `ref` and acknowledging completion
+ * via the control block's `completed` counter. The kernel exits once the `stop` flag is set and
+ * the ring has been drained.
+ *
+ * @tparam BlockSize Number of threads in the block
+ * @tparam Value Request value type of the ring buffer
+ * @tparam Ref Container ref type with `insert` support
+ *
+ * @param ring Pointer to the request ring buffer in host-mapped memory
+ * @param mask Ring capacity minus one; the capacity must be a power of two
+ * @param control Pointer to the queue control block in host-mapped memory
+ * @param ref Non-owning container device ref used to perform the inserts
+ */
+template <int32_t BlockSize, typename Value, typename Ref>
+CUCO_KERNEL __launch_bounds__(BlockSize) void streaming_insert(Value const* ring,
+                                                               std::uint64_t mask,
+                                                               streaming_queue_control* control,
+                                                               Ref ref)
+{
+  __shared__ std::uint64_t batch_size;
+
+  auto head = control->head.load(cuda::memory_order_relaxed);
+  while (true) {
+    if (threadIdx.x == 0) {
+      auto const committed = control->tail_commit.load(cuda::memory_order_acquire);
+      auto n               = committed - head;
+      if (n > BlockSize) { n = BlockSize; }
+      if (n == 0 and control->stop.load(cuda::memory_order_relaxed)) {
+        n = ~std::uint64_t{0};  // shutdown sentinel
+      }
+      batch_size = n;
+    }
+    __syncthreads();
+    auto const n = batch_size;
+    __syncthreads();
+
+    if (n == ~std::uint64_t{0}) { return; }
+    if (n == 0) { continue; }
+
+    if (threadIdx.x < n) { ref.insert(ring[(head + threadIdx.x) & mask]); }
+    __syncthreads();
+
+    head += n;
+    if (threadIdx.x == 0) {
+      control->head.store(head, cuda::memory_order_release);
+      control->completed.fetch_add(n, cuda::memory_order_release);
+    }
+  }
+}
+
+}  // namespace detail
+
+/**
+ * @brief Lock-free MPSC request queue feeding a persistent device-side insert kernel.
+ *
+ * @note This utility targets latency-critical streaming ingest where even the overhead of a kernel
+ * or graph launch per batch is too high. Construction launches a persistent single-block kernel
+ * that owns the given container ref and consumes insert requests from a ring buffer in host-mapped
+ * memory; `push` makes requests visible to the device without any launch, and `wait` blocks until
+ * a previously returned ticket has been consumed.
+ *
+ * @note The persistent kernel occupies an SM until the queue is destroyed. The queue must be
+ * constructed on a non-default stream and no other work should be submitted to that stream while
+ * the queue is alive.
+ *
+ * @note `push` is safe to call concurrently from multiple host threads. Visibility of the inserted
+ * elements to concurrent device-side probes follows the container's thread scope.
+ *
+ * @tparam Ref Container ref type with `insert` support and `cg_size == 1`
+ */
+template <typename Ref>
+class streaming_insert_queue {
+ public:
+  using value_type = typename Ref::value_type;  ///< Insert request type
+
+  static_assert(Ref::cg_size == 1,
+                "streaming_insert_queue requires a container ref with cg_size == 1");
+
+  /**
+   * @brief Constructs the queue and launches the persistent consumer kernel.
+   *
+   * @throw If `capacity` is not a power of two
+   * @throw If allocating the host-mapped ring buffer fails
+   *
+   * @param ref Non-owning container device ref used to perform the inserts
+   * @param capacity Maximum number of in-flight requests; must be a power of two
+   * @param stream Non-default CUDA stream the persistent kernel is launched on
+   */
+  streaming_insert_queue(Ref ref, std::size_t capacity, cuda::stream_ref stream)
+    : capacity_{capacity}, stream_{stream}
+  {
+    CUCO_EXPECTS(capacity > 0 and (capacity & (capacity - 1)) == 0,
+                 "Queue capacity must be a power of two");
+
+    CUCO_CUDA_TRY(cudaHostAlloc(&ring_, sizeof(value_type) * capacity_, cudaHostAllocMapped));
+    CUCO_CUDA_TRY(
+      cudaHostAlloc(&control_, sizeof(detail::streaming_queue_control), cudaHostAllocMapped));
+    new (control_) detail::streaming_queue_control{};
+
+    value_type* device_ring;
+    detail::streaming_queue_control* device_control;
+    CUCO_CUDA_TRY(cudaHostGetDevicePointer(&device_ring, ring_, 0));
+    CUCO_CUDA_TRY(cudaHostGetDevicePointer(&device_control, control_, 0));
+
+    detail::streaming_insert<block_size><<<1, block_size, 0, stream.get()>>>(
+      device_ring, capacity_ - 1, device_control, ref);
+  }
+
+  streaming_insert_queue(streaming_insert_queue const&)            = delete;
+  streaming_insert_queue(streaming_insert_queue&&)                 = delete;
+  streaming_insert_queue& operator=(streaming_insert_queue const&) = delete;
+  streaming_insert_queue& operator=(streaming_insert_queue&&)      = delete;
+
+  /**
+   * @brief Signals shutdown, drains the queue, waits for the consumer kernel to exit, and frees
+   * the ring buffer.
+   */
+  ~streaming_insert_queue()
+  {
+    control_->stop.store(1, cuda::memory_order_release);
+    while (control_->completed.load(cuda::memory_order_acquire) !=
+           control_->tail_commit.load(cuda::memory_order_acquire)) {}
+    // the drain spin only proves the last request was consumed; the kernel still loads `stop` and
+    // `tail_commit` before exiting, so the host-mapped memory must outlive the kernel itself
+    cudaStreamSynchronize(stream_.get());
+    cudaFreeHost(ring_);
+    cudaFreeHost(control_);
+  }
+
+  /**
+   * @brief Enqueues `n` insert requests.
+   *
+   * @note Blocks while the ring buffer is full, i.e., while more than `capacity` requests are
+   * in flight.
+   *
+   * @param items Pointer to `n` contiguous requests in host memory
+   * @param n Number of requests to enqueue; must not exceed `capacity`
+   *
+   * @return Ticket that can be passed to `wait` to block until these requests have been consumed
+   *
+   * @throw std::invalid_argument if `n` is larger than `capacity`
+   */
+  std::uint64_t push(value_type const* items, std::size_t n)
+  {
+    CUCO_EXPECTS(n <= capacity_,
+                 "Batch size must not exceed the queue capacity",
+                 std::invalid_argument);
+
+    auto const begin = control_->tail_reserve.fetch_add(n, cuda::memory_order_relaxed);
+
+    // back-pressure: wait for ring space
+    while (begin + n - control_->head.load(cuda::memory_order_acquire) > capacity_) {}
+
+    auto const mask = capacity_ - 1;
+    for (std::size_t i = 0; i < n; ++i) {
+      ring_[(begin + i) & mask] = items[i];
+    }
+
+    // publish in reservation order so the consumer never reads unwritten slots
+    auto expected = begin;
+    while (not control_->tail_commit.compare_exchange_weak(
+      expected, begin + n, cuda::memory_order_release, cuda::memory_order_relaxed)) {
+      expected = begin;
+    }
+    return begin + n;
+  }
+
+  /**
+   * @brief Blocks until all requests up to `ticket` have been consumed.
+   *
+   * @param ticket Ticket previously returned by `push`
+   */
+  void wait(std::uint64_t ticket) const noexcept
+  {
+    while (control_->completed.load(cuda::memory_order_acquire) < ticket) {}
+  }
+
+  /**
+   * @brief Gets the number of requests consumed so far.
+   *
+   * @return The completed request count
+   */
+  [[nodiscard]] std::uint64_t completed() const noexcept
+  {
+    return control_->completed.load(cuda::memory_order_acquire);
+  }
+
+  /**
+   * @brief Gets the maximum number of in-flight requests.
+   *
+   * @return The queue capacity
+   */
+  [[nodiscard]] std::size_t capacity() const noexcept { return capacity_; }
+
+ private:
+  static constexpr int32_t block_size = 128;  ///< Consumer kernel block size
+
+  std::size_t capacity_;                       ///< Ring buffer capacity
+  cuda::stream_ref stream_;                    ///< Stream the persistent kernel runs on
+  value_type* ring_;                           ///< Request ring buffer in host-mapped memory
+  detail::streaming_queue_control* control_;   ///< Queue control block in host-mapped memory
+};
+
+}  // namespace utility
+}  // namespace cuco
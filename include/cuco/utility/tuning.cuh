@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cuco/detail/error.hpp>
+
+#include <cuda/stream_ref>
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+
+namespace cuco {
+
+/**
+ * @brief Compile-time probing configuration tag.
+ *
+ * Bundles the two compile-time knobs that dominate probing throughput: the cooperative group size
+ * used by the probing scheme and the window size of the slot storage. Both parameters are baked
+ * into a container's type — the probe sequence depends on the CG size and the slot layout depends
+ * on the window size — so a configuration must be chosen when a container is constructed and
+ * cannot change over its lifetime.
+ *
+ * @tparam CGSize Number of threads in the probing cooperative group
+ * @tparam WindowSize Number of slots per window
+ */
+template <int32_t CGSize, int32_t WindowSize>
+struct probing_config {
+  static constexpr int32_t cg_size     = CGSize;      ///< CG size used for probing
+  static constexpr int32_t window_size = WindowSize;  ///< Number of slots per window
+};
+
+/// Number of probing configurations instantiated by `dispatch_probing_config`
+inline constexpr std::size_t num_probing_configs = 4;
+
+/**
+ * @brief Invokes `f` with the probing configuration selected by the runtime index.
+ *
+ * Instantiates `f` for a small fixed matrix of `(cg_size, window_size)` combinations that covers
+ * the throughput-optimal operating points across load factors and slot sizes, and calls the
+ * variant selected by `index`. This lets callers pick a near-optimal configuration at runtime
+ * while compiling only `num_probing_configs` instantiations instead of the full parameter cross
+ * product:
+ *
+ * @code{.cpp}
+ * auto const index = cuco::select_probing_config(0.6, sizeof(key_type));
+ * cuco::dispatch_probing_config(index, [&](auto config) {
+ *   using config_type = decltype(config);
+ *   using probing     = cuco::double_hashing<config_type::cg_size, cuco::default_hash_function<K>>;
+ *   auto set          = cuco::static_set{capacity, cuco::empty_key<K>{-1}, {}, probing{}, {},
+ *                                        cuco::storage<config_type::window_size>{}};
+ *   // ... bulk operations
+ * });
+ * @endcode
+ *
+ * @tparam F Callable type invocable with every `probing_config` of the matrix
+ *
+ * @param index Index of the configuration to select; indexes beyond the matrix select the last
+ * configuration
+ * @param f Callable invoked with the selected configuration tag
+ *
+ * @return The result of invoking `f`
+ */
+template <typename F>
+decltype(auto) dispatch_probing_config(std::size_t index, F&& f)
+{
+  switch (index) {
+    case 0: return std::forward<F>(f)(probing_config<1, 2>{});
+    case 1: return std::forward<F>(f)(probing_config<2, 2>{});
+    case 2: return std::forward<F>(f)(probing_config<4, 2>{});
+    default: return std::forward<F>(f)(probing_config<8, 1>{});
+  }
+}
+
+/**
+ * @brief Selects a probing configuration index from the expected table occupancy and slot size.
+ *
+ * The heuristic follows the behavior observed in the library benchmarks: scalar probing with
+ * multi-slot windows wins at low occupancy where probe chains are short, while larger cooperative
+ * groups amortize long probe chains at high occupancy. Wide slots saturate a window load with
+ * fewer slots, so 16-byte slots fall back to single-slot windows probed by a full group.
+ *
+ * @param occupancy Expected ratio of filled slots to capacity, in `[0, 1]`
+ * @param slot_size Size of a slot (key or key/value pair) in bytes
+ *
+ * @return Configuration index to pass to `dispatch_probing_config`
+ */
+[[nodiscard]] constexpr std::size_t select_probing_config(double occupancy,
+                                                          std::size_t slot_size = 4) noexcept
+{
+  if (slot_size > 8) { return 3; }
+  if (occupancy <= 0.5) { return 0; }
+  if (occupancy <= 0.8) { return 1; }
+  return 2;
+}
+
+/**
+ * @brief Determines the fastest probing configuration by timing a caller-provided workload.
+ *
+ * Runs `f` once per configuration as a warmup and once under CUDA event timing, and returns the
+ * index of the fastest configuration. The workload should exercise the bulk operations of the
+ * target use case on a representative sample, e.g., construct a container with the given
+ * configuration and run `insert` and `contains` on a slice of the input. This one-time probe
+ * complements `select_probing_config` when the workload characteristics (hit rate, key
+ * distribution) are not known in advance.
+ *
+ * @note This function synchronizes the given stream after each timed run.
+ *
+ * @tparam F Callable type invocable with every `probing_config` of the matrix
+ *
+ * @param f Workload invoked with each configuration tag
+ * @param stream CUDA stream the workload is expected to execute in
+ *
+ * @return Index of the fastest configuration to pass to `dispatch_probing_config`
+ */
+template <typename F>
+std::size_t fastest_probing_config(F&& f, cuda::stream_ref stream = {})
+{
+  cudaEvent_t start, stop;
+  CUCO_CUDA_TRY(cudaEventCreate(&start));
+  CUCO_CUDA_TRY(cudaEventCreate(&stop));
+
+  auto best_index = std::size_t{0};
+  auto best_time  = std::numeric_limits<float>::max();
+
+  for (std::size_t index = 0; index < num_probing_configs; ++index) {
+    dispatch_probing_config(index, [&](auto config) {
+      f(config);  // warmup run to exclude one-time costs from the measurement
+      CUCO_CUDA_TRY(cudaEventRecord(start, stream.get()));
+      f(config);
+      CUCO_CUDA_TRY(cudaEventRecord(stop, stream.get()));
+      CUCO_CUDA_TRY(cudaEventSynchronize(stop));
+
+      float elapsed_ms;
+      CUCO_CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, start, stop));
+      if (elapsed_ms < best_time) {
+        best_time  = elapsed_ms;
+        best_index = index;
+      }
+    });
+  }
+
+  CUCO_CUDA_TRY(cudaEventDestroy(start));
+  CUCO_CUDA_TRY(cudaEventDestroy(stop));
+
+  return best_index;
+}
+
+}  // namespace cuco
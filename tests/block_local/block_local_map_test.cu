@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/block_local_map.cuh>
+#include <cuco/static_map.cuh>
+
+#include <cuda/atomic>
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+
+#include <cooperative_groups.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+static constexpr std::size_t num_blocks     = 128;
+static constexpr std::size_t block_size     = 128;
+static constexpr std::size_t keys_per_block = 16;
+
+template <typename LocalMap, typename GlobalRef>
+__global__ void block_local_map_kernel(GlobalRef global_ref)
+{
+  using Key   = typename LocalMap::key_type;
+  using Value = typename LocalMap::mapped_type;
+
+  __shared__ typename LocalMap::window_type windows[LocalMap::num_windows];
+
+  auto const block = cooperative_groups::this_thread_block();
+  auto map = LocalMap{block, windows, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  // two-level aggregation: count key occurrences in shared memory first
+  Key const key = blockIdx.x * keys_per_block + block.thread_rank() % keys_per_block;
+
+  auto const slot = map.insert_and_find(cuco::pair<Key, Value>{key, 0}).first;
+  cuda::atomic_ref<Value, cuda::thread_scope_block> payload{slot->second};
+  payload.fetch_add(Value{1}, cuda::memory_order_relaxed);
+
+  // spill the partial aggregates into the global map
+  map.flush(block, global_ref);
+}
+
+TEMPLATE_TEST_CASE_SIG("Block-local map",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  constexpr std::size_t num_keys = num_blocks * keys_per_block;
+  constexpr Value expected_count = block_size / keys_per_block;
+
+  using local_map_type = cuco::block_local_map<Key, Value, 2 * keys_per_block>;
+
+  auto global_map =
+    cuco::static_map<Key, Value>{2 * num_keys, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  block_local_map_kernel<local_map_type>
+    <<<num_blocks, block_size>>>(global_map.ref(cuco::op::insert));
+  CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+  // keys are block-unique, so the flush inserts every partial aggregate exactly once
+  REQUIRE(global_map.size() == num_keys);
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+  thrust::device_vector<Value> d_values(num_keys);
+  global_map.find(d_keys.begin(), d_keys.end(), d_values.begin());
+
+  auto const counted = cuda::proclaim_return_type<bool>(
+    [expected_count] __device__(Value const& v) { return v == expected_count; });
+  REQUIRE(cuco::test::all_of(d_values.begin(), d_values.end(), counted));
+}
@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/block_local_set.cuh>
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+
+#include <cooperative_groups.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+static constexpr std::size_t num_blocks = 128;
+static constexpr std::size_t block_size = 128;
+
+template <typename LocalSet, typename GlobalRef>
+__global__ void block_local_set_kernel(GlobalRef global_ref, bool* results)
+{
+  using Key = typename LocalSet::key_type;
+
+  __shared__ typename LocalSet::window_type windows[LocalSet::num_windows];
+
+  auto const block = cooperative_groups::this_thread_block();
+  auto set         = LocalSet{block, windows, cuco::empty_key<Key>{-1}};
+
+  // each thread inserts a block-unique key, once redundantly to exercise deduplication
+  Key const key = blockIdx.x * blockDim.x + block.thread_rank();
+  set.insert(key);
+  set.insert(key);
+  block.sync();
+
+  auto const missing = static_cast<Key>(num_blocks * block_size) + key;
+  results[key]       = set.contains(key) and not set.contains(missing);
+
+  // spill the deduplicated block content into the global set
+  set.flush(block, global_ref);
+}
+
+TEMPLATE_TEST_CASE_SIG("Block-local set", "", ((typename Key), Key), (int32_t), (int64_t))
+{
+  constexpr std::size_t num_keys = num_blocks * block_size;
+
+  using local_set_type = cuco::block_local_set<Key, 2 * block_size>;
+
+  auto global_set = cuco::static_set<Key>{2 * num_keys, cuco::empty_key<Key>{-1}};
+
+  thrust::device_vector<bool> d_results(num_keys, false);
+
+  block_local_set_kernel<local_set_type>
+    <<<num_blocks, block_size>>>(global_set.ref(cuco::op::insert), d_results.data().get());
+  CUCO_CUDA_TRY(cudaDeviceSynchronize());
+
+  // every thread found its own key and not the missing one in the block-local set
+  REQUIRE(cuco::test::all_of(d_results.begin(), d_results.end(), thrust::identity{}));
+
+  // the flush propagated every key exactly once
+  REQUIRE(global_set.size() == num_keys);
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+  thrust::device_vector<bool> d_contained(num_keys);
+  global_set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+  REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/distinct_count_estimator.cuh>
+#include <cuco/distinct_count_estimator_array.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+TEMPLATE_TEST_CASE("distinct_count_estimator: bulk sketch merge", "", int32_t, int64_t)
+{
+  constexpr std::size_t num_sketches{1'000};
+  constexpr std::size_t num_items{100'000};
+  auto const sketch_size = cuco::sketch_size_kb(1);
+
+  // one sketch per ingest batch; batch assignment is round-robin so every sketch sees a subset of
+  // the input
+  cuco::distinct_count_estimator_array<TestType> batches{num_sketches, sketch_size};
+
+  thrust::device_vector<TestType> items(num_items);
+  thrust::sequence(items.begin(), items.end(), 0);
+
+  auto const num_sketches_copy = num_sketches;
+  auto groups_begin            = thrust::make_transform_iterator(
+    thrust::counting_iterator<std::size_t>{0},
+    cuda::proclaim_return_type<std::size_t>(
+      [num_sketches_copy] __device__(std::size_t i) { return i % num_sketches_copy; }));
+  batches.add(items.begin(), items.end(), groups_begin);
+
+  // rolling up all per-batch sketches must yield the same sketch as adding all items to a single
+  // estimator
+  cuco::distinct_count_estimator<TestType> rollup{sketch_size};
+  rollup.merge_many(batches.sketches());
+
+  cuco::distinct_count_estimator<TestType> reference{sketch_size};
+  reference.add(items.begin(), items.end());
+
+  auto const rollup_sketch    = rollup.sketch();
+  auto const reference_sketch = reference.sketch();
+  REQUIRE(rollup_sketch.size() == reference_sketch.size());
+
+  std::vector<std::byte> h_rollup(rollup_sketch.size());
+  std::vector<std::byte> h_reference(reference_sketch.size());
+  CUCO_CUDA_TRY(
+    cudaMemcpy(h_rollup.data(), rollup_sketch.data(), rollup_sketch.size(), cudaMemcpyDefault));
+  CUCO_CUDA_TRY(cudaMemcpy(
+    h_reference.data(), reference_sketch.data(), reference_sketch.size(), cudaMemcpyDefault));
+  REQUIRE(h_rollup == h_reference);
+
+  REQUIRE(rollup.estimate() == reference.estimate());
+
+  SECTION("mismatched sketch storage size is rejected")
+  {
+    auto const all_sketches = batches.sketches();
+    REQUIRE_THROWS(rollup.merge_many(all_sketches.subspan(0, all_sketches.size() - 1)));
+  }
+
+  SECTION("merging into a non-empty estimator accumulates")
+  {
+    // the roll-up already contains all items; merging the batches again must not change it
+    rollup.merge_many(batches.sketches());
+    REQUIRE(rollup.estimate() == reference.estimate());
+  }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/distinct_count_estimator.cuh>
+#include <cuco/distinct_count_estimator_array.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+TEMPLATE_TEST_CASE("distinct_count_estimator_array: grouped distinct counts",
+                   "",
+                   int32_t,
+                   int64_t)
+{
+  constexpr std::size_t num_groups{50};
+  constexpr std::size_t num_items{100'000};
+  auto const sketch_size = cuco::sketch_size_kb(1);
+
+  cuco::distinct_count_estimator_array<TestType> estimators{num_groups, sketch_size};
+
+  REQUIRE(estimators.num_sketches() == num_groups);
+
+  // round-robin group assignment, i.e., each group receives `num_items / num_groups` distinct
+  // items
+  thrust::device_vector<TestType> items(num_items);
+  thrust::sequence(items.begin(), items.end(), 0);
+
+  auto const num_groups_copy = num_groups;
+  auto groups_begin          = thrust::make_transform_iterator(
+    thrust::counting_iterator<std::size_t>{0},
+    cuda::proclaim_return_type<std::size_t>(
+      [num_groups_copy] __device__(std::size_t i) { return i % num_groups_copy; }));
+
+  estimators.add(items.begin(), items.end(), groups_begin);
+
+  thrust::device_vector<std::size_t> d_estimates(num_groups);
+  estimators.estimate(thrust::raw_pointer_cast(d_estimates.data()));
+  std::vector<std::size_t> h_estimates(num_groups);
+  thrust::copy(d_estimates.begin(), d_estimates.end(), h_estimates.begin());
+
+  SECTION("per-group estimates are within the expected error bound")
+  {
+    // This factor determines the error threshold for passing the test
+    double constexpr tolerance_factor = 2.5;
+    double const relative_standard_deviation =
+      1.04 / std::sqrt(static_cast<double>(estimators.sketch_bytes() / 4));
+
+    auto const items_per_group = num_items / num_groups;
+    for (std::size_t group = 0; group < num_groups; ++group) {
+      double const relative_error = std::abs(
+        (static_cast<double>(h_estimates[group]) / static_cast<double>(items_per_group)) - 1.0);
+      REQUIRE(relative_error < tolerance_factor * relative_standard_deviation);
+    }
+  }
+
+  SECTION("batched sketch matches a single-sketch estimator")
+  {
+    // feed a single estimator with exactly the items assigned to group 0
+    cuco::distinct_count_estimator<TestType> reference{sketch_size};
+    auto group0_begin = thrust::make_transform_iterator(
+      thrust::counting_iterator<std::size_t>{0},
+      cuda::proclaim_return_type<TestType>([num_groups_copy] __device__(std::size_t i) {
+        return static_cast<TestType>(i * num_groups_copy);
+      }));
+    reference.add(group0_begin, group0_begin + num_items / num_groups);
+
+    // register contents must be identical since both paths apply the same hash and register
+    // update
+    auto const batched_sketch   = estimators.ref(0).sketch();
+    auto const reference_sketch = reference.sketch();
+    REQUIRE(batched_sketch.size() == reference_sketch.size());
+
+    std::vector<std::byte> h_batched(batched_sketch.size());
+    std::vector<std::byte> h_reference(reference_sketch.size());
+    CUCO_CUDA_TRY(cudaMemcpy(
+      h_batched.data(), batched_sketch.data(), batched_sketch.size(), cudaMemcpyDefault));
+    CUCO_CUDA_TRY(cudaMemcpy(
+      h_reference.data(), reference_sketch.data(), reference_sketch.size(), cudaMemcpyDefault));
+    REQUIRE(h_batched == h_reference);
+  }
+
+  SECTION("clear resets all sketches")
+  {
+    estimators.clear();
+    estimators.estimate(thrust::raw_pointer_cast(d_estimates.data()));
+    REQUIRE(cuco::test::all_of(d_estimates.begin(),
+                               d_estimates.end(),
+                               cuda::proclaim_return_type<bool>(
+                                 [] __device__(std::size_t const& estimate) {
+                                   return estimate == 0;
+                                 })));
+  }
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/distinct_count_estimator.cuh>
+#include <cuco/sparse_distinct_count_estimator.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+TEMPLATE_TEST_CASE("sparse_distinct_count_estimator: sparse-to-dense promotion",
+                   "",
+                   int32_t,
+                   int64_t)
+{
+  using estimator_type = cuco::sparse_distinct_count_estimator<TestType>;
+  using reference_type = cuco::distinct_count_estimator<TestType>;
+
+  auto const sketch_size = cuco::sketch_size_kb(8);
+  constexpr std::size_t sparse_capacity{256};
+
+  estimator_type estimator{sketch_size, sparse_capacity};
+  reference_type reference{sketch_size};
+
+  REQUIRE(estimator.is_sparse());
+  REQUIRE(estimator.sparse_capacity() == sparse_capacity);
+  REQUIRE(estimator.sketch_bytes() < estimator.dense_sketch_bytes());
+  REQUIRE(estimator.estimate() == 0);
+
+  thrust::device_vector<TestType> items(10'000);
+  thrust::sequence(items.begin(), items.end(), 0);
+
+  SECTION("sparse estimates match the dense representation")
+  {
+    auto const num_small = sparse_capacity / 2;
+    estimator.add(items.begin(), items.begin() + num_small);
+    reference.add(items.begin(), items.begin() + num_small);
+
+    REQUIRE(estimator.is_sparse());
+    REQUIRE(estimator.estimate() == reference.estimate());
+  }
+
+  SECTION("overflowing the sparse buffer promotes to dense")
+  {
+    estimator.add(items.begin(), items.end());
+    reference.add(items.begin(), items.end());
+
+    REQUIRE(not estimator.is_sparse());
+    REQUIRE(estimator.sketch_bytes() == estimator.dense_sketch_bytes());
+    REQUIRE(estimator.estimate() == reference.estimate());
+
+    // clearing returns the estimator to sparse mode
+    estimator.clear();
+    REQUIRE(estimator.is_sparse());
+    REQUIRE(estimator.estimate() == 0);
+  }
+
+  SECTION("merging two sparse estimators stays sparse if the content fits")
+  {
+    estimator_type other{sketch_size, sparse_capacity};
+
+    estimator.add(items.begin(), items.begin() + 100);
+    other.add(items.begin() + 50, items.begin() + 150);
+    reference.add(items.begin(), items.begin() + 150);
+
+    estimator.merge(other);
+    REQUIRE(estimator.is_sparse());
+    REQUIRE(estimator.estimate() == reference.estimate());
+  }
+
+  SECTION("merging beyond the sparse capacity promotes to dense")
+  {
+    estimator_type other{sketch_size, sparse_capacity};
+
+    estimator.add(items.begin(), items.begin() + sparse_capacity);
+    other.add(items.begin() + sparse_capacity, items.begin() + 2 * sparse_capacity);
+    reference.add(items.begin(), items.begin() + 2 * sparse_capacity);
+
+    estimator.merge(other);
+    REQUIRE(not estimator.is_sparse());
+    REQUIRE(estimator.estimate() == reference.estimate());
+  }
+}
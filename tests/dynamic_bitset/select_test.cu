@@ -16,7 +16,7 @@
 
 #include <test_utils.hpp>
 
-#include <cuco/detail/trie/dynamic_bitset/dynamic_bitset.cuh>
+#include <cuco/dynamic_bitset.cuh>
 
 #include <thrust/device_vector.h>
 #include <thrust/host_vector.h>
@@ -94,3 +94,55 @@ TEST_CASE("Select test", "")
     REQUIRE(num_matches == num_not_set);
   }
 }
+
+TEST_CASE("Sparse select test", "")
+{
+  using size_type = std::size_t;
+  constexpr size_type num_elements{100'000};
+  constexpr size_type gap{1'000};  // 0.1% density triggers the materialized select positions
+
+  // Check select on a sparse bitset
+  {
+    cuco::experimental::dynamic_bitset<> bv;
+    for (size_type i = 0; i < num_elements; i++) {
+      bv.push_back(i % gap == 0);
+    }
+    constexpr size_type num_set = num_elements / gap;
+
+    thrust::device_vector<size_type> keys(num_set);
+    thrust::sequence(keys.begin(), keys.end(), 0);
+
+    thrust::device_vector<size_type> d_selects(num_set);
+
+    bv.select(keys.begin(), keys.end(), d_selects.begin());
+
+    thrust::host_vector<size_type> h_selects = d_selects;
+
+    size_type num_matches = 0;
+    for (size_type i = 0; i < num_set; i++) {
+      num_matches += h_selects[i] == i * gap;
+    }
+    REQUIRE(num_matches == num_set);
+  }
+
+  // Check select_false on a mostly-set bitset
+  {
+    cuco::experimental::dynamic_bitset<> bv;
+    for (size_type i = 0; i < num_elements; i++) {
+      bv.push_back(i % gap != 0);
+    }
+    constexpr size_type num_not_set = num_elements / gap;
+
+    bv.build();
+    auto ref = bv.ref();
+    thrust::device_vector<size_type> device_result(num_not_set);
+    select_false_kernel<<<1, 1024>>>(ref, num_not_set, device_result.data());
+    thrust::host_vector<size_type> host_result = device_result;
+
+    size_type num_matches = 0;
+    for (size_type i = 0; i < num_not_set; i++) {
+      num_matches += host_result[i] == i * gap;
+    }
+    REQUIRE(num_matches == num_not_set);
+  }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/dynamic_map.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE_SIG("overflow tier",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  constexpr std::size_t num_keys         = 400'000;
+  constexpr std::size_t initial_capacity = 100'000;
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::device_vector<Value> d_values(num_keys);
+
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end(), 1);
+  thrust::sequence(thrust::device, d_values.begin(), d_values.end(), 1);
+
+  auto pairs_begin =
+    thrust::make_zip_iterator(thrust::make_tuple(d_keys.begin(), d_values.begin()));
+
+  SECTION("Growth spills to the overflow tier once the device capacity limit is reached")
+  {
+    cuco::dynamic_map<Key, Value> map{
+      initial_capacity, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+    map.set_device_capacity_limit(initial_capacity);
+
+    map.insert(pairs_begin, pairs_begin + num_keys);
+    REQUIRE(map.get_size() == num_keys);
+    REQUIRE(map.get_num_submaps() == 1);
+    REQUIRE(map.get_num_overflow_submaps() >= 1);
+    REQUIRE(map.get_overflow_size() > 0);
+    REQUIRE(map.get_size() - map.get_overflow_size() <= initial_capacity);
+
+    thrust::device_vector<Value> d_results(num_keys);
+    map.find(d_keys.begin(), d_keys.end(), d_results.begin());
+    REQUIRE(cuco::test::equal(
+      d_results.begin(), d_results.end(), d_values.begin(), thrust::equal_to<Value>{}));
+
+    thrust::device_vector<bool> d_contained(num_keys);
+    map.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Erase reaches keys in both tiers")
+  {
+    cuco::dynamic_map<Key, Value> map{initial_capacity,
+                                      cuco::empty_key<Key>{-1},
+                                      cuco::empty_value<Value>{-1},
+                                      cuco::erased_key<Key>{-2}};
+    map.set_device_capacity_limit(initial_capacity);
+
+    map.insert(pairs_begin, pairs_begin + num_keys);
+    REQUIRE(map.get_num_overflow_submaps() >= 1);
+
+    map.erase(d_keys.begin(), d_keys.begin() + num_keys / 2);
+    REQUIRE(map.get_size() == num_keys / 2);
+
+    thrust::device_vector<bool> d_contained(num_keys);
+    map.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::none_of(
+      d_contained.begin(), d_contained.begin() + num_keys / 2, thrust::identity{}));
+    REQUIRE(cuco::test::all_of(
+      d_contained.begin() + num_keys / 2, d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Promotion migrates overflow-resident entries back into device submaps")
+  {
+    cuco::dynamic_map<Key, Value> map{initial_capacity,
+                                      cuco::empty_key<Key>{-1},
+                                      cuco::empty_value<Value>{-1},
+                                      cuco::erased_key<Key>{-2}};
+    map.set_device_capacity_limit(initial_capacity);
+
+    map.insert(pairs_begin, pairs_begin + num_keys);
+    REQUIRE(map.get_num_overflow_submaps() >= 1);
+
+    // free up device capacity, then promote the remaining keys; the insertion order guarantees
+    // the second half of the keys resides in the overflow tier
+    map.erase(d_keys.begin(), d_keys.begin() + num_keys / 2);
+    auto const overflow_size_before = map.get_overflow_size();
+    REQUIRE(overflow_size_before > 0);
+
+    map.promote(d_keys.begin() + num_keys / 2, d_keys.end());
+    REQUIRE(map.get_size() == num_keys / 2);
+    REQUIRE(map.get_overflow_size() < overflow_size_before);
+
+    thrust::device_vector<Value> d_results(num_keys / 2);
+    map.find(d_keys.begin() + num_keys / 2, d_keys.end(), d_results.begin());
+    REQUIRE(cuco::test::equal(d_results.begin(),
+                              d_results.end(),
+                              d_values.begin() + num_keys / 2,
+                              thrust::equal_to<Value>{}));
+  }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/partitioned_map.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <vector>
+
+namespace {
+
+std::vector<int> test_devices()
+{
+  int device_count{};
+  CUCO_CUDA_TRY(cudaGetDeviceCount(&device_count));
+  if (device_count >= 2) { return {0, 1}; }
+  // a single physical device still exercises the partitioning and exchange logic by hosting two
+  // partitions
+  return {0, 0};
+}
+
+}  // namespace
+
+TEMPLATE_TEST_CASE_SIG("Partitioned map bulk operations",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  using map_type = cuco::partitioned_map<Key, Value>;
+
+  constexpr std::size_t num_keys{100'000};
+
+  map_type map{
+    test_devices(), num_keys * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  REQUIRE(map.num_partitions() == 2);
+  REQUIRE(map.capacity() >= num_keys * 2);
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+  auto pairs_begin      = thrust::make_transform_iterator(
+    keys_begin, cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(Key const& key) {
+      return cuco::pair<Key, Value>{key, static_cast<Value>(key * 2)};
+    }));
+
+  map.insert(pairs_begin, pairs_begin + num_keys);
+  REQUIRE(map.size() == num_keys);
+
+  SECTION("contains answers existing and non-existing queries")
+  {
+    thrust::device_vector<bool> d_contained(2 * num_keys);
+    map.contains(keys_begin, keys_begin + 2 * num_keys, d_contained.begin());
+
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.begin() + num_keys, thrust::identity{}));
+    REQUIRE(cuco::test::none_of(
+      d_contained.begin() + num_keys, d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("find retrieves payloads and sentinel for non-matches")
+  {
+    thrust::device_vector<Value> d_results(2 * num_keys);
+    map.find(keys_begin, keys_begin + 2 * num_keys, d_results.begin());
+
+    auto const num_matches = num_keys;
+    REQUIRE(cuco::test::equal(
+      keys_begin,
+      keys_begin + 2 * num_keys,
+      d_results.begin(),
+      cuda::proclaim_return_type<bool>(
+        [num_matches] __device__(Key const& key, Value const& value) {
+          if (static_cast<std::size_t>(key) < num_matches) {
+            return value == static_cast<Value>(key * 2);
+          }
+          return value == Value{-1};
+        })));
+  }
+
+  SECTION("clear empties all partitions")
+  {
+    map.clear();
+    REQUIRE(map.size() == 0);
+  }
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+template <typename Map>
+void test_evict_if(Map& map, size_type num_keys)
+{
+  using key_type    = typename Map::key_type;
+  using mapped_type = typename Map::mapped_type;
+
+  thrust::device_vector<bool> d_keys_exist(num_keys);
+
+  auto keys_begin = thrust::counting_iterator<key_type>(1);
+
+  // the mapped value doubles as the entry's ingest epoch
+  auto pairs_begin = thrust::make_transform_iterator(
+    keys_begin,
+    cuda::proclaim_return_type<cuco::pair<key_type, mapped_type>>([] __device__(key_type const& x) {
+      return cuco::pair<key_type, mapped_type>(x, static_cast<mapped_type>(x % 2));
+    }));
+
+  auto const is_expired = [] __device__(cuco::pair<key_type, mapped_type> const& slot) {
+    return slot.second == 0;
+  };
+
+  SECTION("Evicting expired entries leaves the rest untouched")
+  {
+    map.insert(pairs_begin, pairs_begin + num_keys);
+
+    auto const num_evicted = map.evict_if(is_expired);
+
+    REQUIRE(num_evicted == num_keys / 2);
+    REQUIRE(map.size() == num_keys - num_keys / 2);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_keys_exist.begin());
+
+    auto gold_begin = thrust::make_transform_iterator(
+      keys_begin,
+      cuda::proclaim_return_type<bool>([] __device__(key_type const& x) { return x % 2 == 1; }));
+    REQUIRE(cuco::test::equal(
+      d_keys_exist.begin(), d_keys_exist.end(), gold_begin, thrust::equal_to<bool>{}));
+  }
+
+  SECTION("Evicted slots are reusable by subsequent insertions")
+  {
+    map.insert(pairs_begin, pairs_begin + num_keys);
+    map.evict_if_async(is_expired);
+    map.insert(pairs_begin, pairs_begin + num_keys);
+
+    REQUIRE(map.size() == num_keys);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_keys_exist.begin());
+    REQUIRE(cuco::test::all_of(d_keys_exist.begin(), d_keys_exist.end(), thrust::identity{}));
+  }
+
+  SECTION("Incremental sweeps eventually reclaim all expired entries")
+  {
+    map.insert(pairs_begin, pairs_begin + num_keys);
+
+    auto const num_windows = map.capacity() / Map::window_size;
+    auto const chunk       = std::max<size_type>(1, num_windows / 10);
+    // one full wrap-around of the sweep cursor visits every window exactly once
+    for (size_type swept = 0; swept < num_windows; swept += chunk) {
+      map.sweep_evict_async(is_expired, chunk);
+    }
+
+    REQUIRE(map.size() == num_keys - num_keys / 2);
+
+    map.contains(keys_begin, keys_begin + num_keys, d_keys_exist.begin());
+
+    auto gold_begin = thrust::make_transform_iterator(
+      keys_begin,
+      cuda::proclaim_return_type<bool>([] __device__(key_type const& x) { return x % 2 == 1; }));
+    REQUIRE(cuco::test::equal(
+      d_keys_exist.begin(), d_keys_exist.end(), gold_begin, thrust::equal_to<bool>{}));
+  }
+
+  SECTION("Eviction keeps the counted size consistent")
+  {
+    map.enable_counted_size();
+    map.insert(pairs_begin, pairs_begin + num_keys);
+
+    auto const num_evicted = map.evict_if(is_expired);
+
+    REQUIRE(num_evicted == num_keys / 2);
+    REQUIRE(map.size() == num_keys - num_keys / 2);
+    map.disable_counted_size();
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_map evict_if tests",
+  "",
+  ((typename Key, typename Value, cuco::test::probe_sequence Probe, int CGSize),
+   Key,
+   Value,
+   Probe,
+   CGSize),
+  (int32_t, int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, int64_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, int64_t, cuco::test::probe_sequence::linear_probing, 1))
+{
+  constexpr size_type num_keys{100'000};
+  using probe = std::conditional_t<
+    Probe == cuco::test::probe_sequence::linear_probing,
+    cuco::linear_probing<CGSize, cuco::murmurhash3_32<Key>>,
+    cuco::double_hashing<CGSize, cuco::murmurhash3_32<Key>, cuco::murmurhash3_32<Key>>>;
+
+  using map_type = cuco::static_map<Key,
+                                    Value,
+                                    cuco::extent<size_type>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    probe,
+                                    cuco::cuda_allocator<std::byte>,
+                                    cuco::storage<2>>;
+
+  auto map = map_type{num_keys * 2,
+                      cuco::empty_key<Key>{-1},
+                      cuco::empty_value<Value>{-1},
+                      cuco::erased_key<Key>{-2}};
+  test_evict_if(map, num_keys);
+}
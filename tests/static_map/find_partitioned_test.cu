@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = std::size_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_map find_partitioned tests",
+  "",
+  ((typename Key, typename Value, cuco::test::probe_sequence Probe, int CGSize),
+   Key,
+   Value,
+   Probe,
+   CGSize),
+  (int32_t, int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, int64_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int64_t, int64_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  using probe = std::conditional_t<
+    Probe == cuco::test::probe_sequence::linear_probing,
+    cuco::linear_probing<CGSize, cuco::murmurhash3_32<Key>>,
+    cuco::double_hashing<CGSize, cuco::murmurhash3_32<Key>, cuco::murmurhash3_32<Key>>>;
+
+  constexpr size_type num_keys{1000};
+
+  auto map = cuco::static_map<Key,
+                              Value,
+                              cuco::extent<size_type>,
+                              cuda::thread_scope_device,
+                              thrust::equal_to<Key>,
+                              probe,
+                              cuco::cuda_allocator<std::byte>,
+                              cuco::storage<2>>{
+    num_keys * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  // insert pairs {2i, 2i + 1}, so queries with even keys hit and odd keys miss
+  auto pairs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(auto i) {
+      return cuco::pair<Key, Value>{static_cast<Key>(i * 2), static_cast<Value>(i * 2 + 1)};
+    }));
+  map.insert(pairs_begin, pairs_begin + num_keys);
+
+  // query keys 0, 1, 2, ..., so key i matches iff i is even
+  auto keys_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<Key>([] __device__(auto i) { return static_cast<Key>(i); }));
+
+  constexpr size_type num_queries{2 * num_keys};
+  thrust::device_vector<cuco::pair<size_type, Value>> found(num_queries);
+  thrust::device_vector<size_type> missing(num_queries);
+
+  auto const num_found = map.find_partitioned(
+    keys_begin, keys_begin + num_queries, found.begin(), missing.begin());
+
+  REQUIRE(num_found == num_keys);
+
+  // outputs are compacted but unordered; sort by key index before validation
+  thrust::sort(found.begin(),
+               found.begin() + num_found,
+               [] __device__(auto const& lhs, auto const& rhs) { return lhs.first < rhs.first; });
+  thrust::sort(missing.begin(), missing.begin() + (num_queries - num_found));
+
+  thrust::host_vector<cuco::pair<size_type, Value>> h_found(found.begin(),
+                                                            found.begin() + num_found);
+  thrust::host_vector<size_type> h_missing(missing.begin(),
+                                           missing.begin() + (num_queries - num_found));
+
+  for (size_type i = 0; i < num_found; ++i) {
+    REQUIRE(h_found[i].first == i * 2);
+    REQUIRE(h_found[i].second == static_cast<Value>(i * 2 + 1));
+  }
+  for (size_type i = 0; i < num_queries - num_found; ++i) {
+    REQUIRE(h_missing[i] == i * 2 + 1);
+  }
+}
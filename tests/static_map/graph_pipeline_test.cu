@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/graph_pipeline.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE_SIG("Graph pipeline batched operations",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  using map_type  = cuco::static_map<Key, Value>;
+  using size_type = typename map_type::size_type;
+
+  constexpr size_type max_batch_size{1024};
+  constexpr std::size_t num_batches{4};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  map_type map{max_batch_size * num_batches * 2,
+               cuco::empty_key<Key>{-1},
+               cuco::empty_value<Value>{-1},
+               {},
+               {},
+               {},
+               {},
+               {},
+               stream};
+
+  thrust::device_vector<cuco::pair<Key, Value>> d_pairs(max_batch_size);
+  thrust::device_vector<Key> d_queries(max_batch_size);
+  thrust::device_vector<Value> d_results(max_batch_size);
+  thrust::device_vector<size_type> d_batch_size(1);
+
+  // Record the steady-state operation sequence once: insert a batch, then look it up
+  cuco::utility::graph_pipeline pipeline;
+  pipeline.record(
+    [&](cuda::stream_ref s) {
+      map.insert_bounded_async(
+        d_pairs.begin(), thrust::raw_pointer_cast(d_batch_size.data()), max_batch_size, s);
+      map.find_bounded_async(d_queries.begin(),
+                             thrust::raw_pointer_cast(d_batch_size.data()),
+                             max_batch_size,
+                             d_results.begin(),
+                             s);
+    },
+    stream);
+
+  REQUIRE(pipeline.recorded());
+
+  size_type num_inserted{0};
+  for (std::size_t batch = 0; batch < num_batches; ++batch) {
+    // Batches deliberately vary in size while the recorded graph stays fixed
+    auto const batch_size = static_cast<size_type>(max_batch_size / (batch + 1));
+
+    thrust::host_vector<cuco::pair<Key, Value>> h_pairs(batch_size);
+    thrust::host_vector<Key> h_queries(batch_size);
+    for (size_type i = 0; i < batch_size; ++i) {
+      auto const key = static_cast<Key>(num_inserted + i);
+      h_pairs[i]     = cuco::pair<Key, Value>{key, static_cast<Value>(key * 2)};
+      h_queries[i]   = key;
+    }
+    thrust::copy(h_pairs.begin(), h_pairs.end(), d_pairs.begin());
+    thrust::copy(h_queries.begin(), h_queries.end(), d_queries.begin());
+    d_batch_size[0] = batch_size;
+
+    pipeline.replay(stream);
+    CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+
+    num_inserted += batch_size;
+    REQUIRE(map.size(stream) == static_cast<std::size_t>(num_inserted));
+
+    thrust::host_vector<Value> h_results(d_results.begin(), d_results.begin() + batch_size);
+    for (size_type i = 0; i < batch_size; ++i) {
+      REQUIRE(h_results[i] == static_cast<Value>(h_queries[i] * 2));
+    }
+  }
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
@@ -114,6 +114,8 @@ void test_insert_or_apply_shmem(Map& map, size_type num_keys, size_type num_uniq
 
   cuda::stream_ref stream{};
 
+  using size_stripe_type = cuda::atomic<typename Map::size_type, Map::thread_scope>;
+
   // launch the shmem kernel
   cuco::static_map_ns::detail::
     insert_or_apply_shmem<HasInit, cg_size, shmem_block_size, shared_map_ref_type>
@@ -121,6 +123,8 @@ void test_insert_or_apply_shmem(Map& map, size_type num_keys, size_type num_uniq
                                                              num_keys,
                                                              init,
                                                              cuco::reduce::plus{},
+                                                             static_cast<size_stripe_type*>(nullptr),
+                                                             1,
                                                              map.ref(cuco::op::insert_or_apply),
                                                              window_extent);
 
@@ -238,6 +242,83 @@ TEMPLATE_TEST_CASE_SIG(
   }
 }
 
+template <bool HasInit, typename Map, typename Init>
+void test_insert_or_apply_shmem_flush(
+  Map& map, size_type num_keys, size_type num_unique_keys, size_type multiplicity, Init init)
+{
+  REQUIRE((num_keys % num_unique_keys) == 0);
+  REQUIRE((num_keys % (num_unique_keys * multiplicity)) == 0);
+
+  using Key   = typename Map::key_type;
+  using Value = typename Map::mapped_type;
+
+  using KeyEqual         = typename Map::key_equal;
+  using ProbingScheme    = typename Map::probing_scheme_type;
+  using Allocator        = typename Map::allocator_type;
+  auto constexpr cg_size = Map::cg_size;
+
+  int32_t constexpr shmem_block_size = 1024;
+
+  using shmem_size_type = int32_t;
+
+  shmem_size_type constexpr cardinality_threshold   = shmem_block_size;
+  shmem_size_type constexpr shared_map_num_elements = cardinality_threshold + shmem_block_size;
+  float constexpr load_factor                       = 0.7;
+  shmem_size_type constexpr shared_map_size =
+    static_cast<shmem_size_type>((1.0 / load_factor) * shared_map_num_elements);
+
+  using extent_type     = cuco::extent<shmem_size_type, shared_map_size>;
+  using shared_map_type = cuco::static_map<Key,
+                                           Value,
+                                           extent_type,
+                                           cuda::thread_scope_block,
+                                           KeyEqual,
+                                           ProbingScheme,
+                                           Allocator,
+                                           cuco::storage<1>>;
+
+  using shared_map_ref_type    = typename shared_map_type::ref_type<>;
+  auto constexpr window_extent = cuco::make_window_extent<shared_map_ref_type>(extent_type{});
+
+  // runs of `multiplicity` equal keys keep the per-epoch aggregation ratio high while the
+  // accumulated cardinality still exceeds the threshold, exercising the flush-and-continue path
+  auto pairs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<cuco::pair<Key, Value>>(
+      [num_unique_keys, multiplicity] __device__(auto i) {
+        return cuco::pair<Key, Value>{(i / multiplicity) % num_unique_keys, 1};
+      }));
+
+  // a deliberately small grid so that every block runs many epochs
+  int32_t constexpr shmem_grid_size = 4;
+
+  cuda::stream_ref stream{};
+
+  using size_stripe_type = cuda::atomic<typename Map::size_type, Map::thread_scope>;
+
+  cuco::static_map_ns::detail::
+    insert_or_apply_shmem<HasInit, cg_size, shmem_block_size, shared_map_ref_type>
+    <<<shmem_grid_size, shmem_block_size, 0, stream.get()>>>(pairs_begin,
+                                                             num_keys,
+                                                             init,
+                                                             cuco::reduce::plus{},
+                                                             static_cast<size_stripe_type*>(nullptr),
+                                                             1,
+                                                             map.ref(cuco::op::insert_or_apply),
+                                                             window_extent);
+
+  REQUIRE(map.size() == num_unique_keys);
+
+  thrust::device_vector<Key> d_keys(num_unique_keys);
+  thrust::device_vector<Value> d_values(num_unique_keys);
+  map.retrieve_all(d_keys.begin(), d_values.begin());
+
+  REQUIRE(cuco::test::equal(d_values.begin(),
+                            d_values.end(),
+                            thrust::make_constant_iterator<Value>(num_keys / num_unique_keys),
+                            thrust::equal_to<Value>{}));
+}
+
 TEMPLATE_TEST_CASE_SIG(
   "static_map insert_or_apply shared memory", "", ((typename Key)), (int32_t), (int64_t))
 {
@@ -269,4 +350,40 @@ TEMPLATE_TEST_CASE_SIG(
     auto map = map_type{num_keys, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{0}};
     test_insert_or_apply_shmem<true>(map, num_keys, num_unique_keys, static_cast<Value>(0));
   }
+
+  SECTION("skewed keys above cardinality threshold")
+  {
+    constexpr size_type num_keys        = 96'000;
+    constexpr size_type num_unique_keys = 1'200;
+    constexpr size_type multiplicity    = 8;
+
+    auto map = map_type{2 * num_unique_keys, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{0}};
+    test_insert_or_apply_shmem_flush<true>(
+      map, num_keys, num_unique_keys, multiplicity, static_cast<Value>(0));
+  }
+}
+
+TEST_CASE("static_map insert_or_apply, counted mode", "")
+{
+  constexpr size_type num_keys        = 10'000;
+  constexpr size_type num_unique_keys = 100;
+
+  cuco::static_map<int, int> map{num_unique_keys * 2, cuco::empty_key{-1}, cuco::empty_value{0}};
+
+  auto pairs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<cuco::pair<int, int>>([num_unique_keys] __device__(auto i) {
+      return cuco::pair<int, int>(i % num_unique_keys, 1);
+    }));
+
+  map.enable_counted_size();
+  REQUIRE(map.size() == 0);
+
+  // only the first occurrence of each key inserts; all subsequent ones apply
+  map.insert_or_apply(pairs_begin, pairs_begin + num_keys, cuco::reduce::plus{});
+  REQUIRE(map.size() == num_unique_keys);
+
+  // all keys are already present, so the size must not change
+  map.insert_or_apply(pairs_begin, pairs_begin + num_keys, cuco::reduce::plus{});
+  REQUIRE(map.size() == num_unique_keys);
 }
@@ -114,3 +114,28 @@ TEMPLATE_TEST_CASE_SIG(
 
   test_insert_or_assign(map, num_keys);
 }
+
+TEST_CASE("Insert or assign, counted mode", "")
+{
+  constexpr size_type num_keys{400};
+
+  cuco::static_map<int, int> map{num_keys * 2, cuco::empty_key{-1}, cuco::empty_value{-1}};
+
+  auto pairs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<cuco::pair<int, int>>(
+      [] __device__(auto i) { return cuco::pair<int, int>(i, i); }));
+
+  map.insert(pairs_begin, pairs_begin + num_keys / 2);
+
+  map.enable_counted_size();
+  REQUIRE(map.size() == num_keys / 2);
+
+  // half of the pairs assign existing keys, half insert new ones
+  map.insert_or_assign(pairs_begin, pairs_begin + num_keys);
+  REQUIRE(map.size() == num_keys);
+
+  // all pairs assign existing keys, so the size must not change
+  map.insert_or_assign(pairs_begin, pairs_begin + num_keys);
+  REQUIRE(map.size() == num_keys);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+TEMPLATE_TEST_CASE_SIG("Serialization round trip",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  using map_type = cuco::static_map<Key, Value>;
+
+  constexpr std::size_t num_keys{1'000};
+  constexpr std::size_t capacity{num_keys * 2};
+
+  auto const keys_begin = thrust::counting_iterator<Key>{0};
+  auto pairs_begin      = thrust::make_transform_iterator(
+    keys_begin, cuda::proclaim_return_type<cuco::pair<Key, Value>>([] __device__(Key const& key) {
+      return cuco::pair<Key, Value>{key, static_cast<Value>(key * 2)};
+    }));
+
+  map_type map{
+    capacity, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}, cuco::erased_key<Key>{-2}};
+  map.insert(pairs_begin, pairs_begin + num_keys);
+  map.erase(keys_begin, keys_begin + num_keys / 10);
+  auto const expected_size = map.size();
+
+  auto const verify = [&](map_type const& restored) {
+    REQUIRE(restored.size() == expected_size);
+
+    thrust::device_vector<Value> d_results(num_keys);
+    restored.find(keys_begin, keys_begin + num_keys, d_results.begin());
+
+    auto const num_erased = num_keys / 10;
+    REQUIRE(cuco::test::equal(
+      keys_begin,
+      keys_begin + num_keys,
+      d_results.begin(),
+      cuda::proclaim_return_type<bool>([num_erased] __device__(Key const& key, Value const& value) {
+        if (static_cast<std::size_t>(key) < num_erased) { return value == Value{-1}; }
+        return value == static_cast<Value>(key * 2);
+      })));
+  };
+
+  SECTION("Restoring from a device buffer recreates the map")
+  {
+    thrust::device_vector<std::byte> d_buffer(map.serialized_size());
+    map.serialize(thrust::raw_pointer_cast(d_buffer.data()));
+
+    map_type restored{thrust::raw_pointer_cast(d_buffer.data()),
+                      capacity,
+                      cuco::empty_key<Key>{-1},
+                      cuco::empty_value<Value>{-1},
+                      cuco::erased_key<Key>{-2}};
+    verify(restored);
+  }
+
+  SECTION("Restoring from a host buffer recreates the map")
+  {
+    std::vector<std::byte> h_buffer(map.serialized_size());
+    map.serialize(h_buffer.data());
+
+    map_type restored{h_buffer.data(),
+                      capacity,
+                      cuco::empty_key<Key>{-1},
+                      cuco::empty_value<Value>{-1},
+                      cuco::erased_key<Key>{-2}};
+    verify(restored);
+  }
+
+  SECTION("Restoring with a mismatched capacity is rejected")
+  {
+    std::vector<std::byte> h_buffer(map.serialized_size());
+    map.serialize(h_buffer.data());
+
+    REQUIRE_THROWS(map_type{h_buffer.data(),
+                            capacity * 2,
+                            cuco::empty_key<Key>{-1},
+                            cuco::empty_value<Value>{-1},
+                            cuco::erased_key<Key>{-2}});
+  }
+}
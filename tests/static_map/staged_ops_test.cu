@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <vector>
+
+TEMPLATE_TEST_CASE_SIG("Staged host-range bulk operations",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  using map_type  = cuco::static_map<Key, Value>;
+  using size_type = typename map_type::size_type;
+
+  // deliberately not a multiple of the chunk size to exercise the partial tail chunk
+  constexpr std::size_t num_keys{10'007};
+  constexpr size_type chunk_size{1'000};
+
+  map_type map{num_keys * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  std::vector<cuco::pair<Key, Value>> h_pairs(num_keys);
+  std::vector<Key> h_queries(2 * num_keys);
+  for (std::size_t i = 0; i < num_keys; ++i) {
+    auto const key           = static_cast<Key>(i);
+    h_pairs[i]               = cuco::pair<Key, Value>{key, static_cast<Value>(key * 2)};
+    h_queries[i]             = key;
+    h_queries[num_keys + i]  = static_cast<Key>(num_keys + i);  // not inserted
+  }
+
+  map.insert_staged(h_pairs.begin(), h_pairs.end(), chunk_size);
+  REQUIRE(map.size() == num_keys);
+
+  SECTION("contains_staged answers existing and non-existing host queries")
+  {
+    std::vector<char> h_contained(h_queries.size());
+    map.contains_staged(h_queries.begin(), h_queries.end(), h_contained.begin(), chunk_size);
+
+    for (std::size_t i = 0; i < h_queries.size(); ++i) {
+      REQUIRE(static_cast<bool>(h_contained[i]) == (i < num_keys));
+    }
+  }
+
+  SECTION("find_staged retrieves payloads into a host range")
+  {
+    std::vector<Value> h_results(h_queries.size());
+    map.find_staged(h_queries.begin(), h_queries.end(), h_results.begin(), chunk_size);
+
+    for (std::size_t i = 0; i < h_queries.size(); ++i) {
+      auto const expected =
+        i < num_keys ? static_cast<Value>(h_queries[i] * 2) : map.empty_value_sentinel();
+      REQUIRE(h_results[i] == expected);
+    }
+  }
+
+  SECTION("single partial chunk works")
+  {
+    std::vector<char> h_contained(h_queries.size());
+    map.contains_staged(h_queries.begin(),
+                        h_queries.begin() + chunk_size / 2,
+                        h_contained.begin(),
+                        chunk_size);
+    for (std::size_t i = 0; i < static_cast<std::size_t>(chunk_size / 2); ++i) {
+      REQUIRE(static_cast<bool>(h_contained[i]));
+    }
+  }
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/streaming_insert_queue.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+TEMPLATE_TEST_CASE_SIG("Streaming insert queue",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  using probe_type = cuco::double_hashing<1, cuco::default_hash_function<Key>>;
+  using map_type   = cuco::static_map<Key,
+                                    Value,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    probe_type>;
+  using pair_type  = cuco::pair<Key, Value>;
+
+  constexpr std::size_t num_keys{10'000};
+  constexpr std::size_t batch_size{100};
+  constexpr std::size_t queue_capacity{1024};
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  map_type map{num_keys * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  std::uint64_t ticket{0};
+  {
+    cuco::utility::streaming_insert_queue queue{map.ref(cuco::op::insert), queue_capacity, stream};
+
+    thrust::host_vector<pair_type> h_batch(batch_size);
+    for (std::size_t offset = 0; offset < num_keys; offset += batch_size) {
+      for (std::size_t i = 0; i < batch_size; ++i) {
+        auto const key = static_cast<Key>(offset + i);
+        h_batch[i]     = pair_type{key, static_cast<Value>(key * 2)};
+      }
+      ticket = queue.push(h_batch.data(), batch_size);
+    }
+
+    queue.wait(ticket);
+    REQUIRE(queue.completed() == num_keys);
+  }  // queue destructor shuts the persistent kernel down
+
+  CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+  REQUIRE(map.size() == num_keys);
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::device_vector<Value> d_results(num_keys);
+  thrust::copy(thrust::counting_iterator<Key>{0},
+               thrust::counting_iterator<Key>{static_cast<Key>(num_keys)},
+               d_keys.begin());
+  map.find(d_keys.begin(), d_keys.end(), d_results.begin());
+
+  REQUIRE(cuco::test::equal(
+    d_keys.begin(),
+    d_keys.end(),
+    d_results.begin(),
+    cuda::proclaim_return_type<bool>([] __device__(Key const& key, Value const& value) {
+      return value == static_cast<Value>(key * 2);
+    })));
+
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <limits>
+
+using size_type = std::size_t;
+
+template <typename Map>
+void test_transform_reduce(Map& map, size_type num_keys)
+{
+  using Key   = typename Map::key_type;
+  using Value = typename Map::mapped_type;
+
+  // Insert pairs with payload i + 1 so the expected sum is known in closed form
+  auto pairs_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<cuco::pair<Key, Value>>(
+      [] __device__(auto i) { return cuco::pair<Key, Value>{i, i + 1}; }));
+
+  cuda::stream_ref stream{};
+
+  map.insert(pairs_begin, pairs_begin + num_keys, stream);
+
+  thrust::device_vector<int64_t> d_result(1);
+
+  // Sum of all payloads
+  map.transform_reduce_async(
+    d_result.data().get(),
+    cuda::proclaim_return_type<int64_t>([] __device__(auto const slot) {
+      return static_cast<int64_t>(slot.second);
+    }),
+    int64_t{0},
+    thrust::plus<int64_t>{},
+    stream);
+  stream.wait();
+  REQUIRE(d_result[0] == static_cast<int64_t>(num_keys * (num_keys + 1) / 2));
+
+  // Maximum key
+  map.transform_reduce_async(
+    d_result.data().get(),
+    cuda::proclaim_return_type<int64_t>(
+      [] __device__(auto const slot) { return static_cast<int64_t>(slot.first); }),
+    std::numeric_limits<int64_t>::min(),
+    thrust::maximum<int64_t>{},
+    stream);
+  stream.wait();
+  REQUIRE(d_result[0] == static_cast<int64_t>(num_keys - 1));
+
+  // Erased slots must not contribute to the reduction
+  auto keys_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<Key>([] __device__(auto i) { return static_cast<Key>(2 * i); }));
+  map.erase(keys_begin, keys_begin + num_keys / 2, stream);
+
+  map.transform_reduce_async(
+    d_result.data().get(),
+    cuda::proclaim_return_type<int64_t>([] __device__(auto const slot) {
+      return static_cast<int64_t>(slot.second);
+    }),
+    int64_t{0},
+    thrust::plus<int64_t>{},
+    stream);
+  stream.wait();
+
+  int64_t expected = 0;
+  for (size_type i = 1; i < num_keys; i += 2) {
+    expected += static_cast<int64_t>(i + 1);
+  }
+  REQUIRE(d_result[0] == expected);
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_map transform_reduce tests",
+  "",
+  ((typename Key, typename Value, cuco::test::probe_sequence Probe, int CGSize),
+   Key,
+   Value,
+   Probe,
+   CGSize),
+  (int32_t, int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, int64_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, int64_t, cuco::test::probe_sequence::linear_probing, 1))
+{
+  constexpr size_type num_keys{1'000};
+  using probe = std::conditional_t<
+    Probe == cuco::test::probe_sequence::linear_probing,
+    cuco::linear_probing<CGSize, cuco::murmurhash3_32<Key>>,
+    cuco::double_hashing<CGSize, cuco::murmurhash3_32<Key>, cuco::murmurhash3_32<Key>>>;
+
+  using map_type = cuco::static_map<Key,
+                                    Value,
+                                    cuco::extent<size_type>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    probe,
+                                    cuco::cuda_allocator<std::byte>,
+                                    cuco::storage<2>>;
+
+  auto map = map_type{2 * num_keys,
+                      cuco::empty_key<Key>{-1},
+                      cuco::empty_value<Value>{0},
+                      cuco::erased_key<Key>{-2}};
+  test_transform_reduce(map, num_keys);
+}
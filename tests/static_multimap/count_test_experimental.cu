@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_multimap.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE_SIG("experimental::static_multimap count and size",
+                       "",
+                       ((typename Key, typename Value), Key, Value),
+                       (int32_t, int32_t),
+                       (int64_t, int64_t))
+{
+  constexpr std::size_t num_keys{400};
+  constexpr std::size_t multiplicity{2};
+
+  cuco::experimental::static_multimap<Key, Value> map{
+    num_keys * multiplicity * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+
+  auto const pair_begin = thrust::make_transform_iterator(
+    thrust::counting_iterator<std::size_t>{0}, [] __device__(auto i) {
+      return cuco::pair<Key, Value>{static_cast<Key>(i / multiplicity), static_cast<Value>(i)};
+    });
+
+  map.insert(pair_begin, pair_begin + num_keys * multiplicity);
+
+  REQUIRE(map.size() == num_keys * multiplicity);
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(d_keys.begin(), d_keys.end());
+
+  SECTION("Count of each inserted key equals its multiplicity.")
+  {
+    REQUIRE(map.count(d_keys.begin(), d_keys.end()) == num_keys * multiplicity);
+  }
+
+  SECTION("Outer count of non-matching keys is one per key.")
+  {
+    thrust::device_vector<Key> d_missing(num_keys);
+    thrust::sequence(d_missing.begin(), d_missing.end(), static_cast<Key>(num_keys));
+
+    REQUIRE(map.count(d_missing.begin(), d_missing.end()) == 0);
+    REQUIRE(map.count_outer(d_missing.begin(), d_missing.end()) == num_keys);
+  }
+
+  SECTION("Size is preserved across rehash.")
+  {
+    map.rehash();
+    REQUIRE(map.size() == num_keys * multiplicity);
+
+    map.rehash(num_keys * multiplicity * 4);
+    REQUIRE(map.size() == num_keys * multiplicity);
+    REQUIRE(map.count(d_keys.begin(), d_keys.end()) == num_keys * multiplicity);
+  }
+}
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_multimap.cuh>
+
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/fill.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <limits>
+
+template <typename Map>
+void test_inner_join(Map& map, std::size_t num_items)
+{
+  using Key         = typename Map::key_type;
+  using Value       = typename Map::mapped_type;
+  using joined_type = cuco::pair<std::size_t, Value>;
+
+  auto const num_keys = num_items / 2;
+
+  // build side: each key `i` in [0, num_items / 2) carries the two payloads `2i` and `2i + 1`
+  thrust::device_vector<cuco::pair<Key, Value>> d_pairs(num_items);
+  thrust::transform(thrust::device,
+                    thrust::counting_iterator<int>(0),
+                    thrust::counting_iterator<int>(num_items),
+                    d_pairs.begin(),
+                    [] __device__(auto i) { return cuco::pair<Key, Value>{i / 2, i}; });
+  map.insert(d_pairs.begin(), d_pairs.begin() + num_items);
+
+  // probe side: all build keys, so every probe index has exactly two matches
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  // a joined pair is valid iff the payload was inserted under the probed key
+  auto const valid_pair = cuda::proclaim_return_type<bool>([] __device__(joined_type const& p) {
+    return static_cast<std::size_t>(p.second / 2) == p.first;
+  });
+
+  SECTION("Output sized to the match count receives all joined pairs.")
+  {
+    thrust::device_vector<joined_type> d_results(num_items);
+
+    auto const num_matches =
+      map.inner_join(d_keys.begin(), d_keys.end(), d_results.begin(), d_results.size());
+    REQUIRE(num_matches == num_items);
+
+    // sort before compare: matches are written in unspecified order
+    thrust::sort(thrust::device,
+                 d_results.begin(),
+                 d_results.end(),
+                 [] __device__(joined_type const& lhs, joined_type const& rhs) {
+                   if (lhs.first != rhs.first) { return lhs.first < rhs.first; }
+                   return lhs.second < rhs.second;
+                 });
+
+    REQUIRE(cuco::test::equal(d_results.begin(),
+                              d_results.end(),
+                              d_pairs.begin(),
+                              [] __device__(joined_type lhs, cuco::pair<Key, Value> rhs) {
+                                return static_cast<Key>(lhs.first) == rhs.first and
+                                       lhs.second == rhs.second;
+                              }));
+  }
+
+  SECTION("Truncated output still reports the total match count.")
+  {
+    auto const capacity = num_items / 4;
+    thrust::device_vector<joined_type> d_results(
+      capacity, cuco::pair{std::numeric_limits<std::size_t>::max(), Value{-1}});
+
+    auto const num_matches =
+      map.inner_join(d_keys.begin(), d_keys.end(), d_results.begin(), capacity);
+    REQUIRE(num_matches == num_items);
+
+    // every slot of the capacity-limited output must hold a valid joined pair
+    REQUIRE(cuco::test::all_of(d_results.begin(), d_results.end(), valid_pair));
+  }
+
+  SECTION("Zero capacity only counts the matches.")
+  {
+    thrust::device_vector<joined_type> d_results(1);
+
+    auto const num_matches = map.inner_join(d_keys.begin(), d_keys.end(), d_results.begin(), 0);
+    REQUIRE(num_matches == num_items);
+  }
+
+  SECTION("Probing non-inserted keys yields no matches.")
+  {
+    thrust::device_vector<Key> d_missing(num_keys);
+    thrust::sequence(
+      thrust::device, d_missing.begin(), d_missing.end(), static_cast<Key>(num_items));
+
+    thrust::device_vector<joined_type> d_results(num_items);
+    auto const num_matches =
+      map.inner_join(d_missing.begin(), d_missing.end(), d_results.begin(), d_results.size());
+    REQUIRE(num_matches == 0);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "Single-pass inner join",
+  "",
+  ((typename Key, typename Value, cuco::test::probe_sequence Probe), Key, Value, Probe),
+  (int32_t, int32_t, cuco::test::probe_sequence::linear_probing),
+  (int32_t, int64_t, cuco::test::probe_sequence::linear_probing),
+  (int64_t, int64_t, cuco::test::probe_sequence::linear_probing),
+  (int32_t, int32_t, cuco::test::probe_sequence::double_hashing),
+  (int32_t, int64_t, cuco::test::probe_sequence::double_hashing),
+  (int64_t, int64_t, cuco::test::probe_sequence::double_hashing))
+{
+  constexpr std::size_t num_items{1'000};
+
+  using probe =
+    std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                       cuco::legacy::linear_probing<1, cuco::default_hash_function<Key>>,
+                       cuco::legacy::double_hashing<8, cuco::default_hash_function<Key>>>;
+
+  cuco::static_multimap<Key, Value, cuda::thread_scope_device, cuco::cuda_allocator<char>, probe>
+    map{num_items * 2, cuco::empty_key<Key>{-1}, cuco::empty_value<Value>{-1}};
+  test_inner_join(map, num_items);
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_multiset.cuh>
+
+#include <cuda/functional>
+#include <thrust/count.h>
+#include <thrust/device_vector.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+static constexpr int key_sentinel = -1;
+
+template <typename Set>
+void test_multiplicity(Set& set, size_type num_unique_keys, size_type multiplicity)
+{
+  using Key = typename Set::key_type;
+
+  auto const num_entries = num_unique_keys * multiplicity;
+  auto const query_begin = thrust::counting_iterator<Key>{0};
+
+  thrust::device_vector<Key> probe_keys(num_entries + num_unique_keys);
+  thrust::device_vector<Key> matched_keys(num_entries + num_unique_keys);
+
+  SECTION("Retrieve from an empty multiset is empty.")
+  {
+    auto const [probe_end, matched_end] = set.retrieve(
+      query_begin, query_begin + num_unique_keys, probe_keys.begin(), matched_keys.begin());
+    REQUIRE(thrust::distance(probe_keys.begin(), probe_end) == 0);
+    REQUIRE(thrust::distance(matched_keys.begin(), matched_end) == 0);
+  }
+
+  auto const keys_begin = thrust::make_transform_iterator(
+    thrust::make_counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<Key>(
+      [multiplicity] __device__(auto i) { return Key{i / multiplicity}; }));
+  set.insert(keys_begin, keys_begin + num_entries);
+
+  SECTION("Each key retrieves all of its copies.")
+  {
+    auto const [probe_end, matched_end] = set.retrieve(
+      query_begin, query_begin + num_unique_keys, probe_keys.begin(), matched_keys.begin());
+    REQUIRE(thrust::distance(probe_keys.begin(), probe_end) == num_entries);
+    REQUIRE(thrust::distance(matched_keys.begin(), matched_end) == num_entries);
+
+    // every match must equal its probe key
+    REQUIRE(cuco::test::equal(
+      probe_keys.begin(), probe_end, matched_keys.begin(), thrust::equal_to<Key>{}));
+
+    thrust::sort(probe_keys.begin(), probe_end);
+    auto const expected_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      cuda::proclaim_return_type<Key>(
+        [multiplicity] __device__(auto i) { return Key{i / multiplicity}; }));
+    REQUIRE(
+      cuco::test::equal(probe_keys.begin(), probe_end, expected_begin, thrust::equal_to<Key>{}));
+  }
+
+  SECTION("Non-matching probe keys emit sentinel pairs in the outer variant.")
+  {
+    // the second half of the probe range has no matches in the multiset
+    auto const [probe_end, matched_end] = set.retrieve_outer(
+      query_begin, query_begin + 2 * num_unique_keys, probe_keys.begin(), matched_keys.begin());
+    REQUIRE(thrust::distance(probe_keys.begin(), probe_end) == num_entries + num_unique_keys);
+    REQUIRE(thrust::distance(matched_keys.begin(), matched_end) == num_entries + num_unique_keys);
+
+    auto const num_sentinels =
+      thrust::count(matched_keys.begin(), matched_end, Key{key_sentinel});
+    REQUIRE(num_sentinels == num_unique_keys);
+
+    thrust::sort(probe_keys.begin(), probe_end);
+    auto const expected_begin = thrust::make_transform_iterator(
+      thrust::make_counting_iterator<size_type>(0),
+      cuda::proclaim_return_type<Key>([multiplicity, num_unique_keys] __device__(auto i) {
+        auto const num_matched = num_unique_keys * multiplicity;
+        return i < num_matched ? Key{i / multiplicity} : Key{i - num_matched + num_unique_keys};
+      }));
+    REQUIRE(
+      cuco::test::equal(probe_keys.begin(), probe_end, expected_begin, thrust::equal_to<Key>{}));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_multiset retrieve tests",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  // a high multiplicity ensures that the shared memory staging buffers are flushed mid-probe
+  constexpr size_type num_unique_keys{200};
+  constexpr size_type multiplicity{55};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set = cuco::static_multiset{2 * num_unique_keys * multiplicity,
+                                   cuco::empty_key<Key>{key_sentinel},
+                                   {},
+                                   probe{},
+                                   {},
+                                   cuco::storage<2>{}};
+
+  test_multiplicity(set, num_unique_keys, multiplicity);
+}
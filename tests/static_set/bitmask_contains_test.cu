@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+using size_type = int32_t;
+
+template <typename Set>
+void test_bitmask_contains(Set& set, size_type num_keys)
+{
+  using Key = typename Set::key_type;
+
+  // deliberately not a multiple of 32 so that the last bitmask word is partial
+  auto const num_words = (num_keys + 31) / 32;
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+  auto keys_begin = d_keys.begin();
+
+  auto is_even =
+    cuda::proclaim_return_type<bool>([] __device__(auto const& i) { return i % 2 == 0; });
+
+  // only even keys are inserted
+  set.insert_if(
+    keys_begin, keys_begin + num_keys, thrust::counting_iterator<std::size_t>(0), is_even);
+
+  thrust::device_vector<bool> d_contained(num_keys);
+  set.contains(keys_begin, keys_begin + num_keys, d_contained.begin());
+
+  thrust::device_vector<uint32_t> d_bitmask(num_words);
+  auto const* words = thrust::raw_pointer_cast(d_bitmask.data());
+
+  // checks that bit `i % 32` of word `i / 32` equals the expected boolean for key `i`
+  auto bit_equals_bool = cuda::proclaim_return_type<bool>([words] __device__(auto const& p) {
+    auto const idx      = thrust::get<0>(p);
+    bool const expected = thrust::get<1>(p);
+    return (((words[idx / 32] >> (idx % 32)) & 1u) != 0) == expected;
+  });
+  auto zip = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::counting_iterator<std::size_t>(0), d_contained.begin()));
+
+  SECTION("Bitmask matches the boolean contains output.")
+  {
+    set.contains_bitmask(keys_begin, keys_begin + num_keys, d_bitmask.begin());
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, bit_equals_bool));
+  }
+
+  SECTION("Trailing bits of the last word are zero.")
+  {
+    set.contains_bitmask(keys_begin, keys_begin + num_keys, d_bitmask.begin());
+    uint32_t const last_word = d_bitmask.back();
+    REQUIRE((last_word >> (num_keys % 32)) == 0);
+  }
+
+  SECTION("Conditional bitmask only sets bits where the predicate holds.")
+  {
+    // restrict the probe to the first half of the input
+    auto const half       = num_keys / 2;
+    auto const first_half = cuda::proclaim_return_type<bool>(
+      [half] __device__(auto const& i) { return i < static_cast<std::size_t>(half); });
+
+    set.contains_bitmask_if(keys_begin,
+                            keys_begin + num_keys,
+                            thrust::counting_iterator<std::size_t>(0),
+                            first_half,
+                            d_bitmask.begin());
+
+    set.contains_if(keys_begin,
+                    keys_begin + num_keys,
+                    thrust::counting_iterator<std::size_t>(0),
+                    first_half,
+                    d_contained.begin());
+    REQUIRE(cuco::test::all_of(zip, zip + num_keys, bit_equals_bool));
+  }
+
+  SECTION("Bitmask output can be consumed as a stencil by the boolean overloads.")
+  {
+    set.contains_bitmask(keys_begin, keys_begin + num_keys, d_bitmask.begin());
+
+    // re-probe only the keys whose bit is set; the result must reproduce the original booleans
+    auto bit_is_set = cuda::proclaim_return_type<bool>(
+      [words] __device__(auto const& i) { return ((words[i / 32] >> (i % 32)) & 1u) != 0; });
+
+    thrust::device_vector<bool> d_reprobed(num_keys);
+    set.contains_if(keys_begin,
+                    keys_begin + num_keys,
+                    thrust::counting_iterator<std::size_t>(0),
+                    bit_is_set,
+                    d_reprobed.begin());
+
+    REQUIRE(cuco::test::equal(
+      d_reprobed.begin(), d_reprobed.end(), d_contained.begin(), thrust::equal_to<bool>{}));
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "Bitmask contains",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 8),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  constexpr size_type num_keys{1'000};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set =
+    cuco::static_set{num_keys * 2, cuco::empty_key<Key>{-1}, {}, probe{}, {}, cuco::storage<2>{}};
+
+  test_bitmask_contains(set, num_keys);
+}
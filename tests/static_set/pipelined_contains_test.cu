@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstdint>
+
+using size_type = int32_t;
+
+template <typename Set>
+void test_pipelined_contains(Set& set, size_type num_keys)
+{
+  using Key = typename Set::key_type;
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+  set.insert(d_keys.begin(), d_keys.end());
+
+  // query twice the inserted range so that exactly the first half hits
+  thrust::device_vector<Key> d_queries(num_keys * 2);
+  thrust::sequence(thrust::device, d_queries.begin(), d_queries.end());
+
+  thrust::device_vector<bool> d_contained(num_keys * 2);
+  set.contains(d_queries.begin(), d_queries.end(), d_contained.begin());
+
+  auto zip = thrust::make_zip_iterator(
+    thrust::make_tuple(thrust::counting_iterator<size_type>(0), d_contained.begin()));
+  auto const num_inserted = num_keys;
+  auto expected = cuda::proclaim_return_type<bool>([num_inserted] __device__(auto const& p) {
+    return thrust::get<1>(p) == (thrust::get<0>(p) < num_inserted);
+  });
+
+  REQUIRE(cuco::test::all_of(zip, zip + num_keys * 2, expected));
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "Pipelined contains",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 8),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  constexpr size_type num_keys{10'000};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  // high load factor so that probe chains span multiple windows
+  auto set = cuco::static_set{cuco::extent<size_type>{num_keys * 5 / 4},
+                              cuco::empty_key<Key>{-1},
+                              {},
+                              probe{},
+                              {},
+                              cuco::storage<2>{}};
+
+  test_pipelined_contains(set, num_keys);
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+
+using size_type = int32_t;
+
+template <typename Set>
+void test_probe_statistics(Set& set, size_type num_keys)
+{
+  using Key = typename Set::key_type;
+
+  auto const histogram_sum = [](cuco::probing_statistics const& stats) {
+    return std::accumulate(stats.histogram.begin(), stats.histogram.end(), std::size_t{0});
+  };
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  SECTION("An empty container reports all-zero statistics.")
+  {
+    auto const stats = set.probe_statistics();
+    REQUIRE(histogram_sum(stats) == 0);
+    REQUIRE(stats.max_probe_length == 0);
+    REQUIRE(stats.tombstone_fraction == 0.0);
+  }
+
+  SECTION("The histogram accounts for every resident key.")
+  {
+    set.insert(d_keys.begin(), d_keys.end());
+
+    auto const stats = set.probe_statistics();
+    REQUIRE(histogram_sum(stats) == static_cast<std::size_t>(num_keys));
+    REQUIRE(stats.max_probe_length >= 1);
+    REQUIRE(stats.tombstone_fraction == 0.0);
+
+    // bins beyond the maximum probe length must be empty
+    if (stats.max_probe_length < cuco::probing_statistics::num_bins) {
+      REQUIRE(stats.histogram[stats.max_probe_length - 1] > 0);
+      for (auto i = stats.max_probe_length; i < cuco::probing_statistics::num_bins; ++i) {
+        REQUIRE(stats.histogram[i] == 0);
+      }
+    }
+  }
+
+  SECTION("Erased slots are reported as tombstones.")
+  {
+    set.insert(d_keys.begin(), d_keys.end());
+    set.erase(d_keys.begin(), d_keys.begin() + num_keys / 2);
+
+    auto const stats    = set.probe_statistics();
+    auto const expected = static_cast<double>(num_keys / 2) / static_cast<double>(set.capacity());
+    REQUIRE(histogram_sum(stats) == static_cast<std::size_t>(num_keys - num_keys / 2));
+    REQUIRE(stats.tombstone_fraction == expected);
+  }
+}
+
+TEMPLATE_TEST_CASE_SIG(
+  "Probe statistics",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize), Key, Probe, CGSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 8),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2))
+{
+  constexpr size_type num_keys{1'000};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set = cuco::static_set{num_keys * 2,
+                              cuco::empty_key<Key>{-1},
+                              cuco::erased_key<Key>{-2},
+                              {},
+                              probe{},
+                              {},
+                              cuco::storage<2>{}};
+
+  test_probe_statistics(set, num_keys);
+}
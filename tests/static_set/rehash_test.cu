@@ -16,6 +16,7 @@
 
 #include <cuco/static_set.cuh>
 
+#include <thrust/count.h>
 #include <thrust/device_vector.h>
 #include <thrust/sequence.h>
 
@@ -46,3 +47,63 @@ TEST_CASE("Rehash", "")
   set.rehash();
   REQUIRE(set.size() == num_keys - num_erased_keys);
 }
+
+TEST_CASE("Rehash in place", "")
+{
+  using key_type = int;
+
+  constexpr std::size_t num_keys{400};
+  constexpr std::size_t num_erased_keys{100};
+
+  cuco::static_set set{num_keys, cuco::empty_key<key_type>{-1}, cuco::erased_key<key_type>{-2}};
+
+  thrust::device_vector<key_type> d_keys(num_keys);
+
+  thrust::sequence(d_keys.begin(), d_keys.end());
+
+  set.insert(d_keys.begin(), d_keys.end());
+
+  set.rehash_in_place();
+  REQUIRE(set.size() == num_keys);
+
+  set.erase(d_keys.begin(), d_keys.begin() + num_erased_keys);
+  set.rehash_in_place();
+  REQUIRE(set.size() == num_keys - num_erased_keys);
+
+  thrust::device_vector<bool> d_contained(num_keys);
+  set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+  REQUIRE(thrust::count(d_contained.begin() + num_erased_keys, d_contained.end(), true) ==
+          static_cast<std::ptrdiff_t>(num_keys - num_erased_keys));
+}
+
+TEST_CASE("Rehash in place reclaims tombstones", "")
+{
+  using key_type = int;
+
+  constexpr std::size_t num_keys{400};
+
+  cuco::static_set set{num_keys, cuco::empty_key<key_type>{-1}, cuco::erased_key<key_type>{-2}};
+  auto const capacity = set.capacity();
+
+  // fill the table completely, then erase half of it; every erased slot becomes a tombstone
+  thrust::device_vector<key_type> d_keys(capacity);
+  thrust::sequence(d_keys.begin(), d_keys.end());
+  set.insert(d_keys.begin(), d_keys.end());
+  set.erase(d_keys.begin(), d_keys.begin() + capacity / 2);
+  REQUIRE(set.probe_statistics().tombstone_fraction > 0.0);
+
+  set.rehash_in_place();
+  REQUIRE(set.size() == capacity - capacity / 2);
+  REQUIRE(set.probe_statistics().tombstone_fraction == 0.0);
+
+  // with the tombstones reclaimed, a load that fits the non-tombstone occupancy succeeds
+  thrust::device_vector<key_type> d_new_keys(capacity / 2);
+  thrust::sequence(d_new_keys.begin(), d_new_keys.end(), static_cast<key_type>(capacity));
+  set.insert(d_new_keys.begin(), d_new_keys.end());
+  REQUIRE(set.size() == capacity);
+
+  thrust::device_vector<bool> d_contained(capacity / 2);
+  set.contains(d_new_keys.begin(), d_new_keys.end(), d_contained.begin());
+  REQUIRE(thrust::count(d_contained.begin(), d_contained.end(), true) ==
+          static_cast<std::ptrdiff_t>(capacity / 2));
+}
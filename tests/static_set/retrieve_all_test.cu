@@ -18,6 +18,7 @@
 
 #include <cuco/static_set.cuh>
 
+#include <thrust/copy.h>
 #include <thrust/device_vector.h>
 #include <thrust/distance.h>
 #include <thrust/functional.h>
@@ -55,6 +56,33 @@ void test_unique_sequence(Set& set, std::size_t num_keys)
     REQUIRE(cuco::test::equal(
       d_res.begin(), d_res_end, thrust::counting_iterator<Key>(0), thrust::equal_to<Key>{}));
   }
+
+  SECTION("Chunked retrieval streams all keys through a bounded buffer.")
+  {
+    using size_type = typename Set::size_type;
+
+    auto const buffer_capacity = static_cast<size_type>(num_keys / 7 + Set::window_size);
+    auto const total_windows   = static_cast<size_type>(set.capacity()) / Set::window_size;
+
+    thrust::device_vector<Key> d_buffer(buffer_capacity);
+    thrust::device_vector<Key> d_res(num_keys);
+
+    size_type window_offset = 0;
+    size_type num_retrieved = 0;
+    while (window_offset < total_windows) {
+      auto const chunk_size =
+        set.retrieve_chunk(d_buffer.begin(), buffer_capacity, window_offset);
+      REQUIRE(chunk_size <= buffer_capacity);
+      thrust::copy(
+        d_buffer.begin(), d_buffer.begin() + chunk_size, d_res.begin() + num_retrieved);
+      num_retrieved += chunk_size;
+    }
+
+    REQUIRE(num_retrieved == static_cast<size_type>(num_keys));
+    thrust::sort(d_res.begin(), d_res.end());
+    REQUIRE(cuco::test::equal(
+      d_res.begin(), d_res.end(), thrust::counting_iterator<Key>(0), thrust::equal_to<Key>{}));
+  }
 }
 
 TEMPLATE_TEST_CASE_SIG(
@@ -41,3 +41,34 @@ TEST_CASE("Size computation", "")
 
   REQUIRE(set.size() == 0);
 }
+
+TEST_CASE("Size computation, counted mode", "")
+{
+  constexpr std::size_t num_keys{400};
+
+  cuco::static_set<int> set{
+    cuco::extent<std::size_t>{800}, cuco::empty_key{-1}, cuco::erased_key{-2}};
+
+  thrust::device_vector<int> d_keys(num_keys);
+
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+
+  set.insert(d_keys.begin(), d_keys.begin() + num_keys / 2);
+
+  set.enable_counted_size();
+  REQUIRE(set.counted_size_enabled());
+  REQUIRE(set.size() == num_keys / 2);
+
+  set.insert(d_keys.begin(), d_keys.end());
+  REQUIRE(set.size() == num_keys);
+
+  set.erase(d_keys.begin(), d_keys.begin() + num_keys / 4);
+  REQUIRE(set.size() == num_keys - num_keys / 4);
+
+  set.clear();
+  REQUIRE(set.size() == 0);
+
+  set.disable_counted_size();
+  REQUIRE(not set.counted_size_enabled());
+  REQUIRE(set.size() == 0);
+}
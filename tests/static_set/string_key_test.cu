@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/string_key.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cuda/functional>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+
+// flattens a batch of host strings into a concatenated char buffer plus exclusive offsets
+void flatten(std::vector<std::string> const& strings,
+             thrust::device_vector<char>& d_chars,
+             thrust::device_vector<std::size_t>& d_offsets)
+{
+  std::vector<char> h_chars;
+  std::vector<std::size_t> h_offsets{0};
+  for (auto const& s : strings) {
+    h_chars.insert(h_chars.end(), s.begin(), s.end());
+    h_offsets.push_back(h_chars.size());
+  }
+  d_chars   = h_chars;
+  d_offsets = h_offsets;
+}
+
+}  // namespace
+
+TEST_CASE("Out-of-line string keys", "")
+{
+  using handle_type = cuco::string_key_handle;
+  using probe_type  = cuco::linear_probing<1, cuco::string_key_hash<>>;
+  using set_type    = cuco::static_set<handle_type,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    cuco::string_key_equal,
+                                    probe_type,
+                                    cuco::cuda_allocator<handle_type>,
+                                    cuco::storage<1>>;
+
+  constexpr std::size_t num_keys{1'000};
+
+  std::vector<std::string> keys(num_keys);
+  std::vector<std::string> other_keys(num_keys);
+  for (std::size_t i = 0; i < num_keys; ++i) {
+    // variable-length keys, including duplicated prefixes
+    keys[i]       = "key_" + std::to_string(i) + std::string(i % 17, 'x');
+    other_keys[i] = "absent_" + std::to_string(i);
+  }
+
+  thrust::device_vector<char> d_chars;
+  thrust::device_vector<std::size_t> d_offsets;
+  flatten(keys, d_chars, d_offsets);
+
+  cuco::string_arena<> arena{1 << 20};
+  thrust::device_vector<handle_type> d_handles(num_keys);
+  arena.append_async(thrust::raw_pointer_cast(d_chars.data()),
+                     d_chars.size(),
+                     thrust::raw_pointer_cast(d_offsets.data()),
+                     num_keys,
+                     thrust::raw_pointer_cast(d_handles.data()),
+                     {});
+  CUCO_CUDA_TRY(cudaDeviceSynchronize());
+  REQUIRE(arena.size() == d_chars.size());
+
+  set_type set{num_keys * 2,
+               cuco::empty_key<handle_type>{handle_type::invalid()},
+               arena.key_eq(),
+               probe_type{arena.hash_function()}};
+
+  set.insert(d_handles.begin(), d_handles.end());
+  REQUIRE(set.size() == num_keys);
+
+  SECTION("contains by handle")
+  {
+    thrust::device_vector<bool> d_contained(num_keys);
+    set.contains(d_handles.begin(), d_handles.end(), d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("heterogeneous probe by string view")
+  {
+    auto const chars_ptr   = thrust::raw_pointer_cast(d_chars.data());
+    auto const offsets_ptr = thrust::raw_pointer_cast(d_offsets.data());
+    auto views_begin       = thrust::make_transform_iterator(
+      thrust::counting_iterator<std::size_t>{0},
+      cuda::proclaim_return_type<cuco::string_key_view>(
+        [chars_ptr, offsets_ptr] __device__(std::size_t i) {
+          return cuco::make_string_key_view(
+            chars_ptr + offsets_ptr[i],
+            static_cast<std::uint32_t>(offsets_ptr[i + 1] - offsets_ptr[i]));
+        }));
+
+    thrust::device_vector<bool> d_contained(num_keys);
+    set.contains(views_begin, views_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("non-inserted strings are rejected")
+  {
+    thrust::device_vector<char> d_other_chars;
+    thrust::device_vector<std::size_t> d_other_offsets;
+    flatten(other_keys, d_other_chars, d_other_offsets);
+
+    auto const chars_ptr   = thrust::raw_pointer_cast(d_other_chars.data());
+    auto const offsets_ptr = thrust::raw_pointer_cast(d_other_offsets.data());
+    auto views_begin       = thrust::make_transform_iterator(
+      thrust::counting_iterator<std::size_t>{0},
+      cuda::proclaim_return_type<cuco::string_key_view>(
+        [chars_ptr, offsets_ptr] __device__(std::size_t i) {
+          return cuco::make_string_key_view(
+            chars_ptr + offsets_ptr[i],
+            static_cast<std::uint32_t>(offsets_ptr[i + 1] - offsets_ptr[i]));
+        }));
+
+    thrust::device_vector<bool> d_contained(num_keys);
+    set.contains(views_begin, views_begin + num_keys, d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+}
+
+TEST_CASE("Oversized string keys are rejected", "")
+{
+  using handle_type = cuco::string_key_handle;
+
+  // one valid string plus one that exceeds the handle's 16-bit size field
+  std::vector<std::string> keys{"short", std::string(handle_type::max_size + 1, 'x')};
+
+  thrust::device_vector<char> d_chars;
+  thrust::device_vector<std::size_t> d_offsets;
+  flatten(keys, d_chars, d_offsets);
+
+  cuco::string_arena<> arena{1 << 20};
+  thrust::device_vector<handle_type> d_handles(keys.size());
+  REQUIRE_THROWS(arena.append_async(thrust::raw_pointer_cast(d_chars.data()),
+                                    d_chars.size(),
+                                    thrust::raw_pointer_cast(d_offsets.data()),
+                                    keys.size(),
+                                    thrust::raw_pointer_cast(d_handles.data()),
+                                    {}));
+  // the rejected batch must not occupy arena space
+  REQUIRE(arena.size() == 0);
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+using size_type = int32_t;
+
+TEMPLATE_TEST_CASE_SIG(
+  "Tagged storage",
+  "",
+  ((typename Key, cuco::test::probe_sequence Probe, int CGSize, int WindowSize),
+   Key,
+   Probe,
+   CGSize,
+   WindowSize),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 1, 1),
+  (int32_t, cuco::test::probe_sequence::double_hashing, 2, 2),
+  (int64_t, cuco::test::probe_sequence::double_hashing, 1, 2),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 1, 1),
+  (int32_t, cuco::test::probe_sequence::linear_probing, 2, 2),
+  (int64_t, cuco::test::probe_sequence::linear_probing, 1, 2))
+{
+  constexpr size_type num_keys{400};
+
+  using probe = std::conditional_t<Probe == cuco::test::probe_sequence::linear_probing,
+                                   cuco::linear_probing<CGSize, cuco::default_hash_function<Key>>,
+                                   cuco::double_hashing<CGSize, cuco::default_hash_function<Key>>>;
+
+  auto set = cuco::static_set{num_keys * 2,
+                              cuco::empty_key<Key>{-1},
+                              cuco::erased_key<Key>{-2},
+                              {},
+                              probe{},
+                              {},
+                              cuco::tagged_storage<WindowSize>{}};
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(d_keys.begin(), d_keys.end());
+
+  thrust::device_vector<bool> d_contained(num_keys);
+
+  SECTION("Non-inserted keys should not be contained.")
+  {
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  set.insert(d_keys.begin(), d_keys.end());
+  REQUIRE(set.size() == num_keys);
+
+  SECTION("All inserted keys should be contained.")
+  {
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Keys whose fingerprints cannot match should not be contained.")
+  {
+    thrust::device_vector<Key> d_missing(num_keys);
+    thrust::sequence(d_missing.begin(), d_missing.end(), static_cast<Key>(num_keys));
+
+    set.contains(d_missing.begin(), d_missing.end(), d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("All inserted keys should be correctly recovered during find")
+  {
+    thrust::device_vector<Key> d_results(num_keys);
+
+    set.find(d_keys.begin(), d_keys.end(), d_results.begin());
+    REQUIRE(cuco::test::equal(
+      d_results.begin(), d_results.end(), d_keys.begin(), thrust::equal_to<Key>{}));
+  }
+
+  SECTION("Erased keys should not be contained while others remain lookupable.")
+  {
+    auto const num_erased = num_keys / 2;
+    set.erase(d_keys.begin(), d_keys.begin() + num_erased);
+
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::equal(
+      d_contained.begin(),
+      d_contained.end(),
+      thrust::counting_iterator<size_type>(0),
+      cuda::proclaim_return_type<bool>(
+        [num_erased] __device__(auto const& contained, auto const& idx) {
+          return contained == (idx >= num_erased);
+        })));
+
+    // Re-inserting erased keys must republish their fingerprints
+    set.insert(d_keys.begin(), d_keys.begin() + num_keys / 2);
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+
+  SECTION("Clearing the container must also reset the fingerprints.")
+  {
+    set.clear();
+    REQUIRE(set.size() == 0);
+
+    set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+    REQUIRE(cuco::test::none_of(d_contained.begin(), d_contained.end(), thrust::identity{}));
+  }
+}
@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+
+#include <cuda/functional>
+#include <thrust/device_vector.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
+#include <catch2/catch_template_test_macros.hpp>
+
+TEMPLATE_TEST_CASE_SIG(
+  "static_set transform_reduce tests", "", ((typename Key), Key), (int32_t), (int64_t))
+{
+  constexpr std::size_t num_keys{1'000};
+
+  auto set = cuco::static_set{2 * num_keys, cuco::empty_key<Key>{-1}};
+
+  auto keys_begin = thrust::counting_iterator<Key>(0);
+  cuda::stream_ref stream{};
+  set.insert(keys_begin, keys_begin + num_keys, stream);
+
+  thrust::device_vector<int64_t> d_result(1);
+
+  // Sum of all keys
+  set.transform_reduce_async(
+    d_result.data().get(),
+    cuda::proclaim_return_type<int64_t>(
+      [] __device__(Key const key) { return static_cast<int64_t>(key); }),
+    int64_t{0},
+    thrust::plus<int64_t>{},
+    stream);
+  stream.wait();
+  REQUIRE(d_result[0] == static_cast<int64_t>(num_keys * (num_keys - 1) / 2));
+
+  // Count of keys divisible by three
+  set.transform_reduce_async(
+    d_result.data().get(),
+    cuda::proclaim_return_type<int64_t>(
+      [] __device__(Key const key) { return static_cast<int64_t>(key % 3 == 0); }),
+    int64_t{0},
+    thrust::plus<int64_t>{},
+    stream);
+  stream.wait();
+  REQUIRE(d_result[0] == static_cast<int64_t>((num_keys + 2) / 3));
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/trie.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Flattens a set of variable-length keys into a single label array plus exclusive offsets
+void flatten(std::vector<std::string> const& keys,
+             thrust::device_vector<char>& labels,
+             thrust::device_vector<std::size_t>& offsets)
+{
+  thrust::host_vector<char> h_labels;
+  thrust::host_vector<std::size_t> h_offsets;
+  h_offsets.push_back(0);
+  for (auto const& key : keys) {
+    h_labels.insert(h_labels.end(), key.begin(), key.end());
+    h_offsets.push_back(h_labels.size());
+  }
+  labels  = h_labels;
+  offsets = h_offsets;
+}
+
+}  // namespace
+
+TEST_CASE("Trie lookup", "")
+{
+  using trie_type = cuco::experimental::trie<char>;
+  using size_type = trie_type::size_type;
+
+  // all strings of length 1..4 over a 4-character alphabet
+  std::vector<std::string> keys;
+  std::string const alphabet = "behn";
+  for (auto const a : alphabet) {
+    keys.push_back({a});
+    for (auto const b : alphabet) {
+      keys.push_back({a, b});
+      for (auto const c : alphabet) {
+        keys.push_back({a, b, c});
+        for (auto const d : alphabet) {
+          keys.push_back({a, b, c, d});
+        }
+      }
+    }
+  }
+  std::sort(keys.begin(), keys.end());
+
+  trie_type trie;
+  for (auto const& key : keys) {
+    trie.insert(key.begin(), key.end());
+  }
+  trie.build();
+
+  REQUIRE(trie.size() == keys.size());
+
+  // key indices enumerate the stored keys sorted by (length, lexicographic order)
+  auto id_order = keys;
+  std::sort(id_order.begin(), id_order.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.size() != rhs.size() ? lhs.size() < rhs.size() : lhs < rhs;
+  });
+
+  SECTION("All inserted keys are found at their expected indices")
+  {
+    thrust::device_vector<char> labels;
+    thrust::device_vector<std::size_t> offsets;
+    flatten(id_order, labels, offsets);
+
+    thrust::device_vector<size_type> results(id_order.size());
+    trie.lookup(labels.begin(), offsets.begin(), offsets.end(), results.begin());
+
+    thrust::host_vector<size_type> h_results = results;
+    for (size_type i = 0; i < id_order.size(); ++i) {
+      REQUIRE(h_results[i] == i);
+    }
+  }
+
+  SECTION("Keys not present in the trie are not found")
+  {
+    std::vector<std::string> const queries{
+      "", "a", "x", "bz", "beh" + std::string{alphabet.front() - 1}, "bbbbb", "nnnnn", "behnb"};
+
+    thrust::device_vector<char> labels;
+    thrust::device_vector<std::size_t> offsets;
+    flatten(queries, labels, offsets);
+
+    thrust::device_vector<size_type> results(queries.size());
+    trie.lookup(labels.begin(), offsets.begin(), offsets.end(), results.begin());
+
+    thrust::host_vector<size_type> h_results = results;
+    for (auto const result : h_results) {
+      REQUIRE(result == trie_type::not_found);
+    }
+  }
+}
+
+TEST_CASE("Trie lookup with empty key", "")
+{
+  using trie_type = cuco::experimental::trie<char>;
+  using size_type = trie_type::size_type;
+
+  std::vector<std::string> const keys{"", "a", "ab"};
+
+  trie_type trie;
+  for (auto const& key : keys) {
+    trie.insert(key.begin(), key.end());
+  }
+  trie.build();
+
+  thrust::device_vector<char> labels;
+  thrust::device_vector<std::size_t> offsets;
+  flatten(keys, labels, offsets);
+
+  thrust::device_vector<size_type> results(keys.size());
+  trie.lookup(labels.begin(), offsets.begin(), offsets.end(), results.begin());
+
+  thrust::host_vector<size_type> h_results = results;
+  for (size_type i = 0; i < keys.size(); ++i) {
+    REQUIRE(h_results[i] == i);
+  }
+}
+
+TEST_CASE("Trie rejects out-of-order insertions", "")
+{
+  cuco::experimental::trie<char> trie;
+
+  std::string const first{"b"};
+  trie.insert(first.begin(), first.end());
+
+  std::string const duplicate{"b"};
+  REQUIRE_THROWS_AS(trie.insert(duplicate.begin(), duplicate.end()), cuco::logic_error);
+
+  std::string const smaller{"a"};
+  REQUIRE_THROWS_AS(trie.insert(smaller.begin(), smaller.end()), cuco::logic_error);
+}
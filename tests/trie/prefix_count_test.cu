@@ -0,0 +1,143 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/trie.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/host_vector.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace {
+
+// Flattens a set of variable-length keys into a single label array plus exclusive offsets
+void flatten(std::vector<std::string> const& keys,
+             thrust::device_vector<char>& labels,
+             thrust::device_vector<std::size_t>& offsets)
+{
+  thrust::host_vector<char> h_labels;
+  thrust::host_vector<std::size_t> h_offsets;
+  h_offsets.push_back(0);
+  for (auto const& key : keys) {
+    h_labels.insert(h_labels.end(), key.begin(), key.end());
+    h_offsets.push_back(h_labels.size());
+  }
+  labels  = h_labels;
+  offsets = h_offsets;
+}
+
+std::size_t reference_prefix_count(std::vector<std::string> const& keys, std::string const& prefix)
+{
+  return std::count_if(keys.begin(), keys.end(), [&](auto const& key) {
+    return key.size() >= prefix.size() and
+           std::equal(prefix.begin(), prefix.end(), key.begin());
+  });
+}
+
+}  // namespace
+
+TEST_CASE("Trie prefix count", "")
+{
+  using trie_type = cuco::experimental::trie<char>;
+  using size_type = trie_type::size_type;
+
+  std::vector<std::string> const keys{"a", "ab", "abc", "abd", "b"};
+
+  trie_type trie;
+  for (auto const& key : keys) {
+    trie.insert(key.begin(), key.end());
+  }
+  trie.build();
+
+  std::vector<std::string> const queries{"", "a", "ab", "abc", "abcd", "b", "bc", "c"};
+  std::vector<size_type> const expected{5, 4, 3, 1, 0, 1, 0, 0};
+
+  thrust::device_vector<char> labels;
+  thrust::device_vector<std::size_t> offsets;
+  flatten(queries, labels, offsets);
+
+  thrust::device_vector<size_type> results(queries.size());
+  trie.prefix_count(labels.begin(), offsets.begin(), offsets.end(), results.begin());
+
+  thrust::host_vector<size_type> h_results = results;
+  for (size_type i = 0; i < queries.size(); ++i) {
+    REQUIRE(h_results[i] == expected[i]);
+  }
+}
+
+TEST_CASE("Trie prefix count with random keys", "")
+{
+  using trie_type = cuco::experimental::trie<char>;
+  using size_type = trie_type::size_type;
+
+  std::string const alphabet = "abcd";
+  std::mt19937 gen{42};
+  std::uniform_int_distribution<std::size_t> length_dist{1, 8};
+  std::uniform_int_distribution<std::size_t> label_dist{0, alphabet.size() - 1};
+
+  std::set<std::string> unique_keys;
+  constexpr std::size_t num_keys{10'000};
+  while (unique_keys.size() < num_keys) {
+    std::string key;
+    auto const length = length_dist(gen);
+    for (std::size_t i = 0; i < length; ++i) {
+      key.push_back(alphabet[label_dist(gen)]);
+    }
+    unique_keys.insert(std::move(key));
+  }
+  std::vector<std::string> const keys{unique_keys.begin(), unique_keys.end()};
+
+  trie_type trie;
+  for (auto const& key : keys) {
+    trie.insert(key.begin(), key.end());
+  }
+  trie.build();
+
+  // query random prefixes, including ones over a label that never occurs in the keys
+  std::vector<std::string> queries;
+  std::uniform_int_distribution<std::size_t> query_label_dist{0, alphabet.size()};
+  constexpr std::size_t num_queries{1'000};
+  for (std::size_t i = 0; i < num_queries; ++i) {
+    std::string query;
+    auto const length = length_dist(gen);
+    for (std::size_t j = 0; j < length; ++j) {
+      auto const label = query_label_dist(gen);
+      query.push_back(label == alphabet.size() ? 'e' : alphabet[label]);
+    }
+    queries.push_back(std::move(query));
+  }
+
+  thrust::device_vector<char> labels;
+  thrust::device_vector<std::size_t> offsets;
+  flatten(queries, labels, offsets);
+
+  thrust::device_vector<size_type> results(queries.size());
+  trie.prefix_count(labels.begin(), offsets.begin(), offsets.end(), results.begin());
+
+  thrust::host_vector<size_type> h_results = results;
+  for (size_type i = 0; i < queries.size(); ++i) {
+    REQUIRE(h_results[i] == reference_prefix_count(keys, queries[i]));
+  }
+}
@@ -53,4 +53,28 @@ TEMPLATE_TEST_CASE_SIG(
     auto const res  = cuco::make_window_extent<cg_size, window_size>(size);
     REQUIRE(gold_reference == res.value());
   }
+
+  SizeType constexpr pow2_gold_reference = 512;  // 256 x 2
+
+  SECTION("Compute static power-of-two extent at compile time.")
+  {
+    auto constexpr size = cuco::power_of_two_extent<SizeType, num>{};
+    auto constexpr res  = cuco::make_window_extent<cg_size, window_size>(size);
+    STATIC_REQUIRE(pow2_gold_reference == res.value());
+  }
+
+  SECTION("Compute dynamic power-of-two extent at run time.")
+  {
+    auto const size = cuco::power_of_two_extent<SizeType>{num};
+    auto const res  = cuco::make_window_extent<cg_size, window_size>(size);
+    REQUIRE(pow2_gold_reference == res.value());
+  }
+
+  SECTION("Power-of-two window extents reduce indices with a bitwise AND.")
+  {
+    auto const size = cuco::power_of_two_extent<SizeType>{num};
+    auto const res  = cuco::make_window_extent<cg_size, window_size>(size);
+    REQUIRE(SizeType{513} % res == SizeType{1});
+    REQUIRE(SizeType{511} % res == SizeType{511});
+  }
 }
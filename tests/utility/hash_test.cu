@@ -21,10 +21,13 @@
 
 #include <thrust/device_vector.h>
 
+#include <cooperative_groups.h>
+
 #include <catch2/catch_template_test_macros.hpp>
 #include <catch2/catch_test_macros.hpp>
 
 #include <cstddef>
+#include <cstdint>
 
 template <int32_t Words>
 struct large_key {
@@ -220,6 +223,120 @@ TEST_CASE("Test cuco::xxhash_32", "")
   }
 }
 
+template <typename OutputIter>
+__global__ void check_hash_result_kernel_xxhash3(OutputIter result)
+{
+  int i = 0;
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>>(0, 14144645293874801883ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>>(42, 8777568547874204941ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<char>>(0, 6697150685477982789ull, 42);
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(0, 5238470482016868669ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(0, 14325386350854113765ull, 42);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(42, 2392174772787195229ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int32_t>>(123456789, 5186869424260940993ull, 0);
+
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(0, 14374147212387527897ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(0, 5014318936221084462ull, 42);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(42, 15395265915043915720ull, 0);
+  result[i++] = check_hash_result<cuco::xxhash3_64<int64_t>>(123456789, 2817400364357085909ull, 0);
+
+#if defined(CUCO_HAS_INT128)
+  result[i++] = check_hash_result<cuco::xxhash3_64<__int128>>(123456789, 7602280935813847626ull, 0);
+#endif
+
+  // 128-, 200- and 256-byte keys to test the mid-size and long input paths
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<32>>>(123456789, 9278458725499332637ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<50>>>(123456789, 12172601846230443537ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<50>>>(123456789, 16277592950157313238ull, 42);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<64>>>(123456789, 15962532058857181731ull, 0);
+  result[i++] =
+    check_hash_result<cuco::xxhash3_64<large_key<64>>>(123456789, 14005426436104435755ull, 42);
+}
+
+template <typename Key, typename CG>
+__device__ bool check_cooperative_hash_result(CG const& tile,
+                                              Key const& key,
+                                              std::uint64_t seed) noexcept
+{
+  cuco::xxhash3_64<Key> const hash{seed};
+  return (hash(tile, key) == hash(key));
+}
+
+__global__ void check_cooperative_hash_result_kernel_xxhash3(bool* result)
+{
+  auto const tile =
+    cooperative_groups::tiled_partition<4>(cooperative_groups::this_thread_block());
+  int i = 0;
+
+  result[i++] = check_cooperative_hash_result(tile, large_key<16>{123456789}, 0);
+  result[i++] = check_cooperative_hash_result(tile, large_key<32>{123456789}, 0);
+  result[i++] = check_cooperative_hash_result(tile, large_key<32>{123456789}, 42);
+  result[i++] = check_cooperative_hash_result(tile, large_key<50>{123456789}, 0);
+  result[i++] = check_cooperative_hash_result(tile, large_key<50>{123456789}, 42);
+  result[i++] = check_cooperative_hash_result(tile, large_key<64>{123456789}, 0);
+  result[i++] = check_cooperative_hash_result(tile, large_key<64>{123456789}, 42);
+}
+
+TEST_CASE("Test cuco::xxhash3_64", "")
+{
+  // Reference hash values were computed using https://github.com/Cyan4973/xxHash
+  SECTION("Check if host-generated hash values match the reference implementation.")
+  {
+    CHECK(check_hash_result<cuco::xxhash3_64<char>>(0, 14144645293874801883ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<char>>(42, 8777568547874204941ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<char>>(0, 6697150685477982789ull, 42));
+
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(0, 5238470482016868669ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(0, 14325386350854113765ull, 42));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(42, 2392174772787195229ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<int32_t>>(123456789, 5186869424260940993ull, 0));
+
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(0, 14374147212387527897ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(0, 5014318936221084462ull, 42));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(42, 15395265915043915720ull, 0));
+    CHECK(check_hash_result<cuco::xxhash3_64<int64_t>>(123456789, 2817400364357085909ull, 0));
+
+#if defined(CUCO_HAS_INT128)
+    CHECK(check_hash_result<cuco::xxhash3_64<__int128>>(123456789, 7602280935813847626ull, 0));
+#endif
+
+    // 128-, 200- and 256-byte keys to test the mid-size and long input paths
+    CHECK(check_hash_result<cuco::xxhash3_64<large_key<32>>>(123456789, 9278458725499332637ull, 0));
+    CHECK(
+      check_hash_result<cuco::xxhash3_64<large_key<50>>>(123456789, 12172601846230443537ull, 0));
+    CHECK(
+      check_hash_result<cuco::xxhash3_64<large_key<50>>>(123456789, 16277592950157313238ull, 42));
+    CHECK(
+      check_hash_result<cuco::xxhash3_64<large_key<64>>>(123456789, 15962532058857181731ull, 0));
+    CHECK(
+      check_hash_result<cuco::xxhash3_64<large_key<64>>>(123456789, 14005426436104435755ull, 42));
+  }
+
+  SECTION("Check if device-generated hash values match the reference implementation.")
+  {
+    thrust::device_vector<bool> result(17, true);
+
+    check_hash_result_kernel_xxhash3<<<1, 1>>>(result.begin());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), thrust::identity<bool>{}));
+  }
+
+  SECTION("Check if cooperatively computed hash values match the single-threaded overload.")
+  {
+    thrust::device_vector<bool> result(7, true);
+
+    check_cooperative_hash_result_kernel_xxhash3<<<1, 4>>>(result.data().get());
+
+    CHECK(cuco::test::all_of(result.begin(), result.end(), thrust::identity<bool>{}));
+  }
+}
+
 TEMPLATE_TEST_CASE_SIG("Static vs. dynamic key hash test",
                        "",
                        ((typename Hash), Hash),
@@ -228,7 +345,9 @@ TEMPLATE_TEST_CASE_SIG("Static vs. dynamic key hash test",
                        (cuco::xxhash_32<char>),
                        (cuco::xxhash_32<int32_t>),
                        (cuco::xxhash_64<char>),
-                       (cuco::xxhash_64<int32_t>))
+                       (cuco::xxhash_64<int32_t>),
+                       (cuco::xxhash3_64<char>),
+                       (cuco::xxhash3_64<int32_t>))
 {
   using key_type = typename Hash::argument_type;
 
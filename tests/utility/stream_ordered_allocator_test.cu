@@ -0,0 +1,70 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cuco/static_map.cuh>
+#include <cuco/utility/stream_ordered_allocator.hpp>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <limits>
+
+TEST_CASE("Stream-ordered allocator", "")
+{
+  constexpr std::size_t num_keys{400};
+
+  using Key      = int32_t;
+  using Value    = int32_t;
+  using map_type = cuco::static_map<Key,
+                                    Value,
+                                    cuco::extent<std::size_t>,
+                                    cuda::thread_scope_device,
+                                    thrust::equal_to<Key>,
+                                    cuco::linear_probing<1, cuco::default_hash_function<Key>>,
+                                    cuco::stream_ordered_allocator<cuco::pair<Key, Value>>>;
+
+  cudaStream_t stream;
+  CUCO_CUDA_TRY(cudaStreamCreate(&stream));
+
+  auto allocator = cuco::stream_ordered_allocator<cuco::pair<Key, Value>>{cuda::stream_ref{stream}};
+  allocator.set_release_threshold(std::numeric_limits<std::size_t>::max());
+  allocator.reserve_pool(num_keys * sizeof(cuco::pair<Key, Value>));
+
+  map_type map{num_keys * 2,
+               cuco::empty_key<Key>{-1},
+               cuco::empty_value<Value>{-1},
+               thrust::equal_to<Key>{},
+               cuco::linear_probing<1, cuco::default_hash_function<Key>>{},
+               {},
+               {},
+               allocator,
+               cuda::stream_ref{stream}};
+
+  thrust::device_vector<cuco::pair<Key, Value>> d_pairs(num_keys);
+  for (std::size_t i = 0; i < num_keys; ++i) {
+    d_pairs[i] = cuco::pair<Key, Value>{static_cast<Key>(i), static_cast<Value>(i)};
+  }
+
+  map.insert(d_pairs.begin(), d_pairs.end(), cuda::stream_ref{stream});
+
+  REQUIRE(map.size(cuda::stream_ref{stream}) == num_keys);
+
+  CUCO_CUDA_TRY(cudaStreamSynchronize(stream));
+  CUCO_CUDA_TRY(cudaStreamDestroy(stream));
+}
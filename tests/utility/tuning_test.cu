@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <test_utils.hpp>
+
+#include <cuco/static_set.cuh>
+#include <cuco/utility/tuning.cuh>
+
+#include <thrust/device_vector.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/sequence.h>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+namespace {
+
+// builds a set with the given configuration, inserts `num_keys` keys, and verifies lookup
+template <typename Config>
+bool run_workload(Config, std::size_t num_keys)
+{
+  using Key     = int32_t;
+  using probing = cuco::double_hashing<Config::cg_size, cuco::default_hash_function<Key>>;
+
+  auto set = cuco::static_set{num_keys * 2,
+                              cuco::empty_key<Key>{-1},
+                              {},
+                              probing{},
+                              {},
+                              cuco::storage<Config::window_size>{}};
+
+  thrust::device_vector<Key> d_keys(num_keys);
+  thrust::sequence(thrust::device, d_keys.begin(), d_keys.end());
+  set.insert(d_keys.begin(), d_keys.end());
+
+  thrust::device_vector<bool> d_contained(num_keys);
+  set.contains(d_keys.begin(), d_keys.end(), d_contained.begin());
+
+  return cuco::test::all_of(d_contained.begin(), d_contained.end(), thrust::identity{});
+}
+
+}  // namespace
+
+TEST_CASE("Probing config dispatch", "")
+{
+  constexpr std::size_t num_keys{1'000};
+
+  SECTION("The dispatched tag carries the expected compile-time parameters.")
+  {
+    cuco::dispatch_probing_config(0, [](auto config) {
+      using config_type = decltype(config);
+      STATIC_REQUIRE(config_type::cg_size == 1);
+      STATIC_REQUIRE(config_type::window_size == 2);
+    });
+    cuco::dispatch_probing_config(cuco::num_probing_configs - 1, [](auto config) {
+      using config_type = decltype(config);
+      STATIC_REQUIRE(config_type::cg_size == 8);
+      STATIC_REQUIRE(config_type::window_size == 1);
+    });
+  }
+
+  SECTION("Every configuration of the matrix yields a working container.")
+  {
+    for (std::size_t index = 0; index < cuco::num_probing_configs; ++index) {
+      REQUIRE(cuco::dispatch_probing_config(
+        index, [&](auto config) { return run_workload(config, num_keys); }));
+    }
+  }
+}
+
+TEST_CASE("Probing config selection", "")
+{
+  // low occupancy favors scalar probing, high occupancy larger cooperative groups
+  STATIC_REQUIRE(cuco::select_probing_config(0.3) == 0);
+  STATIC_REQUIRE(cuco::select_probing_config(0.6) == 1);
+  STATIC_REQUIRE(cuco::select_probing_config(0.9) == 2);
+  // 16-byte slots fall back to single-slot windows
+  STATIC_REQUIRE(cuco::select_probing_config(0.5, 16) == 3);
+
+  STATIC_REQUIRE(cuco::select_probing_config(1.0) < cuco::num_probing_configs);
+}
+
+TEST_CASE("Probing config microbenchmark", "")
+{
+  constexpr std::size_t num_keys{1'000};
+
+  auto const index = cuco::fastest_probing_config(
+    [&](auto config) { REQUIRE(run_workload(config, num_keys)); });
+
+  REQUIRE(index < cuco::num_probing_configs);
+
+  // the winning configuration must be usable through the dispatcher
+  REQUIRE(cuco::dispatch_probing_config(
+    index, [&](auto config) { return run_workload(config, num_keys); }));
+}